@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2020-2021 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Measures the cost of looking up resources in a synthetic 50k-entry KEY file,
+ *  comparing the hashed index of KeyReader with a linear search over the entries.
+ */
+
+#include <chrono>
+
+#include "../engine/resource/format/keyreader.h"
+
+using namespace std;
+
+using namespace reone::resource;
+
+static constexpr int kKeyCount = 50000;
+static constexpr int kHashedLookupCount = 1000000;
+static constexpr int kLinearLookupCount = 2000;
+
+static const ResourceType kResTypes[] { ResourceType::Mdl, ResourceType::Mdx, ResourceType::Tpc, ResourceType::Utc };
+
+static void putUint16(string &s, uint16_t val) {
+    s.append(reinterpret_cast<const char *>(&val), 2);
+}
+
+static void putUint32(string &s, uint32_t val) {
+    s.append(reinterpret_cast<const char *>(&val), 4);
+}
+
+static string getResRef(int idx) {
+    return str(boost::format("res_%05d") % idx);
+}
+
+static shared_ptr<istream> makeKeyFile() {
+    static const string bifFilename("data\\synthetic.bif");
+
+    uint32_t filesOffset = 64;
+    uint32_t filenameOffset = filesOffset + 12;
+    uint32_t keysOffset = filenameOffset + static_cast<uint32_t>(bifFilename.size());
+
+    string key("KEY V1  ");
+    putUint32(key, 1);
+    putUint32(key, kKeyCount);
+    putUint32(key, filesOffset);
+    putUint32(key, keysOffset);
+    key.resize(filesOffset, '\0');
+
+    putUint32(key, 0);
+    putUint32(key, filenameOffset);
+    putUint16(key, static_cast<uint16_t>(bifFilename.size()));
+    putUint16(key, 0);
+    key.append(bifFilename);
+
+    for (int i = 0; i < kKeyCount; ++i) {
+        string resRef(getResRef(i / 4));
+        resRef.resize(16, '\0');
+        key.append(resRef);
+        putUint16(key, static_cast<uint16_t>(kResTypes[i % 4]));
+        putUint32(key, i);
+    }
+
+    return make_shared<istringstream>(key);
+}
+
+/**
+ * Reproduces the lookup algorithm, that KeyReader used prior to indexing.
+ */
+static const KeyReader::KeyEntry *findLinear(const KeyReader &key, const string &resRef, ResourceType type) {
+    string lcResRef(boost::to_lower_copy(resRef));
+
+    auto it = find_if(
+        key.keys().begin(),
+        key.keys().end(),
+        [&](const KeyReader::KeyEntry &e) { return e.resRef == lcResRef && e.resType == type; });
+
+    return it != key.keys().end() ? &*it : nullptr;
+}
+
+template <class Find>
+static double measure(int lookupCount, const vector<string> &resRefs, Find find) {
+    int found = 0;
+    auto start = chrono::steady_clock::now();
+
+    for (int i = 0; i < lookupCount; ++i) {
+        const string &resRef = resRefs[i % resRefs.size()];
+        if (find(resRef, kResTypes[i % 4])) {
+            ++found;
+        }
+    }
+
+    auto elapsed = chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start);
+    cout << "  found " << found << " of " << lookupCount << endl;
+
+    return elapsed.count() / static_cast<double>(lookupCount);
+}
+
+int main() {
+    KeyReader key;
+    key.load(makeKeyFile());
+
+    // Every fourth lookup is a miss, the rest use upper case ResRefs
+    vector<string> resRefs;
+    mt19937 random(0);
+    for (int i = 0; i < 4096; ++i) {
+        int idx = random() % (kKeyCount / 4);
+        resRefs.push_back(i % 4 == 0 ? "missing_" + to_string(idx) : boost::to_upper_copy(getResRef(idx)));
+    }
+
+    cout << "KEY entries: " << kKeyCount << endl;
+
+    cout << "Linear search:" << endl;
+    double linear = measure(kLinearLookupCount, resRefs, [&key](const string &resRef, ResourceType type) {
+        return findLinear(key, resRef, type) != nullptr;
+    });
+    cout << "  " << linear << " ns per lookup" << endl;
+
+    cout << "Hashed index:" << endl;
+    double hashed = measure(kHashedLookupCount, resRefs, [&key](const string &resRef, ResourceType type) {
+        return key.find(resRef, type) != nullptr;
+    });
+    cout << "  " << hashed << " ns per lookup" << endl;
+
+    cout << "Speedup: " << linear / hashed << "x" << endl;
+
+    return 0;
+}
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2020-2021 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Measures startup time and memory footprint of loading a synthetic
+ *  100k-entry TLK file, comparing the lazily decoded talktable with eager
+ *  decoding of every string, as TlkReader used to do.
+ */
+
+#include <chrono>
+
+#include "../engine/resource/format/tlkreader.h"
+#include "../engine/resource/format/tlkwriter.h"
+#include "../engine/resource/strings.h"
+
+using namespace std;
+
+using namespace reone::resource;
+
+namespace fs = boost::filesystem;
+
+static constexpr int kStringCount = 100000;
+static constexpr int kLookupCount = 1000000;
+
+static void writeTalkTable(const fs::path &path) {
+    auto table = make_shared<TalkTable>();
+    for (int i = 0; i < kStringCount; ++i) {
+        TalkTableString str;
+        str.text = "String number " + to_string(i) + " of the synthetic talktable, {developer note " + to_string(i) + "} long enough to not fit inline.";
+        if (i % 3 == 0) {
+            str.soundResRef = "n_sound_" + to_string(i);
+        }
+        table->addString(move(str));
+    }
+    TlkWriter writer(move(table));
+    writer.save(path);
+}
+
+/**
+ * @return heap memory held by the specified strings, excluding allocator overhead
+ */
+static size_t getHeapBytes(const vector<TalkTableString> &strings) {
+    static const size_t inlineCapacity = string().capacity();
+
+    size_t result = strings.capacity() * sizeof(TalkTableString);
+    for (auto &str : strings) {
+        for (const string *member : { &str.text, &str.soundResRef }) {
+            if (member->capacity() > inlineCapacity) {
+                result += member->capacity() + 1;
+            }
+        }
+    }
+    return result;
+}
+
+template <class Func>
+static double measureMs(Func func) {
+    auto start = chrono::steady_clock::now();
+    func();
+    auto elapsed = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start);
+    return elapsed.count() / 1000.0;
+}
+
+int main() {
+    fs::path path(fs::temp_directory_path() / fs::unique_path());
+    fs::create_directories(path);
+    writeTalkTable(path / "dialog.tlk");
+
+    cout << "TLK strings: " << kStringCount << endl;
+
+    {
+        Strings strings;
+        double loadMs = measureMs([&]() { strings.init(path); });
+        cout << "Lazy:" << endl;
+        cout << "  startup: " << loadMs << " ms" << endl;
+        cout << "  string memory: 0 KiB, strings are decoded from the mapped file on demand" << endl;
+
+        size_t length = 0;
+        double firstMs = measureMs([&]() {
+            for (int i = 0; i < kStringCount; ++i) {
+                length += strings.get(i).length();
+            }
+        });
+        double cachedMs = measureMs([&]() {
+            for (int i = 0; i < kLookupCount; ++i) {
+                length += strings.get(i % kStringCount).length();
+            }
+        });
+        cout << "  first lookup: " << 1e6 * firstMs / kStringCount << " ns per string" << endl;
+        cout << "  cached lookup: " << 1e6 * cachedMs / kLookupCount << " ns per string" << endl;
+    }
+    {
+        vector<TalkTableString> decoded;
+        double loadMs = measureMs([&]() {
+            TlkReader tlk;
+            tlk.load(path / "dialog.tlk");
+            shared_ptr<TalkTable> table(tlk.table());
+            decoded.reserve(table->getStringCount());
+            for (int i = 0; i < table->getStringCount(); ++i) {
+                decoded.push_back(TalkTableString { table->getText(i), table->getSoundResRef(i) });
+            }
+        });
+        cout << "Eager:" << endl;
+        cout << "  startup: " << loadMs << " ms" << endl;
+        cout << "  string memory: " << getHeapBytes(decoded) / 1024 << " KiB" << endl;
+    }
+
+    fs::remove_all(path);
+
+    return 0;
+}
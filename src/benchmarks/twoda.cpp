@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2020-2021 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Measures the cost of reverse lookups in a synthetic 10k-row 2DA table,
+ *  comparing the hash indexes of TwoDA with a linear scan over the rows.
+ */
+
+#include <chrono>
+
+#include "../engine/resource/2da.h"
+
+using namespace std;
+
+using namespace reone::resource;
+
+static constexpr int kRowCount = 10000;
+static constexpr int kIndexedLookupCount = 1000000;
+static constexpr int kLinearLookupCount = 2000;
+
+static unique_ptr<TwoDA> makeTwoDA() {
+    auto twoDa = make_unique<TwoDA>();
+    twoDa->addColumn("label");
+    twoDa->addColumn("race");
+    twoDa->addColumn("modeltype");
+    twoDa->addColumn("normalhead");
+
+    for (int i = 0; i < kRowCount; ++i) {
+        TwoDA::Row row;
+        row.values.push_back("label_" + to_string(i));
+        row.values.push_back("race_" + to_string(i % 100));
+        row.values.push_back(i % 2 == 0 ? "B" : "F");
+        row.values.push_back(to_string(i / 2));
+        twoDa->add(move(row));
+    }
+
+    return move(twoDa);
+}
+
+/**
+ * Reproduces the lookup algorithm, that TwoDA used prior to indexing.
+ */
+static int indexLinear(const TwoDA &twoDa, const vector<pair<string, string>> &values) {
+    vector<int> columnIndices;
+    for (auto &value : values) {
+        auto column = find(twoDa.columns().begin(), twoDa.columns().end(), value.first);
+        columnIndices.push_back(static_cast<int>(distance(twoDa.columns().begin(), column)));
+    }
+    for (int i = 0; i < twoDa.getRowCount(); ++i) {
+        bool match = true;
+        for (size_t j = 0; j < values.size(); ++j) {
+            if (twoDa.getCellValue(i, columnIndices[j]) != values[j].second) {
+                match = false;
+                break;
+            }
+        }
+        if (match) return i;
+    }
+    return -1;
+}
+
+template <class Index>
+static double measure(int lookupCount, const vector<vector<pair<string, string>>> &queries, Index index) {
+    int found = 0;
+    auto start = chrono::steady_clock::now();
+
+    for (int i = 0; i < lookupCount; ++i) {
+        if (index(queries[i % queries.size()]) != -1) {
+            ++found;
+        }
+    }
+
+    auto elapsed = chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start);
+    cout << "  found " << found << " of " << lookupCount << endl;
+
+    return elapsed.count() / static_cast<double>(lookupCount);
+}
+
+static void compare(const string &title, const TwoDA &twoDa, const vector<vector<pair<string, string>>> &queries) {
+    cout << title << ":" << endl;
+
+    double linear = measure(kLinearLookupCount, queries, [&twoDa](const vector<pair<string, string>> &values) {
+        return indexLinear(twoDa, values);
+    });
+    cout << "  linear scan: " << linear << " ns per lookup" << endl;
+
+    double indexed = measure(kIndexedLookupCount, queries, [&twoDa](const vector<pair<string, string>> &values) {
+        return values.size() == 1 ? twoDa.indexByCellValue(values[0].first, values[0].second) : twoDa.indexByCellValues(values);
+    });
+    cout << "  hash index: " << indexed << " ns per lookup" << endl;
+
+    cout << "  speedup: " << linear / indexed << "x" << endl;
+}
+
+int main() {
+    unique_ptr<TwoDA> twoDa(makeTwoDA());
+
+    // Every fourth lookup is a miss
+    vector<vector<pair<string, string>>> labelQueries;
+    vector<vector<pair<string, string>>> compositeQueries;
+    mt19937 random(0);
+    for (int i = 0; i < 4096; ++i) {
+        int row = random() % kRowCount;
+        bool miss = i % 4 == 0;
+        labelQueries.push_back({ { "label", miss ? "missing_" + to_string(row) : "label_" + to_string(row) } });
+        compositeQueries.push_back({ { "race", "race_" + to_string(row % 100) },
+                                     { "modeltype", row % 2 == 0 ? "B" : "F" },
+                                     { "normalhead", to_string(miss ? kRowCount + row : row / 2) } });
+    }
+
+    cout << "2DA rows: " << kRowCount << endl;
+    compare("Single column", *twoDa, labelQueries);
+    compare("Three columns", *twoDa, compositeQueries);
+
+    return 0;
+}
@@ -17,7 +17,7 @@
 
 #include "files.h"
 
-#include "../common/streamutil.h"
+#include "../common/stopwatch.h"
 
 #include "format/mp3reader.h"
 #include "format/wavreader.h"
@@ -32,25 +32,31 @@ namespace reone {
 namespace audio {
 
 AudioFiles::AudioFiles(Resources &resources) :
-    MemoryCache(bind(&AudioFiles::doGet, this, _1)),
+    MemoryCache(
+        bind(&AudioFiles::doGet, this, _1),
+        [&resources](const ResRef &resRef) { return resources.isTransient(resRef, ResourceType::Mp3) || resources.isTransient(resRef, ResourceType::Wav); }),
     _resources(resources) {
 }
 
-shared_ptr<AudioStream> AudioFiles::doGet(string resRef) {
+shared_ptr<AudioStream> AudioFiles::doGet(const ResRef &resRef) {
     shared_ptr<AudioStream> result;
 
-    shared_ptr<ByteArray> mp3Data(_resources.getRaw(resRef, ResourceType::Mp3, false));
+    ByteView mp3Data(_resources.getView(resRef, ResourceType::Mp3, false));
     if (mp3Data) {
+        Stopwatch stopwatch;
         Mp3Reader mp3;
-        mp3.load(wrap(mp3Data));
+        mp3.load(mp3Data.toArray());
         result = mp3.stream();
+        _resources.stats().recordDecode(ResourceType::Mp3, stopwatch.getElapsedTime());
     }
     if (!result) {
-        shared_ptr<ByteArray> wavData(_resources.getRaw(resRef, ResourceType::Wav));
+        ByteView wavData(_resources.getView(resRef, ResourceType::Wav));
         if (wavData) {
+            Stopwatch stopwatch;
             WavReader wav;
-            wav.load(wrap(wavData));
+            wav.load(wavData);
             result = wav.stream();
+            _resources.stats().recordDecode(ResourceType::Wav, stopwatch.getElapsedTime());
         }
     }
 
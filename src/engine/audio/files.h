@@ -26,14 +26,14 @@ namespace reone {
 
 namespace audio {
 
-class AudioFiles : public MemoryCache<std::string, AudioStream> {
+class AudioFiles : public MemoryCache<resource::ResRef, AudioStream> {
 public:
     AudioFiles(resource::Resources &resources);
 
 private:
     resource::Resources &_resources;
 
-    std::shared_ptr<AudioStream> doGet(std::string resRef);
+    std::shared_ptr<AudioStream> doGet(const resource::ResRef &resRef);
 };
 
 } // namespace audio
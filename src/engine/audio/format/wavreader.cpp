@@ -57,7 +57,7 @@ void WavReader::doLoad() {
 }
 
 bool WavReader::readChunkHeader(ChunkHeader &chunk) {
-    if (_reader->eof()) return false;
+    if (tell() + 8 > _size) return false;
 
     string id(readString(4));
     uint32_t size = readUint32();
@@ -94,7 +94,7 @@ void WavReader::loadFormat(ChunkHeader chunk) {
 void WavReader::loadData(ChunkHeader chunk) {
     if (chunk.size == 0) {
         size_t pos = tell();
-        ByteArray data(_reader->getBytes(static_cast<int>(_size - pos)));
+        ByteArray data(readBytes(static_cast<int>(_size - pos)));
 
         Mp3Reader mp3;
         mp3.load(move(data));
@@ -114,7 +114,7 @@ void WavReader::loadData(ChunkHeader chunk) {
 }
 
 void WavReader::loadPCM(uint32_t chunkSize) {
-    ByteArray data(_reader->getBytes(chunkSize));
+    ByteArray data(readChunkData(chunkSize));
 
     AudioStream::Frame frame;
     frame.format = getAudioFormat();
@@ -141,7 +141,7 @@ static constexpr int kIMAStepTable[] = {
 };
 
 void WavReader::loadIMAADPCM(uint32_t chunkSize) {
-    ByteArray chunk(_reader->getBytes(chunkSize));
+    ByteArray chunk(readChunkData(chunkSize));
 
     AudioStream::Frame frame;
     frame.format = getAudioFormat();
@@ -183,6 +183,17 @@ void WavReader::loadIMAADPCM(uint32_t chunkSize) {
     _stream->add(move(frame));
 }
 
+ByteArray WavReader::readChunkData(uint32_t chunkSize) {
+    // Chunk size may exceed the file size: pad the data with zeros
+    size_t pos = tell();
+    size_t available = pos < _size ? _size - pos : 0;
+
+    ByteArray data(readBytes(static_cast<int>(min<size_t>(chunkSize, available))));
+    data.resize(chunkSize);
+
+    return move(data);
+}
+
 AudioFormat WavReader::getAudioFormat() const {
     switch (_audioFormat) {
         case WavAudioFormat::PCM:
@@ -64,6 +64,7 @@ private:
     void loadIMAADPCM(uint32_t chunkSize);
     void loadPCM(uint32_t chunkSize);
     bool readChunkHeader(ChunkHeader &chunk);
+    ByteArray readChunkData(uint32_t chunkSize);
 
     AudioFormat getAudioFormat() const;
 };
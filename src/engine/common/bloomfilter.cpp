@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2020-2021 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "bloomfilter.h"
+
+using namespace std;
+
+namespace reone {
+
+static constexpr int kBitsPerHash = 10;
+
+void BloomFilter::reset(int count) {
+    size_t numBits = 64;
+    while (numBits < static_cast<size_t>(kBitsPerHash) * count) {
+        numBits *= 2;
+    }
+    _bits.assign(numBits / 64, 0);
+    _mask = static_cast<uint32_t>(numBits - 1);
+}
+
+void BloomFilter::add(uint32_t hash) {
+    if (_bits.empty()) {
+        throw logic_error("Bloom filter must be reset before adding hashes");
+    }
+    uint32_t step = getStep(hash);
+    for (int i = 0; i < kNumProbes; ++i) {
+        uint32_t bit = (hash + i * step) & _mask;
+        _bits[bit >> 6] |= 1ull << (bit & 63);
+    }
+}
+
+} // namespace reone
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2020-2021 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+namespace reone {
+
+/**
+ * Probabilistic set of 32-bit hashes. Answers whether a hash was possibly
+ * added, or was definitely not added, using about 10 bits per hash and a
+ * false positive rate of less than 1%.
+ */
+class BloomFilter {
+public:
+    /**
+     * Removes all hashes from this filter and resizes it to hold the
+     * specified number of hashes.
+     */
+    void reset(int count);
+
+    void add(uint32_t hash);
+
+    /**
+     * @return false if hash was definitely not added to this filter, true otherwise
+     */
+    inline bool mayContain(uint32_t hash) const {
+        if (_bits.empty()) return false;
+
+        uint32_t step = getStep(hash);
+        for (int i = 0; i < kNumProbes; ++i) {
+            uint32_t bit = (hash + i * step) & _mask;
+            if ((_bits[bit >> 6] & (1ull << (bit & 63))) == 0) return false;
+        }
+
+        return true;
+    }
+
+private:
+    static constexpr int kNumProbes = 7;
+
+    std::vector<uint64_t> _bits;
+    uint32_t _mask { 0 };
+
+    /**
+     * @return odd step between probes, derived from the hash by a mixing function
+     */
+    static inline uint32_t getStep(uint32_t hash) {
+        hash ^= hash >> 16;
+        hash *= 0x85ebca6bu;
+        hash ^= hash >> 13;
+        hash *= 0xc2b2ae35u;
+        hash ^= hash >> 16;
+        return hash | 1;
+    }
+};
+
+} // namespace reone
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2020-2021 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "types.h"
+
+namespace reone {
+
+/**
+ * Immutable, reference-counted view of a contiguous range of bytes. Keeps the
+ * owner of the bytes, e.g. a memory-mapped file or a byte array, alive for as
+ * long as the view exists. A default-constructed view has no owner and
+ * evaluates to false.
+ */
+class ByteView {
+public:
+    ByteView() = default;
+
+    ByteView(std::shared_ptr<const void> owner, const char *data, size_t size) :
+        _owner(std::move(owner)),
+        _data(data),
+        _size(size) {
+    }
+
+    /**
+     * Constructs a view of the whole byte array, taking shared ownership of it.
+     */
+    explicit ByteView(std::shared_ptr<ByteArray> arr) :
+        _data(arr ? arr->data() : nullptr),
+        _size(arr ? arr->size() : 0) {
+
+        _owner = std::move(arr);
+    }
+
+    /**
+     * @return view of a subrange of this view, sharing its owner
+     * @throws std::out_of_range if the subrange exceeds this view
+     */
+    ByteView slice(size_t off, size_t size) const {
+        if (off > _size || size > _size - off) {
+            throw std::out_of_range("ByteView: slice out of range");
+        }
+        return ByteView(_owner, _data + off, size);
+    }
+
+    /**
+     * @return copy of the viewed bytes
+     */
+    ByteArray toArray() const {
+        return ByteArray(_data, _data + _size);
+    }
+
+    explicit operator bool() const { return static_cast<bool>(_owner); }
+
+    bool empty() const { return _size == 0; }
+
+    const char *data() const { return _data; }
+    size_t size() const { return _size; }
+
+    const char *begin() const { return _data; }
+    const char *end() const { return _data + _size; }
+
+private:
+    std::shared_ptr<const void> _owner;
+    const char *_data { nullptr };
+    size_t _size { 0 };
+};
+
+} // namespace reone
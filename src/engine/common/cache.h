@@ -21,13 +21,137 @@
 
 namespace reone {
 
+/**
+ * Cache of objects, that survives module transitions. Objects remember the
+ * generation, in which they were last used. beginGeneration evicts objects,
+ * that are no longer needed:
+ *
+ * - null objects, i.e. not found previously, as they may be found now
+ * - objects, that the isTransient predicate reports as specific to a module,
+ *   either when inserted or at the start of the new generation
+ * - objects, that are referenced only by this cache and were not used in the
+ *   last maxAge generations or exceed the cost budget, oldest first
+ */
+template <class K, class V>
+class GenerationalCache : boost::noncopyable {
+public:
+    struct Policy {
+        int maxAge { 0 }; /**< unreferenced objects, not used in this many previous generations, are evicted */
+        size_t budget { 0 }; /**< total cost of retained unreferenced objects, 0 for unlimited */
+    };
+
+    /**
+     * @param isTransient predicate, that tells whether an object is specific to the current module, may be empty
+     * @param getCost function, that estimates the cost of retaining an object, may be empty if budget is not used
+     */
+    GenerationalCache(
+        std::function<bool(const K &)> isTransient = nullptr,
+        std::function<size_t(const V &)> getCost = nullptr
+    ) :
+        _isTransient(std::move(isTransient)),
+        _getCost(std::move(getCost)) {
+    }
+
+    bool find(const K &key, std::shared_ptr<V> &object) {
+        auto maybeEntry = _entries.find(key);
+        if (maybeEntry == _entries.end()) return false;
+
+        maybeEntry->second.generation = _generation;
+        object = maybeEntry->second.object;
+
+        return true;
+    }
+
+    const std::shared_ptr<V> &insert(const K &key, std::shared_ptr<V> object) {
+        Entry entry;
+        entry.object = std::move(object);
+        entry.generation = _generation;
+        entry.transient = _isTransient && _isTransient(key);
+
+        return _entries.insert(std::make_pair(key, std::move(entry))).first->second.object;
+    }
+
+    void clear() {
+        _entries.clear();
+    }
+
+    void beginGeneration(const Policy &policy) {
+        ++_generation;
+
+        std::vector<std::pair<int, K>> retained; // generation and key of retained unreferenced objects
+        size_t retainedCost = 0;
+
+        for (auto it = _entries.begin(); it != _entries.end();) {
+            Entry &entry = it->second;
+            bool evict = false;
+
+            if (!entry.object || entry.transient || (_isTransient && _isTransient(it->first))) {
+                evict = true;
+            } else if (entry.object.use_count() > 1) {
+                // Referenced objects are in use in the generation that has just ended
+                entry.generation = _generation - 1;
+            } else if (_generation - entry.generation > policy.maxAge) {
+                evict = true;
+            } else if (policy.budget > 0 && _getCost) {
+                retained.push_back(std::make_pair(entry.generation, it->first));
+                retainedCost += _getCost(*entry.object);
+            }
+
+            if (evict) {
+                it = _entries.erase(it);
+            } else {
+                ++it;
+            }
+        }
+
+        if (retainedCost > policy.budget) {
+            std::stable_sort(retained.begin(), retained.end(), [](auto &left, auto &right) { return left.first < right.first; });
+            for (auto &key : retained) {
+                if (retainedCost <= policy.budget) break;
+                auto maybeEntry = _entries.find(key.second);
+                retainedCost -= _getCost(*maybeEntry->second.object);
+                _entries.erase(maybeEntry);
+            }
+        }
+    }
+
+    template <class Fn>
+    void forEach(Fn fn) const {
+        for (auto &entry : _entries) {
+            fn(entry.first, entry.second.object);
+        }
+    }
+
+    size_t size() const { return _entries.size(); }
+
+private:
+    struct Entry {
+        std::shared_ptr<V> object;
+        int generation { 0 }; /**< generation, in which the object was last used */
+        bool transient { false }; /**< was the object specific to a module when inserted? */
+    };
+
+    std::function<bool(const K &)> _isTransient;
+    std::function<size_t(const V &)> _getCost;
+
+    std::unordered_map<K, Entry> _entries;
+    int _generation { 0 };
+};
+
 /**
  * Utility class for caching objects. Takes a function which computes an object by key.
  */
 template <class K, class V>
 class MemoryCache : boost::noncopyable {
 public:
-    MemoryCache(std::function<std::shared_ptr<V>(K)> compute) : _compute(compute) {
+    /**
+     * @param compute function, that computes an object by key
+     * @param isTransient predicate, that tells whether an object is specific to the current module, may be empty
+     */
+    MemoryCache(std::function<std::shared_ptr<V>(K)> compute, std::function<bool(const K &)> isTransient = nullptr) :
+        _compute(compute),
+        _objects(std::move(isTransient)) {
+
         ensureNotNull(compute, "compute");
     }
 
@@ -35,19 +159,28 @@ public:
         _objects.clear();
     }
 
-    std::shared_ptr<V> get(K key) {
-        auto maybeObject = _objects.find(key);
-        if (maybeObject != _objects.end()) return maybeObject->second;
+    /**
+     * Evicts objects, that are no longer needed, e.g. on module transition.
+     *
+     * @see GenerationalCache
+     */
+    void beginGeneration(int maxAge) {
+        typename GenerationalCache<K, V>::Policy policy;
+        policy.maxAge = maxAge;
+        _objects.beginGeneration(policy);
+    }
 
-        auto object = _compute(key);
+    std::shared_ptr<V> get(K key) {
+        std::shared_ptr<V> object;
+        if (_objects.find(key, object)) return std::move(object);
 
-        return _objects.insert(make_pair(key, move(object))).first->second;
+        return _objects.insert(key, _compute(key));
     }
 
 private:
     std::function<std::shared_ptr<V>(K)> _compute;
 
-    std::unordered_map<K, std::shared_ptr<V>> _objects;
+    GenerationalCache<K, V> _objects;
 };
 
 } // namespace reone
@@ -37,6 +37,7 @@ static int g_debugChannels = DebugChannels::all;
 static bool g_logToFile = false;
 
 static std::unique_ptr<fs::ofstream> g_logFile;
+static std::mutex g_logMutex;
 
 static constexpr char *describeLogLevel(LogLevel level) {
     switch (level) {
@@ -59,6 +60,8 @@ static void log(ostream &out, LogLevel level, const string &s) {
 }
 
 static void log(LogLevel level, const string &s) {
+    lock_guard<mutex> lock(g_logMutex);
+
     if (g_logToFile && !g_logFile) {
         fs::path path(fs::current_path());
         path.append(kLogFilename);
@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2020-2021 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+namespace reone {
+
+struct CacheStats {
+    size_t hits { 0 };
+    size_t misses { 0 };
+    size_t evictions { 0 };
+    size_t bytes { 0 }; /**< estimated size of all cached objects */
+    size_t count { 0 };
+};
+
+/**
+ * Cache with a byte budget and least-recently-used eviction. Size of each
+ * object is estimated by the caller.
+ *
+ * Pinned objects are never evicted and survive invalidation, but count
+ * against the budget.
+ */
+template <class K, class V>
+class LruCache : boost::noncopyable {
+public:
+    struct Entry {
+        K key;
+        V value;
+        size_t bytes { 0 };
+        bool pinned { false };
+    };
+
+    /**
+     * @param budget maximum total size of cached objects in bytes, 0 for unlimited
+     */
+    LruCache(size_t budget = 0) : _budget(budget) {
+    }
+
+    /**
+     * Marks an object as recently used and counts a hit if found, counts a
+     * miss otherwise.
+     *
+     * @return cached entry, or nullptr if not found
+     */
+    const Entry *find(const K &key) {
+        auto maybeEntry = _entries.find(key);
+        if (maybeEntry == _entries.end()) {
+            ++_stats.misses;
+            return nullptr;
+        }
+        ++_stats.hits;
+        _lru.splice(_lru.begin(), _lru, maybeEntry->second);
+
+        return &*maybeEntry->second;
+    }
+
+    /**
+     * Caches an object, replacing an existing object with the same key, and
+     * evicts least recently used objects until the budget is satisfied. An
+     * object larger than the budget is evicted immediately.
+     */
+    void put(K key, V value, size_t bytes, bool pinned = false) {
+        remove(key);
+
+        _lru.push_front(Entry { key, std::move(value), bytes, pinned });
+        _entries.insert(std::make_pair(std::move(key), _lru.begin()));
+
+        _stats.bytes += bytes;
+        _stats.count = _entries.size();
+
+        evict();
+    }
+
+    void remove(const K &key) {
+        auto maybeEntry = _entries.find(key);
+        if (maybeEntry == _entries.end()) return;
+
+        erase(maybeEntry->second);
+    }
+
+    /**
+     * Removes all entries, pinned or not, that satisfy the predicate.
+     */
+    template <class Pred>
+    void removeIf(Pred pred) {
+        for (auto it = _lru.begin(); it != _lru.end();) {
+            if (pred(*it)) {
+                it = erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    /**
+     * Removes all entries, except pinned.
+     */
+    void invalidate() {
+        removeIf([](auto &entry) { return !entry.pinned; });
+    }
+
+    void pin(const K &key) {
+        setPinned(key, true);
+    }
+
+    void unpin(const K &key) {
+        setPinned(key, false);
+        evict();
+    }
+
+    bool contains(const K &key) const {
+        return _entries.count(key) > 0;
+    }
+
+    const CacheStats &stats() const { return _stats; }
+
+    void setBudget(size_t budget) {
+        _budget = budget;
+        evict();
+    }
+
+private:
+    typedef typename std::list<Entry>::iterator EntryIterator;
+
+    size_t _budget;
+
+    std::list<Entry> _lru; /**< most recently used entries go first */
+    std::unordered_map<K, EntryIterator> _entries;
+    CacheStats _stats;
+
+    EntryIterator erase(EntryIterator it) {
+        _stats.bytes -= it->bytes;
+        _entries.erase(it->key);
+        _stats.count = _entries.size();
+
+        return _lru.erase(it);
+    }
+
+    void evict() {
+        if (_budget == 0) return;
+
+        for (auto it = _lru.end(); _stats.bytes > _budget && it != _lru.begin();) {
+            --it;
+            if (it->pinned) continue;
+
+            it = erase(it);
+            ++_stats.evictions;
+        }
+    }
+
+    void setPinned(const K &key, bool pinned) {
+        auto maybeEntry = _entries.find(key);
+        if (maybeEntry != _entries.end()) {
+            maybeEntry->second->pinned = pinned;
+        }
+    }
+};
+
+} // namespace reone
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2020-2021 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "lz4codec.h"
+
+using namespace std;
+
+namespace reone {
+
+static constexpr int kMinMatch = 4;
+static constexpr int kLastLiterals = 5; /**< the last 5 bytes of a block are always literals */
+static constexpr int kMatchSafeDistance = 12; /**< the last match must start at least 12 bytes before the end of a block */
+static constexpr int kMaxOffset = 65535;
+static constexpr int kHashBits = 12;
+
+static inline uint32_t read32(const char *data) {
+    uint32_t result;
+    memcpy(&result, data, sizeof(result));
+    return result;
+}
+
+static inline uint32_t hashSequence(uint32_t sequence) {
+    return (sequence * 2654435761u) >> (32 - kHashBits);
+}
+
+static void putLength(ByteArray &out, size_t length) {
+    for (; length >= 255; length -= 255) {
+        out.push_back(static_cast<char>(255));
+    }
+    out.push_back(static_cast<char>(length));
+}
+
+static void putSequence(ByteArray &out, const char *literals, size_t literalCount, size_t offset, size_t matchLength) {
+    size_t matchCode = matchLength - kMinMatch;
+    auto token = static_cast<uint8_t>((min<size_t>(literalCount, 15) << 4) | min<size_t>(matchCode, 15));
+    out.push_back(static_cast<char>(token));
+
+    if (literalCount >= 15) {
+        putLength(out, literalCount - 15);
+    }
+    out.insert(out.end(), literals, literals + literalCount);
+
+    out.push_back(static_cast<char>(offset & 0xff));
+    out.push_back(static_cast<char>(offset >> 8));
+
+    if (matchCode >= 15) {
+        putLength(out, matchCode - 15);
+    }
+}
+
+static void putLastLiterals(ByteArray &out, const char *literals, size_t literalCount) {
+    out.push_back(static_cast<char>(min<size_t>(literalCount, 15) << 4));
+    if (literalCount >= 15) {
+        putLength(out, literalCount - 15);
+    }
+    out.insert(out.end(), literals, literals + literalCount);
+}
+
+ByteArray compressLZ4(const char *data, size_t size) {
+    ByteArray result;
+    result.reserve(size / 2 + 16);
+
+    size_t anchor = 0;
+    if (size > kMatchSafeDistance) {
+        vector<int64_t> table(1 << kHashBits, -1);
+        size_t matchLimit = size - kMatchSafeDistance;
+        size_t matchEndLimit = size - kLastLiterals;
+
+        for (size_t pos = 0; pos < matchLimit;) {
+            uint32_t sequence = read32(data + pos);
+            uint32_t hash = hashSequence(sequence);
+            int64_t candidate = table[hash];
+            table[hash] = static_cast<int64_t>(pos);
+
+            if (candidate < 0 || pos - candidate > kMaxOffset || read32(data + candidate) != sequence) {
+                ++pos;
+                continue;
+            }
+            size_t matchLength = kMinMatch;
+            while (pos + matchLength < matchEndLimit && data[candidate + matchLength] == data[pos + matchLength]) {
+                ++matchLength;
+            }
+            putSequence(result, data + anchor, pos - anchor, pos - candidate, matchLength);
+            pos += matchLength;
+            anchor = pos;
+        }
+    }
+    putLastLiterals(result, data + anchor, size - anchor);
+
+    return move(result);
+}
+
+static size_t getLength(const uint8_t *&in, const uint8_t *inEnd, size_t length) {
+    if (length != 15) return length;
+
+    uint8_t byte;
+    do {
+        if (in == inEnd) {
+            throw runtime_error("LZ4: unexpected end of block");
+        }
+        byte = *in++;
+        length += byte;
+    } while (byte == 255);
+
+    return length;
+}
+
+void decompressLZ4(const char *data, size_t size, char *dest, size_t destSize) {
+    auto in = reinterpret_cast<const uint8_t *>(data);
+    const uint8_t *inEnd = in + size;
+    char *out = dest;
+    char *outEnd = dest + destSize;
+
+    while (in < inEnd) {
+        uint8_t token = *in++;
+
+        size_t literalCount = getLength(in, inEnd, token >> 4);
+        if (literalCount > static_cast<size_t>(inEnd - in) || literalCount > static_cast<size_t>(outEnd - out)) {
+            throw runtime_error("LZ4: literals out of range");
+        }
+        memcpy(out, in, literalCount);
+        in += literalCount;
+        out += literalCount;
+
+        if (in == inEnd) break; // last sequence has no match
+
+        if (inEnd - in < 2) {
+            throw runtime_error("LZ4: unexpected end of block");
+        }
+        size_t offset = in[0] | (in[1] << 8);
+        in += 2;
+        if (offset == 0 || offset > static_cast<size_t>(out - dest)) {
+            throw runtime_error("LZ4: match offset out of range");
+        }
+
+        size_t matchLength = getLength(in, inEnd, token & 0xf) + kMinMatch;
+        if (matchLength > static_cast<size_t>(outEnd - out)) {
+            throw runtime_error("LZ4: match out of range");
+        }
+
+        // Matches may overlap the bytes being written, so copy byte by byte
+        const char *match = out - offset;
+        for (size_t i = 0; i < matchLength; ++i) {
+            out[i] = match[i];
+        }
+        out += matchLength;
+    }
+
+    if (out != outEnd) {
+        throw runtime_error("LZ4: decompressed size mismatch");
+    }
+}
+
+} // namespace reone
@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2020-2021 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "types.h"
+
+namespace reone {
+
+/**
+ * Compresses data into a single LZ4 block, as specified by the LZ4 block
+ * format. Uses a greedy single-pass matcher, that favours speed over ratio.
+ *
+ * @return compressed block, that may be larger than the input if it is incompressible
+ */
+ByteArray compressLZ4(const char *data, size_t size);
+
+/**
+ * Decompresses a single LZ4 block, validating it against the compressed and
+ * decompressed sizes.
+ *
+ * @param destSize exact size of the decompressed data
+ * @throws std::runtime_error if the block is malformed
+ */
+void decompressLZ4(const char *data, size_t size, char *dest, size_t destSize);
+
+} // namespace reone
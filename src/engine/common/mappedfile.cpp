@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2020-2021 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "mappedfile.h"
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+using namespace std;
+
+namespace fs = boost::filesystem;
+namespace ipc = boost::interprocess;
+
+namespace reone {
+
+MappedFile::MappedFile(const fs::path &path) {
+    uintmax_t fileSize = fs::file_size(path);
+    if (fileSize == 0) {
+        throw runtime_error("Cannot map an empty file: " + path.string());
+    }
+    if (fileSize > numeric_limits<size_t>::max()) {
+        throw runtime_error("File is too large to be mapped: " + path.string());
+    }
+    try {
+        _mapping = make_unique<ipc::file_mapping>(path.string().c_str(), ipc::read_only);
+        _region = make_unique<ipc::mapped_region>(*_mapping, ipc::read_only, 0, static_cast<size_t>(fileSize));
+    } catch (const ipc::interprocess_exception &e) {
+        throw runtime_error(str(boost::format("Cannot map file %s: %s") % path % e.what()));
+    }
+    _data = static_cast<const char *>(_region->get_address());
+    _size = _region->get_size();
+}
+
+MappedFile::~MappedFile() {
+}
+
+} // namespace reone
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2020-2021 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+namespace boost {
+
+namespace interprocess {
+
+class file_mapping;
+class mapped_region;
+
+} // namespace interprocess
+
+} // namespace boost
+
+namespace reone {
+
+/**
+ * Read-only memory mapping of a file. The whole file is mapped on construction
+ * and stays mapped for the lifetime of the instance.
+ */
+class MappedFile : boost::noncopyable {
+public:
+    /**
+     * @throws std::runtime_error if the file cannot be mapped
+     */
+    MappedFile(const boost::filesystem::path &path);
+    ~MappedFile();
+
+    const char *data() const { return _data; }
+    size_t size() const { return _size; }
+
+private:
+    std::unique_ptr<boost::interprocess::file_mapping> _mapping;
+    std::unique_ptr<boost::interprocess::mapped_region> _region;
+    const char *_data { nullptr };
+    size_t _size { 0 };
+};
+
+} // namespace reone
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2020-2021 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "memoryreader.h"
+
+using namespace std;
+
+namespace endian = boost::endian;
+
+namespace reone {
+
+MemoryReader::MemoryReader(const char *data, size_t size, endian::order endianess) :
+    _data(data),
+    _size(size),
+    _endianess(endianess) {
+}
+
+string MemoryReader::getCString() {
+    string result(getCString(_pos));
+    _pos += result.size() + 1;
+    return move(result);
+}
+
+string MemoryReader::getString(int len) {
+    string result(getString(_pos, len));
+    _pos += len;
+    return move(result);
+}
+
+ByteArray MemoryReader::getBytes(int count) {
+    ByteArray result(getBytes(_pos, count));
+    _pos += count;
+    return move(result);
+}
+
+vector<uint16_t> MemoryReader::getUint16Array(int count) {
+    vector<uint16_t> result(getArray<uint16_t>(_pos, count));
+    _pos += 2ll * count;
+    return move(result);
+}
+
+vector<uint32_t> MemoryReader::getUint32Array(int count) {
+    vector<uint32_t> result(getArray<uint32_t>(_pos, count));
+    _pos += 4ll * count;
+    return move(result);
+}
+
+vector<float> MemoryReader::getFloatArray(int count) {
+    vector<float> result(getArray<float>(_pos, count));
+    _pos += 4ll * count;
+    return move(result);
+}
+
+string MemoryReader::getCString(size_t off) const {
+    const char *begin = data(off, 0);
+    const char *end = _data + _size;
+    return string(begin, find(begin, end, '\0'));
+}
+
+string MemoryReader::getCString(size_t off, int len) const {
+    const char *begin = data(off, len);
+    return string(begin, find(begin, begin + len, '\0'));
+}
+
+string MemoryReader::getString(size_t off, int len) const {
+    return string(data(off, len), len);
+}
+
+ByteArray MemoryReader::getBytes(size_t off, int count) const {
+    const char *begin = data(off, count);
+    return ByteArray(begin, begin + count);
+}
+
+vector<uint32_t> MemoryReader::getUint32Array(size_t off, int count) const {
+    return getArray<uint32_t>(off, count);
+}
+
+vector<float> MemoryReader::getFloatArray(size_t off, int count) const {
+    return getArray<float>(off, count);
+}
+
+template <class T>
+vector<T> MemoryReader::getArray(size_t off, int count) const {
+    if (count < 0) {
+        throw invalid_argument("count must not be negative");
+    }
+    vector<T> result(count);
+    if (count == 0) return move(result);
+
+    memcpy(&result[0], data(off, sizeof(T) * count), sizeof(T) * count);
+    if (_endianess != endian::order::native) {
+        for (auto &val : result) {
+            swapBytes(val);
+        }
+    }
+
+    return move(result);
+}
+
+void MemoryReader::throwOutOfRange(size_t off, size_t count) const {
+    throw out_of_range(str(boost::format("Read out of bounds: offset %d, count %d, size %d") % off % count % _size));
+}
+
+} // namespace reone
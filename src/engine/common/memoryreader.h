@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2020-2021 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "types.h"
+
+namespace reone {
+
+/**
+ * Reads binary data from a contiguous block of memory. Unlike StreamReader,
+ * reads are plain memory accesses and are bounds-checked: an attempt to read
+ * past the end of the block throws std::out_of_range. Offset-addressed reads
+ * do not change the current position.
+ *
+ * Does not own the memory block, which must outlive the reader.
+ */
+class MemoryReader : boost::noncopyable {
+public:
+    MemoryReader(const char *data, size_t size, boost::endian::order endianess = boost::endian::order::little);
+
+    size_t tell() const { return _pos; }
+
+    /**
+     * Positions past the end of the block are allowed, but subsequent reads
+     * will throw.
+     */
+    void seek(size_t pos) { _pos = pos; }
+
+    void ignore(int count) { _pos += count; }
+
+    uint8_t getByte() { return getAndAdvance<uint8_t>(); }
+    uint16_t getUint16() { return getAndAdvance<uint16_t>(); }
+    uint32_t getUint32() { return getAndAdvance<uint32_t>(); }
+    uint64_t getUint64() { return getAndAdvance<uint64_t>(); }
+    int16_t getInt16() { return getAndAdvance<int16_t>(); }
+    int32_t getInt32() { return getAndAdvance<int32_t>(); }
+    int64_t getInt64() { return getAndAdvance<int64_t>(); }
+    float getFloat() { return getAndAdvance<float>(); }
+    double getDouble() { return getAndAdvance<double>(); }
+
+    std::string getCString();
+    std::string getString(int len);
+    ByteArray getBytes(int count);
+
+    std::vector<uint16_t> getUint16Array(int count);
+    std::vector<uint32_t> getUint32Array(int count);
+    std::vector<float> getFloatArray(int count);
+
+    // Offset-addressed reads
+
+    uint8_t getByte(size_t off) const { return get<uint8_t>(off); }
+    uint16_t getUint16(size_t off) const { return get<uint16_t>(off); }
+    uint32_t getUint32(size_t off) const { return get<uint32_t>(off); }
+    int32_t getInt32(size_t off) const { return get<int32_t>(off); }
+    float getFloat(size_t off) const { return get<float>(off); }
+
+    std::string getCString(size_t off) const;
+    std::string getCString(size_t off, int len) const;
+    std::string getString(size_t off, int len) const;
+    ByteArray getBytes(size_t off, int count) const;
+
+    std::vector<uint32_t> getUint32Array(size_t off, int count) const;
+    std::vector<float> getFloatArray(size_t off, int count) const;
+
+    // END Offset-addressed reads
+
+    /**
+     * @return pointer to count bytes of memory at the specified offset
+     * @throws std::out_of_range if the range exceeds the memory block
+     */
+    inline const char *data(size_t off, size_t count) const {
+        if (off > _size || count > _size - off) {
+            throwOutOfRange(off, count);
+        }
+        return _data + off;
+    }
+
+    size_t size() const { return _size; }
+
+private:
+    const char *_data;
+    size_t _size;
+    boost::endian::order _endianess;
+
+    size_t _pos { 0 };
+
+    template <class T>
+    inline T get(size_t off) const {
+        T val;
+        memcpy(&val, data(off, sizeof(T)), sizeof(T));
+        if (_endianess != boost::endian::order::native) {
+            swapBytes(val);
+        }
+        return val;
+    }
+
+    template <class T>
+    inline T getAndAdvance() {
+        T val(get<T>(_pos));
+        _pos += sizeof(T);
+        return val;
+    }
+
+    template <class T>
+    static inline void swapBytes(T &val) {
+        char *bytes = reinterpret_cast<char *>(&val);
+        std::reverse(bytes, bytes + sizeof(T));
+    }
+
+    template <class T>
+    std::vector<T> getArray(size_t off, int count) const;
+
+    void throwOutOfRange(size_t off, size_t count) const;
+};
+
+} // namespace reone
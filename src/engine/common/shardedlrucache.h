@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2020-2021 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "lrucache.h"
+
+namespace reone {
+
+/**
+ * Thread-safe LruCache, that is split into independently locked shards, so
+ * that concurrent lookups of different keys rarely contend. Each shard gets
+ * an equal part of the byte budget.
+ *
+ * Values are copied out of the cache, so that they remain valid after the
+ * shard is unlocked.
+ */
+template <class K, class V>
+class ShardedLruCache : boost::noncopyable {
+public:
+    typedef typename LruCache<K, V>::Entry Entry;
+
+    static constexpr int kShardBits = 4;
+    static constexpr int kNumShards = 1 << kShardBits;
+
+    /**
+     * @param budget maximum total size of cached objects in bytes, 0 for unlimited
+     */
+    ShardedLruCache(size_t budget = 0) {
+        setBudget(budget);
+    }
+
+    /**
+     * @return true if the object is found, false otherwise
+     */
+    bool find(const K &key, V &value) {
+        Shard &shard = getShard(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+
+        const Entry *entry = shard.cache.find(key);
+        if (!entry) return false;
+
+        value = entry->value;
+        return true;
+    }
+
+    void put(K key, V value, size_t bytes, bool pinned = false) {
+        Shard &shard = getShard(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.cache.put(std::move(key), std::move(value), bytes, pinned);
+    }
+
+    void remove(const K &key) {
+        Shard &shard = getShard(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.cache.remove(key);
+    }
+
+    /**
+     * Removes all entries, pinned or not, that satisfy the predicate. The
+     * predicate is called with a shard locked.
+     */
+    template <class Pred>
+    void removeIf(Pred pred) {
+        for (auto &shard : _shards) {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            shard.cache.removeIf(pred);
+        }
+    }
+
+    /**
+     * Removes all entries, except pinned.
+     */
+    void invalidate() {
+        for (auto &shard : _shards) {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            shard.cache.invalidate();
+        }
+    }
+
+    void pin(const K &key) {
+        Shard &shard = getShard(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.cache.pin(key);
+    }
+
+    void unpin(const K &key) {
+        Shard &shard = getShard(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.cache.unpin(key);
+    }
+
+    bool contains(const K &key) const {
+        const Shard &shard = getShard(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        return shard.cache.contains(key);
+    }
+
+    /**
+     * @return statistics summed over all shards
+     */
+    CacheStats stats() const {
+        CacheStats result;
+        for (auto &shard : _shards) {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            const CacheStats &stats = shard.cache.stats();
+            result.hits += stats.hits;
+            result.misses += stats.misses;
+            result.evictions += stats.evictions;
+            result.bytes += stats.bytes;
+            result.count += stats.count;
+        }
+        return std::move(result);
+    }
+
+    void setBudget(size_t budget) {
+        // Zero budget means unlimited, so a non-zero budget must not round down to it
+        size_t shardBudget = budget > 0 ? std::max<size_t>(1, budget / kNumShards) : 0;
+
+        for (auto &shard : _shards) {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            shard.cache.setBudget(shardBudget);
+        }
+    }
+
+private:
+    struct Shard {
+        mutable std::mutex mutex;
+        LruCache<K, V> cache;
+    };
+
+    Shard _shards[kNumShards];
+
+    inline Shard &getShard(const K &key) {
+        return _shards[getShardIndex(key)];
+    }
+
+    inline const Shard &getShard(const K &key) const {
+        return _shards[getShardIndex(key)];
+    }
+
+    static inline size_t getShardIndex(const K &key) {
+        // Hash tables within shards use low bits of the hash, so pick a shard by mixed high bits
+        uint32_t hash = static_cast<uint32_t>(std::hash<K>()(key));
+        return (hash * 2654435761u) >> (32 - kShardBits);
+    }
+};
+
+} // namespace reone
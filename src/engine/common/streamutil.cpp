@@ -28,4 +28,9 @@ unique_ptr<istream> wrap(const ByteArray &arr) {
     return make_unique<io::stream<io::array_source>>(source);
 }
 
+unique_ptr<istream> wrap(const ByteView &view) {
+    io::array_source source(view.data(), view.size());
+    return make_unique<io::stream<io::array_source>>(source);
+}
+
 } // namespace reone
@@ -20,6 +20,7 @@
 #include <istream>
 #include <memory>
 
+#include "byteview.h"
 #include "types.h"
 
 namespace reone {
@@ -30,6 +31,12 @@ inline std::unique_ptr<std::istream> wrap(const std::shared_ptr<ByteArray> &arr)
     return wrap(*arr.get());
 }
 
+/**
+ * Note that the returned stream does not take ownership of the viewed bytes,
+ * i.e. the view must outlive the stream.
+ */
+std::unique_ptr<std::istream> wrap(const ByteView &view);
+
 ByteArray unwrap(std::ostream);
 
 } // namespace reone
@@ -54,6 +54,10 @@ void StreamWriter::putInt64(int64_t val) {
     put(val);
 }
 
+void StreamWriter::putUint64(uint64_t val) {
+    put(val);
+}
+
 void StreamWriter::putFloat(float val) {
     put(*reinterpret_cast<uint32_t *>(&val));
 }
@@ -72,6 +76,10 @@ void StreamWriter::putBytes(const ByteArray &bytes) {
     _stream->write(&bytes[0], bytes.size());
 }
 
+void StreamWriter::putBytes(const ByteView &bytes) {
+    _stream->write(bytes.data(), bytes.size());
+}
+
 void StreamWriter::putBytes(int count, uint8_t val) {
     ByteArray data(count, val);
     _stream->write(&data[0], count);
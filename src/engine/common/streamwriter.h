@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include "byteview.h"
 #include "types.h"
 
 namespace reone {
@@ -31,10 +32,12 @@ public:
     void putUint32(uint32_t val);
     void putInt32(int32_t val);
     void putInt64(int64_t val);
+    void putUint64(uint64_t val);
     void putFloat(float val);
     void putString(const std::string &str);
     void putCString(const std::string &str);
     void putBytes(const ByteArray &bytes);
+    void putBytes(const ByteView &bytes);
     void putBytes(int count, uint8_t val = 0);
 
     size_t tell() const;
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2020-2021 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "threadpool.h"
+
+#include "log.h"
+
+using namespace std;
+
+namespace reone {
+
+ThreadPool::ThreadPool(int numThreads) {
+    if (numThreads < 1) {
+        throw invalid_argument("numThreads must be positive");
+    }
+    for (int i = 0; i < numThreads; ++i) {
+        _threads.push_back(thread(bind(&ThreadPool::threadStart, this)));
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        lock_guard<mutex> lock(_mutex);
+        _stopping = true;
+    }
+    _condition.notify_all();
+
+    for (auto &thread : _threads) {
+        thread.join();
+    }
+}
+
+void ThreadPool::enqueue(function<void()> task, int priority) {
+    {
+        lock_guard<mutex> lock(_mutex);
+        Task queued;
+        queued.priority = priority;
+        queued.seq = _nextSeq++;
+        queued.fn = move(task);
+        _tasks.push(move(queued));
+    }
+    _condition.notify_one();
+}
+
+size_t ThreadPool::pendingCount() const {
+    lock_guard<mutex> lock(_mutex);
+    return _tasks.size();
+}
+
+void ThreadPool::threadStart() {
+    while (true) {
+        function<void()> fn;
+        {
+            unique_lock<mutex> lock(_mutex);
+            _condition.wait(lock, [this]() { return _stopping || !_tasks.empty(); });
+            if (_tasks.empty()) return;
+
+            // priority_queue only exposes a const reference to the top element
+            fn = move(const_cast<Task &>(_tasks.top()).fn);
+            _tasks.pop();
+        }
+        try {
+            fn();
+        } catch (const exception &e) {
+            warn("Task failed: " + string(e.what()));
+        }
+    }
+}
+
+} // namespace reone
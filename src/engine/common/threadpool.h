@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2020-2021 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+namespace reone {
+
+/**
+ * Fixed-size pool of worker threads. Tasks of higher priority run first,
+ * tasks of the same priority run in the order of submission.
+ *
+ * Exceptions, thrown by tasks, are logged and otherwise ignored.
+ */
+class ThreadPool : boost::noncopyable {
+public:
+    ThreadPool(int numThreads);
+
+    /**
+     * Runs the remaining tasks and joins the worker threads.
+     */
+    ~ThreadPool();
+
+    void enqueue(std::function<void()> task, int priority = 0);
+
+    /**
+     * @return number of tasks, that are waiting for a worker thread
+     */
+    size_t pendingCount() const;
+
+private:
+    struct Task {
+        int priority { 0 };
+        uint64_t seq { 0 }; /**< submission order */
+        std::function<void()> fn;
+    };
+
+    struct TaskCompare {
+        bool operator()(const Task &left, const Task &right) const {
+            if (left.priority != right.priority) return left.priority < right.priority;
+            return left.seq > right.seq;
+        }
+    };
+
+    std::vector<std::thread> _threads;
+    std::priority_queue<Task, std::vector<Task>, TaskCompare> _tasks;
+    uint64_t _nextSeq { 0 };
+    bool _stopping { false };
+
+    mutable std::mutex _mutex;
+    std::condition_variable _condition;
+
+    void threadStart();
+};
+
+} // namespace reone
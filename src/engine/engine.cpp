@@ -41,7 +41,7 @@ Engine::Engine(fs::path gamePath, Options options) : _gamePath(move(gamePath)),
 }
 
 int Engine::run() {
-    ResourceServices resource(_gamePath);
+    ResourceServices resource(_options.resource, _gamePath);
     resource.init();
 
     GraphicsServices graphics(_options.graphics, resource);
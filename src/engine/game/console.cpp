@@ -58,6 +58,7 @@ void Console::initCommands() {
     addCommand("kill", bind(&Console::cmdKill, this, _1));
     addCommand("additem", bind(&Console::cmdAddItem, this, _1));
     addCommand("givexp", bind(&Console::cmdGiveXP, this, _1));
+    addCommand("resstats", bind(&Console::cmdResStats, this, _1));
 }
 
 void Console::addCommand(const std::string &name, const CommandHandler &handler) {
@@ -187,6 +188,12 @@ void Console::cmdGiveXP(vector<string> tokens) {
     static_pointer_cast<Creature>(object)->giveXP(amount);
 }
 
+void Console::cmdResStats(vector<string> tokens) {
+    for (auto &line : _game.services().resource().resources().stats().getReport()) {
+        print(line);
+    }
+}
+
 void Console::print(const string &text) {
     _output.push_front(text);
     trimOutput();
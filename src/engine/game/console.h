@@ -75,6 +75,7 @@ private:
     void cmdKill(std::vector<std::string> tokens);
     void cmdAddItem(std::vector<std::string> tokens);
     void cmdGiveXP(std::vector<std::string> tokens);
+    void cmdResStats(std::vector<std::string> tokens);
 
     // END Commands
 };
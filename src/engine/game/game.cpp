@@ -19,6 +19,8 @@
 
 #include "../common/log.h"
 #include "../common/pathutil.h"
+#include "../common/stopwatch.h"
+#include "../resource/packprovider.h"
 #include "../video/bikreader.h"
 
 #include "gameidutil.h"
@@ -42,6 +44,8 @@ namespace game {
 static constexpr char kDataDirectoryName[] = "data";
 static constexpr char kModulesDirectoryName[] = "modules";
 
+static constexpr int kRetainedModules = 2; /**< number of previous modules, whose unreferenced assets are retained */
+
 static bool g_conversationsEnabled = true;
 
 Game::Game(
@@ -108,6 +112,15 @@ void Game::initResourceProviders() {
     _resource.resources().indexDirectory(getPathIgnoreCase(fs::current_path(), kDataDirectoryName));
 }
 
+bool Game::indexResourcePack() {
+    fs::path packPath(getPathIgnoreCase(_path, kResourcePackFilename, false));
+    if (packPath.empty()) return false;
+
+    _resource.resources().indexPackFile(packPath);
+
+    return true;
+}
+
 void Game::loadModuleNames() {
     fs::path modules(getPathIgnoreCase(_path, kModulesDirectoryName));
 
@@ -214,16 +227,19 @@ void Game::loadModule(const string &name, string entry) {
             loadCharacterGeneration();
         }
 
-        _game->soundSets().invalidate();
-        _graphics.textures().invalidateCache();
-        _graphics.models().invalidateCache();
-        _graphics.walkmeshes().invalidateCache();
-        _graphics.lips().invalidate();
-        _audio.files().invalidate();
-        _script.scripts().invalidate();
+        Stopwatch stopwatch;
 
         loadModuleResources(name);
 
+        // Keep assets that are still referenced or were recently used, evict module-specific ones
+        _game->soundSets().beginGeneration(kRetainedModules);
+        _graphics.textures().beginGeneration(kRetainedModules);
+        _graphics.models().beginGeneration(kRetainedModules);
+        _graphics.walkmeshes().beginGeneration(kRetainedModules);
+        _graphics.lips().beginGeneration(kRetainedModules);
+        _audio.files().beginGeneration(kRetainedModules);
+        _script.scripts().beginGeneration(kRetainedModules);
+
         if (_module) {
             _module->area()->runOnExitScript();
             _module->area()->unloadParty();
@@ -250,6 +266,8 @@ void Game::loadModule(const string &name, string entry) {
         _loadScreen->setProgress(100);
         drawAll();
 
+        info(boost::format("Module %s loaded in %.3f s") % name % stopwatch.getElapsedTime());
+
         string musicName(_module->area()->music());
         playMusic(musicName);
 
@@ -271,6 +289,8 @@ void Game::withLoadingScreen(const string &imageResRef, const function<void()> &
 }
 
 void Game::loadModuleResources(const string &moduleName) {
+    _resource.resources().cancelPrefetch();
+    _resource.resources().stats().beginModule(moduleName);
     _resource.resources().invalidateCache();
     _resource.resources().clearTransientProviders();
 
@@ -292,6 +312,9 @@ void Game::loadModuleResources(const string &moduleName) {
 }
 
 void Game::drawAll() {
+    // Swap in textures, decoded in the background
+    _graphics.textures().processUploads();
+
     // Compute derived PBR IBL textures from queued environment maps
     _graphics.pbrIbl().refresh();
 
@@ -533,6 +556,14 @@ void Game::loadCharacterGeneration() {
 void Game::deinit() {
     _audio.player().deinit();
     _graphics.window().deinit();
+
+    if (!_options.resource.statsPath.empty()) {
+        try {
+            _resource.resources().stats().saveJSON(fs::path(_options.resource.statsPath));
+        } catch (const exception &e) {
+            warn(boost::format("Cannot save resource statistics: %s") % e.what());
+        }
+    }
 }
 
 void Game::startCharacterGeneration() {
@@ -285,6 +285,15 @@ private:
     // Resource management
 
     void initResourceProviders();
+
+    /**
+     * Indexes the resource pack in the game directory, if present. A resource
+     * pack replaces KEY/BIF, ERF and directory providers of the game.
+     *
+     * @return true if the resource pack was indexed, false otherwise
+     */
+    bool indexResourcePack();
+
     void initResourceProvidersForKotOR();
     void initResourceProvidersForTSL();
 
@@ -40,20 +40,22 @@ static constexpr char kExeFilename[] = "swkotor.exe";
 static vector<string> g_nonTransientLipFiles { "global.mod", "localization.mod" };
 
 void Game::initResourceProvidersForKotOR() {
-    _resource.resources().indexKeyFile(getPathIgnoreCase(_path, kKeyFilename));
-    _resource.resources().indexErfFile(getPathIgnoreCase(_path, kPatchFilename));
-
-    fs::path texPacksPath(getPathIgnoreCase(_path, kTexturePackDirectoryName));
-    _resource.resources().indexErfFile(getPathIgnoreCase(texPacksPath, kGUITexturePackFilename));
-    _resource.resources().indexErfFile(getPathIgnoreCase(texPacksPath, kTexturePackFilename));
-
-    _resource.resources().indexDirectory(getPathIgnoreCase(_path, kMusicDirectoryName));
-    _resource.resources().indexDirectory(getPathIgnoreCase(_path, kSoundsDirectoryName));
-    _resource.resources().indexDirectory(getPathIgnoreCase(_path, kWavesDirectoryName));
-
-    fs::path lipsPath(getPathIgnoreCase(_path, kLipsDirectoryName));
-    for (auto &filename : g_nonTransientLipFiles) {
-        _resource.resources().indexErfFile(getPathIgnoreCase(lipsPath, filename));
+    if (!indexResourcePack()) {
+        _resource.resources().indexKeyFile(getPathIgnoreCase(_path, kKeyFilename));
+        _resource.resources().indexErfFile(getPathIgnoreCase(_path, kPatchFilename));
+
+        fs::path texPacksPath(getPathIgnoreCase(_path, kTexturePackDirectoryName));
+        _resource.resources().indexErfFile(getPathIgnoreCase(texPacksPath, kGUITexturePackFilename));
+        _resource.resources().indexErfFile(getPathIgnoreCase(texPacksPath, kTexturePackFilename));
+
+        _resource.resources().indexDirectory(getPathIgnoreCase(_path, kMusicDirectoryName));
+        _resource.resources().indexDirectory(getPathIgnoreCase(_path, kSoundsDirectoryName));
+        _resource.resources().indexDirectory(getPathIgnoreCase(_path, kWavesDirectoryName));
+
+        fs::path lipsPath(getPathIgnoreCase(_path, kLipsDirectoryName));
+        for (auto &filename : g_nonTransientLipFiles) {
+            _resource.resources().indexErfFile(getPathIgnoreCase(lipsPath, filename));
+        }
     }
 
     _resource.resources().indexExeFile(getPathIgnoreCase(_path, kExeFilename));
@@ -38,18 +38,20 @@ static constexpr char kLocalizationLipFilename[] = "localization";
 static constexpr char kExeFilename[] = "swkotor2.exe";
 
 void Game::initResourceProvidersForTSL() {
-    _resource.resources().indexKeyFile(getPathIgnoreCase(_path, kKeyFilename));
+    if (!indexResourcePack()) {
+        _resource.resources().indexKeyFile(getPathIgnoreCase(_path, kKeyFilename));
 
-    fs::path texPacksPath(getPathIgnoreCase(_path, kTexturePackDirectoryName));
-    _resource.resources().indexErfFile(getPathIgnoreCase(texPacksPath, kGUITexturePackFilename));
-    _resource.resources().indexErfFile(getPathIgnoreCase(texPacksPath, kTexturePackFilename));
+        fs::path texPacksPath(getPathIgnoreCase(_path, kTexturePackDirectoryName));
+        _resource.resources().indexErfFile(getPathIgnoreCase(texPacksPath, kGUITexturePackFilename));
+        _resource.resources().indexErfFile(getPathIgnoreCase(texPacksPath, kTexturePackFilename));
 
-    _resource.resources().indexDirectory(getPathIgnoreCase(_path, kMusicDirectoryName));
-    _resource.resources().indexDirectory(getPathIgnoreCase(_path, kSoundsDirectoryName));
-    _resource.resources().indexDirectory(getPathIgnoreCase(_path, kVoiceDirectoryName));
+        _resource.resources().indexDirectory(getPathIgnoreCase(_path, kMusicDirectoryName));
+        _resource.resources().indexDirectory(getPathIgnoreCase(_path, kSoundsDirectoryName));
+        _resource.resources().indexDirectory(getPathIgnoreCase(_path, kVoiceDirectoryName));
 
-    fs::path lipsPath(getPathIgnoreCase(_path, kLipsDirectoryName));
-    _resource.resources().indexErfFile(getPathIgnoreCase(lipsPath, kLocalizationLipFilename));
+        fs::path lipsPath(getPathIgnoreCase(_path, kLipsDirectoryName));
+        _resource.resources().indexErfFile(getPathIgnoreCase(lipsPath, kLocalizationLipFilename));
+    }
 
     _resource.resources().indexExeFile(getPathIgnoreCase(_path, kExeFilename));
     _resource.resources().indexDirectory(getPathIgnoreCase(_path, kOverrideDirectoryName));
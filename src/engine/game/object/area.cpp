@@ -97,8 +97,19 @@ void Area::load(string name, const GffStruct &are, const GffStruct &git, bool fr
 }
 
 void Area::loadLYT() {
+    Resources &resources = _game->services().resource().resources();
+
     LytReader lyt;
-    lyt.load(wrap(_game->services().resource().resources().getRaw(_name, ResourceType::Lyt)));
+    lyt.load(wrap(resources.getRaw(_name, ResourceType::Lyt)));
+
+    // Load room files in the background, while models are being constructed
+    vector<ResourceId> roomResources;
+    for (auto &lytRoom : lyt.rooms()) {
+        roomResources.push_back(ResourceId(lytRoom.name, ResourceType::Mdl));
+        roomResources.push_back(ResourceId(lytRoom.name, ResourceType::Mdx));
+        roomResources.push_back(ResourceId(lytRoom.name, ResourceType::Wok));
+    }
+    resources.prefetch(move(roomResources), PrefetchPriority::High);
 
     for (auto &lytRoom : lyt.rooms()) {
         shared_ptr<Model> model(_game->services().graphics().models().get(lytRoom.name));
@@ -33,6 +33,17 @@ namespace reone {
 
 namespace game {
 
+static const GffLabel kLabelAreaProperties("AreaProperties");
+static const GffLabel kLabelMusicDay("MusicDay");
+static const GffLabel kLabelCreatureList("Creature List");
+static const GffLabel kLabelDoorList("Door List");
+static const GffLabel kLabelPlaceableList("Placeable List");
+static const GffLabel kLabelWaypointList("WaypointList");
+static const GffLabel kLabelTriggerList("TriggerList");
+static const GffLabel kLabelSoundList("SoundList");
+static const GffLabel kLabelCameraList("CameraList");
+static const GffLabel kLabelEncounterList("Encounter List");
+
 void Area::loadGIT(const GffStruct &git) {
     loadProperties(git);
     loadCreatures(git);
@@ -46,8 +57,8 @@ void Area::loadGIT(const GffStruct &git) {
 }
 
 void Area::loadProperties(const GffStruct &git) {
-    shared_ptr<GffStruct> props(git.getStruct("AreaProperties"));
-    int musicIdx = props->getInt("MusicDay");
+    shared_ptr<GffStruct> props(git.getStruct(kLabelAreaProperties));
+    int musicIdx = props->getInt(kLabelMusicDay);
     if (musicIdx) {
         shared_ptr<TwoDA> musicTable(_game->services().resource().resources().get2DA("ambientmusic"));
         _music = musicTable->getString(musicIdx, "resource");
@@ -55,7 +66,7 @@ void Area::loadProperties(const GffStruct &git) {
 }
 
 void Area::loadCreatures(const GffStruct &git) {
-    for (auto &gffs : git.getList("Creature List")) {
+    for (auto &gffs : git.getList(kLabelCreatureList)) {
         shared_ptr<Creature> creature(_game->services().objectFactory().newCreature());
         creature->loadFromGIT(*gffs);
         landObject(*creature);
@@ -64,7 +75,7 @@ void Area::loadCreatures(const GffStruct &git) {
 }
 
 void Area::loadDoors(const GffStruct &git) {
-    for (auto &gffs : git.getList("Door List")) {
+    for (auto &gffs : git.getList(kLabelDoorList)) {
         shared_ptr<Door> door(_game->services().objectFactory().newDoor());
         door->loadFromGIT(*gffs);
         add(door);
@@ -72,7 +83,7 @@ void Area::loadDoors(const GffStruct &git) {
 }
 
 void Area::loadPlaceables(const GffStruct &git) {
-    for (auto &gffs : git.getList("Placeable List")) {
+    for (auto &gffs : git.getList(kLabelPlaceableList)) {
         shared_ptr<Placeable> placeable(_game->services().objectFactory().newPlaceable());
         placeable->loadFromGIT(*gffs);
         add(placeable);
@@ -80,7 +91,7 @@ void Area::loadPlaceables(const GffStruct &git) {
 }
 
 void Area::loadWaypoints(const GffStruct &git) {
-    for (auto &gffs : git.getList("WaypointList")) {
+    for (auto &gffs : git.getList(kLabelWaypointList)) {
         shared_ptr<Waypoint> waypoint(_game->services().objectFactory().newWaypoint());
         waypoint->loadFromGIT(*gffs);
         add(waypoint);
@@ -88,7 +99,7 @@ void Area::loadWaypoints(const GffStruct &git) {
 }
 
 void Area::loadTriggers(const GffStruct &git) {
-    for (auto &gffs : git.getList("TriggerList")) {
+    for (auto &gffs : git.getList(kLabelTriggerList)) {
         shared_ptr<Trigger> trigger(_game->services().objectFactory().newTrigger());
         trigger->loadFromGIT(*gffs);
         add(trigger);
@@ -96,7 +107,7 @@ void Area::loadTriggers(const GffStruct &git) {
 }
 
 void Area::loadSounds(const GffStruct &git) {
-    for (auto &gffs : git.getList("SoundList")) {
+    for (auto &gffs : git.getList(kLabelSoundList)) {
         shared_ptr<Sound> sound(_game->services().objectFactory().newSound());
         sound->loadFromGIT(*gffs);
         add(sound);
@@ -104,7 +115,7 @@ void Area::loadSounds(const GffStruct &git) {
 }
 
 void Area::loadCameras(const GffStruct &git) {
-    for (auto &gffs : git.getList("CameraList")) {
+    for (auto &gffs : git.getList(kLabelCameraList)) {
         shared_ptr<PlaceableCamera> camera(_game->services().objectFactory().newCamera());
         camera->loadFromGIT(*gffs);
         add(camera);
@@ -112,7 +123,7 @@ void Area::loadCameras(const GffStruct &git) {
 }
 
 void Area::loadEncounters(const GffStruct &git) {
-    for (auto &gffs : git.getList("Encounter List")) {
+    for (auto &gffs : git.getList(kLabelEncounterList)) {
         shared_ptr<Encounter> encounter(_game->services().objectFactory().newEncounter());
         encounter->loadFromGIT(*gffs);
         add(encounter);
@@ -36,52 +36,122 @@ namespace reone {
 
 namespace game {
 
+static const GffLabel kLabelTemplateResRef("TemplateResRef");
+static const GffLabel kLabelRace("Race");
+static const GffLabel kLabelSubraceIndex("SubraceIndex");
+static const GffLabel kLabelAppearanceType("Appearance_Type");
+static const GffLabel kLabelGender("Gender");
+static const GffLabel kLabelPortraitId("PortraitId");
+static const GffLabel kLabelTag("Tag");
+static const GffLabel kLabelConversation("Conversation");
+static const GffLabel kLabelIsPC("IsPC");
+static const GffLabel kLabelFactionID("FactionID");
+static const GffLabel kLabelDisarmable("Disarmable");
+static const GffLabel kLabelPlot("Plot");
+static const GffLabel kLabelInterruptable("Interruptable");
+static const GffLabel kLabelNoPermDeath("NoPermDeath");
+static const GffLabel kLabelNotReorienting("NotReorienting");
+static const GffLabel kLabelBodyVariation("BodyVariation");
+static const GffLabel kLabelTextureVar("TextureVar");
+static const GffLabel kLabelMin1HP("Min1HP");
+static const GffLabel kLabelPartyInteract("PartyInteract");
+static const GffLabel kLabelWalkRate("WalkRate");
+static const GffLabel kLabelNaturalAC("NaturalAC");
+static const GffLabel kLabelHitPoints("HitPoints");
+static const GffLabel kLabelCurrentHitPoints("CurrentHitPoints");
+static const GffLabel kLabelMaxHitPoints("MaxHitPoints");
+static const GffLabel kLabelForcePoints("ForcePoints");
+static const GffLabel kLabelCurrentForce("CurrentForce");
+static const GffLabel kLabelRefbonus("refbonus");
+static const GffLabel kLabelWillbonus("willbonus");
+static const GffLabel kLabelFortbonus("fortbonus");
+static const GffLabel kLabelGoodEvil("GoodEvil");
+static const GffLabel kLabelChallengeRating("ChallengeRating");
+static const GffLabel kLabelScriptHeartbeat("ScriptHeartbeat");
+static const GffLabel kLabelScriptOnNotice("ScriptOnNotice");
+static const GffLabel kLabelScriptSpellAt("ScriptSpellAt");
+static const GffLabel kLabelScriptAttacked("ScriptAttacked");
+static const GffLabel kLabelScriptDamaged("ScriptDamaged");
+static const GffLabel kLabelScriptDisturbed("ScriptDisturbed");
+static const GffLabel kLabelScriptEndRound("ScriptEndRound");
+static const GffLabel kLabelScriptEndDialogu("ScriptEndDialogu");
+static const GffLabel kLabelScriptDialogue("ScriptDialogue");
+static const GffLabel kLabelScriptSpawn("ScriptSpawn");
+static const GffLabel kLabelScriptDeath("ScriptDeath");
+static const GffLabel kLabelScriptUserDefine("ScriptUserDefine");
+static const GffLabel kLabelScriptOnBlocked("ScriptOnBlocked");
+static const GffLabel kLabelEquipItemList("Equip_ItemList");
+static const GffLabel kLabelEquippedRes("EquippedRes");
+static const GffLabel kLabelItemList("ItemList");
+static const GffLabel kLabelInventoryRes("InventoryRes");
+static const GffLabel kLabelDropable("Dropable");
+static const GffLabel kLabelFirstName("FirstName");
+static const GffLabel kLabelLastName("LastName");
+static const GffLabel kLabelSoundSetFile("SoundSetFile");
+static const GffLabel kLabelBodyBag("BodyBag");
+static const GffLabel kLabelStr("Str");
+static const GffLabel kLabelDex("Dex");
+static const GffLabel kLabelCon("Con");
+static const GffLabel kLabelInt("Int");
+static const GffLabel kLabelWis("Wis");
+static const GffLabel kLabelCha("Cha");
+static const GffLabel kLabelClassList("ClassList");
+static const GffLabel kLabelClass("Class");
+static const GffLabel kLabelClassLevel("ClassLevel");
+static const GffLabel kLabelKnownList0("KnownList0");
+static const GffLabel kLabelSpell("Spell");
+static const GffLabel kLabelSkillList("SkillList");
+static const GffLabel kLabelRank("Rank");
+static const GffLabel kLabelFeatList("FeatList");
+static const GffLabel kLabelFeat("Feat");
+static const GffLabel kLabelPerceptionRange("PerceptionRange");
+
 void Creature::loadUTC(const GffStruct &utc) {
-    _blueprintResRef = boost::to_lower_copy(utc.getString("TemplateResRef"));
-    _race = utc.getEnum("Race", RacialType::Invalid); // index into racialtypes.2da
-    _subrace = utc.getEnum("SubraceIndex", Subrace::None); // index into subrace.2da
-    _appearance = utc.getInt("Appearance_Type"); // index into appearance.2da
-    _gender = utc.getEnum("Gender", Gender::None); // index into gender.2da
-    _portraitId = utc.getInt("PortraitId"); // index into portrait.2da
-    _tag = boost::to_lower_copy(utc.getString("Tag"));
-    _conversation = boost::to_lower_copy(utc.getString("Conversation"));
-    _isPC = utc.getBool("IsPC"); // always 0
-    _faction = utc.getEnum("FactionID", Faction::Invalid); // index into repute.2da
-    _disarmable = utc.getBool("Disarmable");
-    _plot = utc.getBool("Plot");
-    _interruptable = utc.getBool("Interruptable");
-    _noPermDeath = utc.getBool("NoPermDeath");
-    _notReorienting = utc.getBool("NotReorienting");
-    _bodyVariation = utc.getInt("BodyVariation");
-    _textureVar = utc.getInt("TextureVar");
-    _minOneHP = utc.getBool("Min1HP");
-    _partyInteract = utc.getBool("PartyInteract");
-    _walkRate = utc.getInt("WalkRate"); // index into creaturespeed.2da
-    _naturalAC = utc.getInt("NaturalAC");
-    _hitPoints = utc.getInt("HitPoints");
-    _currentHitPoints = utc.getInt("CurrentHitPoints");
-    _maxHitPoints = utc.getInt("MaxHitPoints");
-    _forcePoints = utc.getInt("ForcePoints");
-    _currentForce = utc.getInt("CurrentForce");
-    _refBonus = utc.getInt("refbonus");
-    _willBonus = utc.getInt("willbonus");
-    _fortBonus = utc.getInt("fortbonus");
-    _goodEvil = utc.getInt("GoodEvil");
-    _challengeRating = utc.getInt("ChallengeRating");
-
-    _onHeartbeat = boost::to_lower_copy(utc.getString("ScriptHeartbeat"));
-    _onNotice = boost::to_lower_copy(utc.getString("ScriptOnNotice"));
-    _onSpellAt = boost::to_lower_copy(utc.getString("ScriptSpellAt"));
-    _onAttacked = boost::to_lower_copy(utc.getString("ScriptAttacked"));
-    _onDamaged = boost::to_lower_copy(utc.getString("ScriptDamaged"));
-    _onDisturbed = boost::to_lower_copy(utc.getString("ScriptDisturbed"));
-    _onEndRound = boost::to_lower_copy(utc.getString("ScriptEndRound"));
-    _onEndDialogue = boost::to_lower_copy(utc.getString("ScriptEndDialogu"));
-    _onDialogue = boost::to_lower_copy(utc.getString("ScriptDialogue"));
-    _onSpawn = boost::to_lower_copy(utc.getString("ScriptSpawn"));
-    _onDeath = boost::to_lower_copy(utc.getString("ScriptDeath"));
-    _onUserDefined = boost::to_lower_copy(utc.getString("ScriptUserDefine"));
-    _onBlocked = boost::to_lower_copy(utc.getString("ScriptOnBlocked"));
+    _blueprintResRef = boost::to_lower_copy(utc.getString(kLabelTemplateResRef));
+    _race = utc.getEnum(kLabelRace, RacialType::Invalid); // index into racialtypes.2da
+    _subrace = utc.getEnum(kLabelSubraceIndex, Subrace::None); // index into subrace.2da
+    _appearance = utc.getInt(kLabelAppearanceType); // index into appearance.2da
+    _gender = utc.getEnum(kLabelGender, Gender::None); // index into gender.2da
+    _portraitId = utc.getInt(kLabelPortraitId); // index into portrait.2da
+    _tag = boost::to_lower_copy(utc.getString(kLabelTag));
+    _conversation = boost::to_lower_copy(utc.getString(kLabelConversation));
+    _isPC = utc.getBool(kLabelIsPC); // always 0
+    _faction = utc.getEnum(kLabelFactionID, Faction::Invalid); // index into repute.2da
+    _disarmable = utc.getBool(kLabelDisarmable);
+    _plot = utc.getBool(kLabelPlot);
+    _interruptable = utc.getBool(kLabelInterruptable);
+    _noPermDeath = utc.getBool(kLabelNoPermDeath);
+    _notReorienting = utc.getBool(kLabelNotReorienting);
+    _bodyVariation = utc.getInt(kLabelBodyVariation);
+    _textureVar = utc.getInt(kLabelTextureVar);
+    _minOneHP = utc.getBool(kLabelMin1HP);
+    _partyInteract = utc.getBool(kLabelPartyInteract);
+    _walkRate = utc.getInt(kLabelWalkRate); // index into creaturespeed.2da
+    _naturalAC = utc.getInt(kLabelNaturalAC);
+    _hitPoints = utc.getInt(kLabelHitPoints);
+    _currentHitPoints = utc.getInt(kLabelCurrentHitPoints);
+    _maxHitPoints = utc.getInt(kLabelMaxHitPoints);
+    _forcePoints = utc.getInt(kLabelForcePoints);
+    _currentForce = utc.getInt(kLabelCurrentForce);
+    _refBonus = utc.getInt(kLabelRefbonus);
+    _willBonus = utc.getInt(kLabelWillbonus);
+    _fortBonus = utc.getInt(kLabelFortbonus);
+    _goodEvil = utc.getInt(kLabelGoodEvil);
+    _challengeRating = utc.getInt(kLabelChallengeRating);
+
+    _onHeartbeat = boost::to_lower_copy(utc.getString(kLabelScriptHeartbeat));
+    _onNotice = boost::to_lower_copy(utc.getString(kLabelScriptOnNotice));
+    _onSpellAt = boost::to_lower_copy(utc.getString(kLabelScriptSpellAt));
+    _onAttacked = boost::to_lower_copy(utc.getString(kLabelScriptAttacked));
+    _onDamaged = boost::to_lower_copy(utc.getString(kLabelScriptDamaged));
+    _onDisturbed = boost::to_lower_copy(utc.getString(kLabelScriptDisturbed));
+    _onEndRound = boost::to_lower_copy(utc.getString(kLabelScriptEndRound));
+    _onEndDialogue = boost::to_lower_copy(utc.getString(kLabelScriptEndDialogu));
+    _onDialogue = boost::to_lower_copy(utc.getString(kLabelScriptDialogue));
+    _onSpawn = boost::to_lower_copy(utc.getString(kLabelScriptSpawn));
+    _onDeath = boost::to_lower_copy(utc.getString(kLabelScriptDeath));
+    _onUserDefined = boost::to_lower_copy(utc.getString(kLabelScriptUserDefine));
+    _onBlocked = boost::to_lower_copy(utc.getString(kLabelScriptOnBlocked));
 
     loadNameFromUTC(utc);
     loadSoundSetFromUTC(utc);
@@ -89,12 +159,12 @@ void Creature::loadUTC(const GffStruct &utc) {
     loadAttributesFromUTC(utc);
     loadPerceptionRangeFromUTC(utc);
 
-    for (auto &item : utc.getList("Equip_ItemList")) {
-        equip(boost::to_lower_copy(item->getString("EquippedRes")));
+    for (auto &item : utc.getList(kLabelEquipItemList)) {
+        equip(boost::to_lower_copy(item->getString(kLabelEquippedRes)));
     }
-    for (auto &itemGffs : utc.getList("ItemList")) {
-        string resRef(boost::to_lower_copy(itemGffs->getString("InventoryRes")));
-        bool dropable = itemGffs->getBool("Dropable");
+    for (auto &itemGffs : utc.getList(kLabelItemList)) {
+        string resRef(boost::to_lower_copy(itemGffs->getString(kLabelInventoryRes)));
+        bool dropable = itemGffs->getBool(kLabelDropable);
         addItem(resRef, 1, dropable);
     }
 
@@ -111,8 +181,8 @@ void Creature::loadUTC(const GffStruct &utc) {
 }
 
 void Creature::loadNameFromUTC(const GffStruct &utc) {
-    string firstName(_game->services().resource().strings().get(utc.getInt("FirstName")));
-    string lastName(_game->services().resource().strings().get(utc.getInt("LastName")));
+    string firstName(_game->services().resource().strings().get(utc.getInt(kLabelFirstName)));
+    string lastName(_game->services().resource().strings().get(utc.getInt(kLabelLastName)));
     if (!firstName.empty() && !lastName.empty()) {
         _name = firstName + " " + lastName;
     } else if (!firstName.empty()) {
@@ -121,7 +191,7 @@ void Creature::loadNameFromUTC(const GffStruct &utc) {
 }
 
 void Creature::loadSoundSetFromUTC(const GffStruct &utc) {
-    uint32_t soundSetIdx = utc.getUint("SoundSetFile");
+    uint32_t soundSetIdx = utc.getUint(kLabelSoundSetFile);
     if (soundSetIdx != 0xffff) {
         shared_ptr<TwoDA> soundSetTable(_game->services().resource().resources().get2DA("soundset"));
         string soundSetResRef(soundSetTable->getString(soundSetIdx, "resref"));
@@ -132,7 +202,7 @@ void Creature::loadSoundSetFromUTC(const GffStruct &utc) {
 }
 
 void Creature::loadBodyBagFromUTC(const GffStruct &utc) {
-    int bodyBag = utc.getInt("BodyBag");
+    int bodyBag = utc.getInt(kLabelBodyBag);
     shared_ptr<TwoDA> bodyBags(_game->services().resource().resources().get2DA("bodybag"));
     _bodyBag.name = _game->services().resource().strings().get(bodyBags->getInt(bodyBag, "name"));
     _bodyBag.appearance = bodyBags->getInt(bodyBag, "appearance");
@@ -141,37 +211,37 @@ void Creature::loadBodyBagFromUTC(const GffStruct &utc) {
 
 void Creature::loadAttributesFromUTC(const GffStruct &utc) {
     CreatureAttributes &attributes = _attributes;
-    attributes.setAbilityScore(Ability::Strength, utc.getInt("Str"));
-    attributes.setAbilityScore(Ability::Dexterity, utc.getInt("Dex"));
-    attributes.setAbilityScore(Ability::Constitution, utc.getInt("Con"));
-    attributes.setAbilityScore(Ability::Intelligence, utc.getInt("Int"));
-    attributes.setAbilityScore(Ability::Wisdom, utc.getInt("Wis"));
-    attributes.setAbilityScore(Ability::Charisma, utc.getInt("Cha"));
-
-    for (auto &classGffs : utc.getList("ClassList")) {
-        int clazz = classGffs->getInt("Class");
-        int level = classGffs->getInt("ClassLevel");
+    attributes.setAbilityScore(Ability::Strength, utc.getInt(kLabelStr));
+    attributes.setAbilityScore(Ability::Dexterity, utc.getInt(kLabelDex));
+    attributes.setAbilityScore(Ability::Constitution, utc.getInt(kLabelCon));
+    attributes.setAbilityScore(Ability::Intelligence, utc.getInt(kLabelInt));
+    attributes.setAbilityScore(Ability::Wisdom, utc.getInt(kLabelWis));
+    attributes.setAbilityScore(Ability::Charisma, utc.getInt(kLabelCha));
+
+    for (auto &classGffs : utc.getList(kLabelClassList)) {
+        int clazz = classGffs->getInt(kLabelClass);
+        int level = classGffs->getInt(kLabelClassLevel);
         attributes.addClassLevels(_game->services().classes().get(static_cast<ClassType>(clazz)).get(), level);
-        for (auto &spellGffs : classGffs->getList("KnownList0")) {
-            auto spell = static_cast<ForcePower>(spellGffs->getUint("Spell"));
+        for (auto &spellGffs : classGffs->getList(kLabelKnownList0)) {
+            auto spell = static_cast<ForcePower>(spellGffs->getUint(kLabelSpell));
             attributes.addSpell(spell);
         }
     }
 
-    vector<shared_ptr<GffStruct>> skillsUtc(utc.getList("SkillList"));
+    vector<shared_ptr<GffStruct>> skillsUtc(utc.getList(kLabelSkillList));
     for (int i = 0; i < static_cast<int>(skillsUtc.size()); ++i) {
         SkillType skill = static_cast<SkillType>(i);
-        attributes.setSkillRank(skill, skillsUtc[i]->getInt("Rank"));
+        attributes.setSkillRank(skill, skillsUtc[i]->getInt(kLabelRank));
     }
 
-    for (auto &featGffs : utc.getList("FeatList")) {
-        auto feat = static_cast<FeatType>(featGffs->getUint("Feat"));
+    for (auto &featGffs : utc.getList(kLabelFeatList)) {
+        auto feat = static_cast<FeatType>(featGffs->getUint(kLabelFeat));
         _attributes.addFeat(feat);
     }
 }
 
 void Creature::loadPerceptionRangeFromUTC(const GffStruct &utc) {
-    int rangeIdx = utc.getInt("PerceptionRange");
+    int rangeIdx = utc.getInt(kLabelPerceptionRange);
     shared_ptr<TwoDA> ranges(_game->services().resource().resources().get2DA("ranges"));
     _perception.sightRange = ranges->getFloat(rangeIdx, "primaryrange");
     _perception.hearingRange = ranges->getFloat(rangeIdx, "secondaryrange");
@@ -33,40 +33,73 @@ namespace reone {
 
 namespace game {
 
+static const GffLabel kLabelTag("Tag");
+static const GffLabel kLabelLocName("LocName");
+static const GffLabel kLabelTemplateResRef("TemplateResRef");
+static const GffLabel kLabelAutoRemoveKey("AutoRemoveKey");
+static const GffLabel kLabelConversation("Conversation");
+static const GffLabel kLabelInterruptable("Interruptable");
+static const GffLabel kLabelFaction("Faction");
+static const GffLabel kLabelPlot("Plot");
+static const GffLabel kLabelMin1HP("Min1HP");
+static const GffLabel kLabelKeyRequired("KeyRequired");
+static const GffLabel kLabelLockable("Lockable");
+static const GffLabel kLabelLocked("Locked");
+static const GffLabel kLabelOpenLockDC("OpenLockDC");
+static const GffLabel kLabelKeyName("KeyName");
+static const GffLabel kLabelHP("HP");
+static const GffLabel kLabelCurrentHP("CurrentHP");
+static const GffLabel kLabelHardness("Hardness");
+static const GffLabel kLabelFort("Fort");
+static const GffLabel kLabelGenericType("GenericType");
+static const GffLabel kLabelStatic("Static");
+static const GffLabel kLabelOnClosed("OnClosed");
+static const GffLabel kLabelOnDamaged("OnDamaged");
+static const GffLabel kLabelOnDeath("OnDeath");
+static const GffLabel kLabelOnHeartbeat("OnHeartbeat");
+static const GffLabel kLabelOnLock("OnLock");
+static const GffLabel kLabelOnMeleeAttacked("OnMeleeAttacked");
+static const GffLabel kLabelOnOpen("OnOpen");
+static const GffLabel kLabelOnSpellCastAt("OnSpellCastAt");
+static const GffLabel kLabelOnUnlock("OnUnlock");
+static const GffLabel kLabelOnUserDefined("OnUserDefined");
+static const GffLabel kLabelOnClick("OnClick");
+static const GffLabel kLabelOnFailToOpen("OnFailToOpen");
+
 void Door::loadUTD(const GffStruct &utd) {
-    _tag = boost::to_lower_copy(utd.getString("Tag"));
-    _name = _game->services().resource().strings().get(utd.getInt("LocName"));
-    _blueprintResRef = boost::to_lower_copy(utd.getString("TemplateResRef"));
-    _autoRemoveKey = utd.getBool("AutoRemoveKey");
-    _conversation = boost::to_lower_copy(utd.getString("Conversation"));
-    _interruptable = utd.getBool("Interruptable");
-    _faction = utd.getEnum("Faction", Faction::Invalid);
-    _plot = utd.getBool("Plot");
-    _minOneHP = utd.getBool("Min1HP");
-    _keyRequired = utd.getBool("KeyRequired");
-    _lockable = utd.getBool("Lockable");
-    _locked = utd.getBool("Locked");
-    _openLockDC = utd.getInt("OpenLockDC");
-    _keyName = utd.getString("KeyName");
-    _hitPoints = utd.getInt("HP");
-    _currentHitPoints = utd.getInt("CurrentHP");
-    _hardness = utd.getInt("Hardness");
-    _fortitude = utd.getInt("Fort");
-    _genericType = utd.getInt("GenericType");
-    _static = utd.getBool("Static");
+    _tag = boost::to_lower_copy(utd.getString(kLabelTag));
+    _name = _game->services().resource().strings().get(utd.getInt(kLabelLocName));
+    _blueprintResRef = boost::to_lower_copy(utd.getString(kLabelTemplateResRef));
+    _autoRemoveKey = utd.getBool(kLabelAutoRemoveKey);
+    _conversation = boost::to_lower_copy(utd.getString(kLabelConversation));
+    _interruptable = utd.getBool(kLabelInterruptable);
+    _faction = utd.getEnum(kLabelFaction, Faction::Invalid);
+    _plot = utd.getBool(kLabelPlot);
+    _minOneHP = utd.getBool(kLabelMin1HP);
+    _keyRequired = utd.getBool(kLabelKeyRequired);
+    _lockable = utd.getBool(kLabelLockable);
+    _locked = utd.getBool(kLabelLocked);
+    _openLockDC = utd.getInt(kLabelOpenLockDC);
+    _keyName = utd.getString(kLabelKeyName);
+    _hitPoints = utd.getInt(kLabelHP);
+    _currentHitPoints = utd.getInt(kLabelCurrentHP);
+    _hardness = utd.getInt(kLabelHardness);
+    _fortitude = utd.getInt(kLabelFort);
+    _genericType = utd.getInt(kLabelGenericType);
+    _static = utd.getBool(kLabelStatic);
 
-    _onClosed = utd.getString("OnClosed"); // always empty, but could be useful
-    _onDamaged = utd.getString("OnDamaged"); // always empty, but could be useful
-    _onDeath = utd.getString("OnDeath");
-    _onHeartbeat = utd.getString("OnHeartbeat");
-    _onLock = utd.getString("OnLock"); // always empty, but could be useful
-    _onMeleeAttacked = utd.getString("OnMeleeAttacked"); // always empty, but could be useful
-    _onOpen = utd.getString("OnOpen");
-    _onSpellCastAt = utd.getString("OnSpellCastAt"); // always empty, but could be useful
-    _onUnlock = utd.getString("OnUnlock"); // always empty, but could be useful
-    _onUserDefined = utd.getString("OnUserDefined");
-    _onClick = utd.getString("OnClick");
-    _onFailToOpen = utd.getString("OnFailToOpen");
+    _onClosed = utd.getString(kLabelOnClosed); // always empty, but could be useful
+    _onDamaged = utd.getString(kLabelOnDamaged); // always empty, but could be useful
+    _onDeath = utd.getString(kLabelOnDeath);
+    _onHeartbeat = utd.getString(kLabelOnHeartbeat);
+    _onLock = utd.getString(kLabelOnLock); // always empty, but could be useful
+    _onMeleeAttacked = utd.getString(kLabelOnMeleeAttacked); // always empty, but could be useful
+    _onOpen = utd.getString(kLabelOnOpen);
+    _onSpellCastAt = utd.getString(kLabelOnSpellCastAt); // always empty, but could be useful
+    _onUnlock = utd.getString(kLabelOnUnlock); // always empty, but could be useful
+    _onUserDefined = utd.getString(kLabelOnUserDefined);
+    _onClick = utd.getString(kLabelOnClick);
+    _onFailToOpen = utd.getString(kLabelOnFailToOpen);
 
     // Unused fields:
     //
@@ -31,24 +31,46 @@ namespace reone {
 
 namespace game {
 
+static const GffLabel kLabelTag("Tag");
+static const GffLabel kLabelLocalizedName("LocalizedName");
+static const GffLabel kLabelTemplateResRef("TemplateResRef");
+static const GffLabel kLabelActive("Active");
+static const GffLabel kLabelDifficultyIndex("DifficultyIndex");
+static const GffLabel kLabelFaction("Faction");
+static const GffLabel kLabelMaxCreatures("MaxCreatures");
+static const GffLabel kLabelPlayerOnly("PlayerOnly");
+static const GffLabel kLabelReset("Reset");
+static const GffLabel kLabelResetTime("ResetTime");
+static const GffLabel kLabelRespawns("Respawns");
+static const GffLabel kLabelOnEntered("OnEntered");
+static const GffLabel kLabelOnExit("OnExit");
+static const GffLabel kLabelOnExhausted("OnExhausted");
+static const GffLabel kLabelOnHeartbeat("OnHeartbeat");
+static const GffLabel kLabelOnUserDefined("OnUserDefined");
+static const GffLabel kLabelCreatureList("CreatureList");
+static const GffLabel kLabelAppearance("Appearance");
+static const GffLabel kLabelCR("CR");
+static const GffLabel kLabelResRef("ResRef");
+static const GffLabel kLabelSingleSpawn("SingleSpawn");
+
 void Encounter::loadUTE(const GffStruct &ute) {
-    _tag = boost::to_lower_copy(ute.getString("Tag"));
-    _name = _game->services().resource().strings().get(ute.getInt("LocalizedName"));
-    _blueprintResRef = boost::to_lower_copy(ute.getString("TemplateResRef"));
-    _active = ute.getBool("Active");
-    _difficultyIndex = ute.getInt("DifficultyIndex"); // index into encdifficulty.2da
-    _faction = ute.getEnum("Faction", Faction::Invalid);
-    _maxCreatures = ute.getInt("MaxCreatures");
-    _playerOnly = ute.getBool("PlayerOnly");
-    _reset = ute.getBool("Reset");
-    _resetTime = ute.getInt("ResetTime");
-    _respawns = ute.getInt("Respawns");
+    _tag = boost::to_lower_copy(ute.getString(kLabelTag));
+    _name = _game->services().resource().strings().get(ute.getInt(kLabelLocalizedName));
+    _blueprintResRef = boost::to_lower_copy(ute.getString(kLabelTemplateResRef));
+    _active = ute.getBool(kLabelActive);
+    _difficultyIndex = ute.getInt(kLabelDifficultyIndex); // index into encdifficulty.2da
+    _faction = ute.getEnum(kLabelFaction, Faction::Invalid);
+    _maxCreatures = ute.getInt(kLabelMaxCreatures);
+    _playerOnly = ute.getBool(kLabelPlayerOnly);
+    _reset = ute.getBool(kLabelReset);
+    _resetTime = ute.getInt(kLabelResetTime);
+    _respawns = ute.getInt(kLabelRespawns);
 
-    _onEntered = ute.getString("OnEntered");
-    _onExit = ute.getString("OnExit"); // always empty, but could be useful
-    _onExhausted = ute.getString("OnExhausted"); // always empty, but could be useful
-    _onHeartbeat = ute.getString("OnHeartbeat"); // always empty, but could be useful
-    _onUserDefined = ute.getString("OnUserDefined"); // always empty, but could be useful
+    _onEntered = ute.getString(kLabelOnEntered);
+    _onExit = ute.getString(kLabelOnExit); // always empty, but could be useful
+    _onExhausted = ute.getString(kLabelOnExhausted); // always empty, but could be useful
+    _onHeartbeat = ute.getString(kLabelOnHeartbeat); // always empty, but could be useful
+    _onUserDefined = ute.getString(kLabelOnUserDefined); // always empty, but could be useful
 
     loadCreaturesFromUTE(ute);
 
@@ -61,12 +83,12 @@ void Encounter::loadUTE(const GffStruct &ute) {
 }
 
 void Encounter::loadCreaturesFromUTE(const GffStruct &ute) {
-    for (auto &creatureGffs : ute.getList("CreatureList")) {
+    for (auto &creatureGffs : ute.getList(kLabelCreatureList)) {
         EncounterCreature creature;
-        creature._appearance = creatureGffs->getInt("Appearance");
-        creature._cr = creatureGffs->getFloat("CR");
-        creature._resRef = creatureGffs->getString("ResRef");
-        creature._singleSpawn = creatureGffs->getBool("SingleSpawn");
+        creature._appearance = creatureGffs->getInt(kLabelAppearance);
+        creature._cr = creatureGffs->getFloat(kLabelCR);
+        creature._resRef = creatureGffs->getString(kLabelResRef);
+        creature._singleSpawn = creatureGffs->getBool(kLabelSingleSpawn);
         _creatures.push_back(move(creature));
     }
 }
@@ -39,23 +39,40 @@ namespace reone {
 
 namespace game {
 
+static const GffLabel kLabelTemplateResRef("TemplateResRef");
+static const GffLabel kLabelBaseItem("BaseItem");
+static const GffLabel kLabelLocalizedName("LocalizedName");
+static const GffLabel kLabelDescription("Description");
+static const GffLabel kLabelDescIdentified("DescIdentified");
+static const GffLabel kLabelTag("Tag");
+static const GffLabel kLabelCharges("Charges");
+static const GffLabel kLabelCost("Cost");
+static const GffLabel kLabelStolen("Stolen");
+static const GffLabel kLabelStackSize("StackSize");
+static const GffLabel kLabelPlot("Plot");
+static const GffLabel kLabelAddCost("AddCost");
+static const GffLabel kLabelIdentified("Identified");
+static const GffLabel kLabelModelVariation("ModelVariation");
+static const GffLabel kLabelTextureVar("TextureVar");
+static const GffLabel kLabelBodyVariation("BodyVariation");
+
 void Item::loadUTI(const GffStruct &uti) {
-    _blueprintResRef = boost::to_lower_copy(uti.getString("TemplateResRef"));
-    _baseItem = uti.getInt("BaseItem"); // index into baseitems.2da
-    _localizedName = _game->services().resource().strings().get(uti.getInt("LocalizedName"));
-    _description = _game->services().resource().strings().get(uti.getInt("Description"));
-    _descIdentified = _game->services().resource().strings().get(uti.getInt("DescIdentified"));
-    _tag = boost::to_lower_copy(uti.getString("Tag"));
-    _charges = uti.getInt("Charges");
-    _cost = uti.getInt("Cost");
-    _stolen = uti.getBool("Stolen");
-    _stackSize = uti.getInt("StackSize");
-    _plot = uti.getBool("Plot");
-    _addCost = uti.getInt("AddCost");
-    _identified = uti.getInt("Identified");
-    _modelVariation = uti.getInt("ModelVariation", 1);
-    _textureVariation = uti.getInt("TextureVar", 1);
-    _bodyVariation = uti.getInt("BodyVariation", 1);
+    _blueprintResRef = boost::to_lower_copy(uti.getString(kLabelTemplateResRef));
+    _baseItem = uti.getInt(kLabelBaseItem); // index into baseitems.2da
+    _localizedName = _game->services().resource().strings().get(uti.getInt(kLabelLocalizedName));
+    _description = _game->services().resource().strings().get(uti.getInt(kLabelDescription));
+    _descIdentified = _game->services().resource().strings().get(uti.getInt(kLabelDescIdentified));
+    _tag = boost::to_lower_copy(uti.getString(kLabelTag));
+    _charges = uti.getInt(kLabelCharges);
+    _cost = uti.getInt(kLabelCost);
+    _stolen = uti.getBool(kLabelStolen);
+    _stackSize = uti.getInt(kLabelStackSize);
+    _plot = uti.getBool(kLabelPlot);
+    _addCost = uti.getInt(kLabelAddCost);
+    _identified = uti.getInt(kLabelIdentified);
+    _modelVariation = uti.getInt(kLabelModelVariation, 1);
+    _textureVariation = uti.getInt(kLabelTextureVar, 1);
+    _bodyVariation = uti.getInt(kLabelBodyVariation, 1);
 
     shared_ptr<TwoDA> baseItems(_game->services().resource().resources().get2DA("baseitems"));
     _attackRange = baseItems->getInt(_baseItem, "maxattackrange");
@@ -33,46 +33,84 @@ namespace reone {
 
 namespace game {
 
+static const GffLabel kLabelTag("Tag");
+static const GffLabel kLabelLocName("LocName");
+static const GffLabel kLabelTemplateResRef("TemplateResRef");
+static const GffLabel kLabelConversation("Conversation");
+static const GffLabel kLabelInterruptable("Interruptable");
+static const GffLabel kLabelFaction("Faction");
+static const GffLabel kLabelPlot("Plot");
+static const GffLabel kLabelMin1HP("Min1HP");
+static const GffLabel kLabelKeyRequired("KeyRequired");
+static const GffLabel kLabelLockable("Lockable");
+static const GffLabel kLabelLocked("Locked");
+static const GffLabel kLabelOpenLockDC("OpenLockDC");
+static const GffLabel kLabelAnimationState("AnimationState");
+static const GffLabel kLabelAppearance("Appearance");
+static const GffLabel kLabelHP("HP");
+static const GffLabel kLabelCurrentHP("CurrentHP");
+static const GffLabel kLabelHardness("Hardness");
+static const GffLabel kLabelFort("Fort");
+static const GffLabel kLabelHasInventory("HasInventory");
+static const GffLabel kLabelPartyInteract("PartyInteract");
+static const GffLabel kLabelStatic("Static");
+static const GffLabel kLabelUseable("Useable");
+static const GffLabel kLabelOnClosed("OnClosed");
+static const GffLabel kLabelOnDamaged("OnDamaged");
+static const GffLabel kLabelOnDeath("OnDeath");
+static const GffLabel kLabelOnHeartbeat("OnHeartbeat");
+static const GffLabel kLabelOnLock("OnLock");
+static const GffLabel kLabelOnMeleeAttacked("OnMeleeAttacked");
+static const GffLabel kLabelOnOpen("OnOpen");
+static const GffLabel kLabelOnSpellCastAt("OnSpellCastAt");
+static const GffLabel kLabelOnUnlock("OnUnlock");
+static const GffLabel kLabelOnUserDefined("OnUserDefined");
+static const GffLabel kLabelOnEndDialogue("OnEndDialogue");
+static const GffLabel kLabelOnInvDisturbed("OnInvDisturbed");
+static const GffLabel kLabelOnUsed("OnUsed");
+static const GffLabel kLabelItemList("ItemList");
+static const GffLabel kLabelInventoryRes("InventoryRes");
+
 void Placeable::loadUTP(const GffStruct &utp) {
-    _tag = boost::to_lower_copy(utp.getString("Tag"));
-    _name = _game->services().resource().strings().get(utp.getInt("LocName"));
-    _blueprintResRef = boost::to_lower_copy(utp.getString("TemplateResRef"));
-    _conversation = boost::to_lower_copy(utp.getString("Conversation"));
-    _interruptable = utp.getBool("Interruptable");
-    _faction = utp.getEnum("Faction", Faction::Invalid);
-    _plot = utp.getBool("Plot");
-    _minOneHP = utp.getBool("Min1HP");
-    _keyRequired = utp.getBool("KeyRequired");
-    _lockable = utp.getBool("Lockable");
-    _locked = utp.getBool("Locked");
-    _openLockDC = utp.getInt("OpenLockDC");
-    _animationState = utp.getInt("AnimationState");
-    _appearance = utp.getInt("Appearance");
-    _hitPoints = utp.getInt("HP");
-    _currentHitPoints = utp.getInt("CurrentHP");
-    _hardness = utp.getInt("Hardness");
-    _fortitude = utp.getInt("Fort");
-    _hasInventory = utp.getBool("HasInventory");
-    _partyInteract = utp.getBool("PartyInteract");
-    _static = utp.getBool("Static");
-    _usable = utp.getBool("Useable");
+    _tag = boost::to_lower_copy(utp.getString(kLabelTag));
+    _name = _game->services().resource().strings().get(utp.getInt(kLabelLocName));
+    _blueprintResRef = boost::to_lower_copy(utp.getString(kLabelTemplateResRef));
+    _conversation = boost::to_lower_copy(utp.getString(kLabelConversation));
+    _interruptable = utp.getBool(kLabelInterruptable);
+    _faction = utp.getEnum(kLabelFaction, Faction::Invalid);
+    _plot = utp.getBool(kLabelPlot);
+    _minOneHP = utp.getBool(kLabelMin1HP);
+    _keyRequired = utp.getBool(kLabelKeyRequired);
+    _lockable = utp.getBool(kLabelLockable);
+    _locked = utp.getBool(kLabelLocked);
+    _openLockDC = utp.getInt(kLabelOpenLockDC);
+    _animationState = utp.getInt(kLabelAnimationState);
+    _appearance = utp.getInt(kLabelAppearance);
+    _hitPoints = utp.getInt(kLabelHP);
+    _currentHitPoints = utp.getInt(kLabelCurrentHP);
+    _hardness = utp.getInt(kLabelHardness);
+    _fortitude = utp.getInt(kLabelFort);
+    _hasInventory = utp.getBool(kLabelHasInventory);
+    _partyInteract = utp.getBool(kLabelPartyInteract);
+    _static = utp.getBool(kLabelStatic);
+    _usable = utp.getBool(kLabelUseable);
 
-    _onClosed = boost::to_lower_copy(utp.getString("OnClosed"));
-    _onDamaged = boost::to_lower_copy(utp.getString("OnDamaged")); // always empty, but could be useful
-    _onDeath = boost::to_lower_copy(utp.getString("OnDeath"));
-    _onHeartbeat = boost::to_lower_copy(utp.getString("OnHeartbeat"));
-    _onLock = boost::to_lower_copy(utp.getString("OnLock")); // always empty, but could be useful
-    _onMeleeAttacked = boost::to_lower_copy(utp.getString("OnMeleeAttacked")); // always empty, but could be useful
-    _onOpen = boost::to_lower_copy(utp.getString("OnOpen"));
-    _onSpellCastAt = boost::to_lower_copy(utp.getString("OnSpellCastAt"));
-    _onUnlock = boost::to_lower_copy(utp.getString("OnUnlock")); // always empty, but could be useful
-    _onUserDefined = boost::to_lower_copy(utp.getString("OnUserDefined"));
-    _onEndDialogue = boost::to_lower_copy(utp.getString("OnEndDialogue"));
-    _onInvDisturbed = boost::to_lower_copy(utp.getString("OnInvDisturbed"));
-    _onUsed = boost::to_lower_copy(utp.getString("OnUsed"));
+    _onClosed = boost::to_lower_copy(utp.getString(kLabelOnClosed));
+    _onDamaged = boost::to_lower_copy(utp.getString(kLabelOnDamaged)); // always empty, but could be useful
+    _onDeath = boost::to_lower_copy(utp.getString(kLabelOnDeath));
+    _onHeartbeat = boost::to_lower_copy(utp.getString(kLabelOnHeartbeat));
+    _onLock = boost::to_lower_copy(utp.getString(kLabelOnLock)); // always empty, but could be useful
+    _onMeleeAttacked = boost::to_lower_copy(utp.getString(kLabelOnMeleeAttacked)); // always empty, but could be useful
+    _onOpen = boost::to_lower_copy(utp.getString(kLabelOnOpen));
+    _onSpellCastAt = boost::to_lower_copy(utp.getString(kLabelOnSpellCastAt));
+    _onUnlock = boost::to_lower_copy(utp.getString(kLabelOnUnlock)); // always empty, but could be useful
+    _onUserDefined = boost::to_lower_copy(utp.getString(kLabelOnUserDefined));
+    _onEndDialogue = boost::to_lower_copy(utp.getString(kLabelOnEndDialogue));
+    _onInvDisturbed = boost::to_lower_copy(utp.getString(kLabelOnInvDisturbed));
+    _onUsed = boost::to_lower_copy(utp.getString(kLabelOnUsed));
 
-    for (auto &itemGffs : utp.getList("ItemList")) {
-        string resRef(boost::to_lower_copy(itemGffs->getString("InventoryRes")));
+    for (auto &itemGffs : utp.getList(kLabelItemList)) {
+        string resRef(boost::to_lower_copy(itemGffs->getString(kLabelInventoryRes)));
         addItem(resRef, 1, true);
     }
 
@@ -34,31 +34,54 @@ namespace reone {
 
 namespace game {
 
+static const GffLabel kLabelTag("Tag");
+static const GffLabel kLabelLocName("LocName");
+static const GffLabel kLabelTemplateResRef("TemplateResRef");
+static const GffLabel kLabelActive("Active");
+static const GffLabel kLabelContinuous("Continuous");
+static const GffLabel kLabelLooping("Looping");
+static const GffLabel kLabelPositional("Positional");
+static const GffLabel kLabelRandomPosition("RandomPosition");
+static const GffLabel kLabelRandom("Random");
+static const GffLabel kLabelElevation("Elevation");
+static const GffLabel kLabelMaxDistance("MaxDistance");
+static const GffLabel kLabelMinDistance("MinDistance");
+static const GffLabel kLabelRandomRangeX("RandomRangeX");
+static const GffLabel kLabelRandomRangeY("RandomRangeY");
+static const GffLabel kLabelInterval("Interval");
+static const GffLabel kLabelIntervalVrtn("IntervalVrtn");
+static const GffLabel kLabelPitchVariation("PitchVariation");
+static const GffLabel kLabelVolume("Volume");
+static const GffLabel kLabelVolumeVrtn("VolumeVrtn");
+static const GffLabel kLabelSounds("Sounds");
+static const GffLabel kLabelSound("Sound");
+static const GffLabel kLabelPriority("Priority");
+
 void Sound::loadUTS(const GffStruct &uts) {
-    _tag = boost::to_lower_copy(uts.getString("Tag"));
-    _name = _game->services().resource().strings().get(uts.getInt("LocName"));
-    _blueprintResRef = boost::to_lower_copy(uts.getString("TemplateResRef"));
-    _active = uts.getBool("Active");
-    _continuous = uts.getBool("Continuous");
-    _looping = uts.getBool("Looping");
-    _positional = uts.getBool("Positional");
-    _randomPosition = uts.getBool("RandomPosition");
-    _random = uts.getInt("Random");
-    _elevation = uts.getFloat("Elevation");
-    _maxDistance = uts.getFloat("MaxDistance");
-    _minDistance = uts.getFloat("MinDistance");
-    _randomRangeX = uts.getFloat("RandomRangeX");
-    _randomRangeY = uts.getFloat("RandomRangeY");
-    _interval = uts.getInt("Interval");
-    _intervalVrtn = uts.getInt("IntervalVrtn");
-    _pitchVariation = uts.getFloat("PitchVariation");
-    _volume = uts.getInt("Volume");
-    _volumeVrtn = uts.getInt("VolumeVrtn");
+    _tag = boost::to_lower_copy(uts.getString(kLabelTag));
+    _name = _game->services().resource().strings().get(uts.getInt(kLabelLocName));
+    _blueprintResRef = boost::to_lower_copy(uts.getString(kLabelTemplateResRef));
+    _active = uts.getBool(kLabelActive);
+    _continuous = uts.getBool(kLabelContinuous);
+    _looping = uts.getBool(kLabelLooping);
+    _positional = uts.getBool(kLabelPositional);
+    _randomPosition = uts.getBool(kLabelRandomPosition);
+    _random = uts.getInt(kLabelRandom);
+    _elevation = uts.getFloat(kLabelElevation);
+    _maxDistance = uts.getFloat(kLabelMaxDistance);
+    _minDistance = uts.getFloat(kLabelMinDistance);
+    _randomRangeX = uts.getFloat(kLabelRandomRangeX);
+    _randomRangeY = uts.getFloat(kLabelRandomRangeY);
+    _interval = uts.getInt(kLabelInterval);
+    _intervalVrtn = uts.getInt(kLabelIntervalVrtn);
+    _pitchVariation = uts.getFloat(kLabelPitchVariation);
+    _volume = uts.getInt(kLabelVolume);
+    _volumeVrtn = uts.getInt(kLabelVolumeVrtn);
 
     loadPriorityFromUTS(uts);
 
-    for (auto &soundGffs : uts.getList("Sounds")) {
-        _sounds.push_back(boost::to_lower_copy(soundGffs->getString("Sound")));
+    for (auto &soundGffs : uts.getList(kLabelSounds)) {
+        _sounds.push_back(boost::to_lower_copy(soundGffs->getString(kLabelSound)));
     }
 
     // Unused fields:
@@ -71,7 +94,7 @@ void Sound::loadUTS(const GffStruct &uts) {
 
 void Sound::loadPriorityFromUTS(const GffStruct &uts) {
     shared_ptr<TwoDA> priorityGroups(_game->services().resource().resources().get2DA("prioritygroups"));
-    int priorityIdx = uts.getInt("Priority");
+    int priorityIdx = uts.getInt(kLabelPriority);
     _priority = priorityGroups->getInt(priorityIdx, "priority");
 }
 
@@ -31,27 +31,47 @@ namespace reone {
 
 namespace game {
 
+static const GffLabel kLabelTag("Tag");
+static const GffLabel kLabelTemplateResRef("TemplateResRef");
+static const GffLabel kLabelLocalizedName("LocalizedName");
+static const GffLabel kLabelAutoRemoveKey("AutoRemoveKey");
+static const GffLabel kLabelFaction("Faction");
+static const GffLabel kLabelKeyName("KeyName");
+static const GffLabel kLabelType("Type");
+static const GffLabel kLabelTrapDetectable("TrapDetectable");
+static const GffLabel kLabelTrapDetectDC("TrapDetectDC");
+static const GffLabel kLabelTrapDisarmable("TrapDisarmable");
+static const GffLabel kLabelDisarmDC("DisarmDC");
+static const GffLabel kLabelTrapFlag("TrapFlag");
+static const GffLabel kLabelTrapType("TrapType");
+static const GffLabel kLabelOnDisarm("OnDisarm");
+static const GffLabel kLabelOnTrapTriggered("OnTrapTriggered");
+static const GffLabel kLabelScriptHeartbeat("ScriptHeartbeat");
+static const GffLabel kLabelScriptOnEnter("ScriptOnEnter");
+static const GffLabel kLabelScriptOnExit("ScriptOnExit");
+static const GffLabel kLabelScriptUserDefine("ScriptUserDefine");
+
 void Trigger::loadUTT(const GffStruct &utt) {
-    _tag = boost::to_lower_copy(utt.getString("Tag"));
-    _blueprintResRef = boost::to_lower_copy(utt.getString("TemplateResRef"));
-    _name = _game->services().resource().strings().get(utt.getInt("LocalizedName"));
-    _autoRemoveKey = utt.getBool("AutoRemoveKey"); // always 0, but could be useful
-    _faction = utt.getEnum("Faction", Faction::Invalid);
-    _keyName = utt.getString("KeyName");
-    _triggerType = utt.getInt("Type"); // could be Generic, Area Transition or Trap
-    _trapDetectable = utt.getBool("TrapDetectable");
-    _trapDetectDC = utt.getInt("TrapDetectDC");
-    _trapDisarmable = utt.getBool("TrapDisarmable");
-    _disarmDC = utt.getInt("DisarmDC");
-    _trapFlag = utt.getBool("TrapFlag");
-    _trapType = utt.getInt("TrapType"); // index into traps.2da
+    _tag = boost::to_lower_copy(utt.getString(kLabelTag));
+    _blueprintResRef = boost::to_lower_copy(utt.getString(kLabelTemplateResRef));
+    _name = _game->services().resource().strings().get(utt.getInt(kLabelLocalizedName));
+    _autoRemoveKey = utt.getBool(kLabelAutoRemoveKey); // always 0, but could be useful
+    _faction = utt.getEnum(kLabelFaction, Faction::Invalid);
+    _keyName = utt.getString(kLabelKeyName);
+    _triggerType = utt.getInt(kLabelType); // could be Generic, Area Transition or Trap
+    _trapDetectable = utt.getBool(kLabelTrapDetectable);
+    _trapDetectDC = utt.getInt(kLabelTrapDetectDC);
+    _trapDisarmable = utt.getBool(kLabelTrapDisarmable);
+    _disarmDC = utt.getInt(kLabelDisarmDC);
+    _trapFlag = utt.getBool(kLabelTrapFlag);
+    _trapType = utt.getInt(kLabelTrapType); // index into traps.2da
 
-    _onDisarm = boost::to_lower_copy(utt.getString("OnDisarm")); // always empty, but could be useful
-    _onTrapTriggered = boost::to_lower_copy(utt.getString("OnTrapTriggered")); // always empty, but could be useful
-    _onHeartbeat = boost::to_lower_copy(utt.getString("ScriptHeartbeat"));
-    _onEnter = boost::to_lower_copy(utt.getString("ScriptOnEnter"));
-    _onExit = boost::to_lower_copy(utt.getString("ScriptOnExit"));
-    _onUserDefined = boost::to_lower_copy(utt.getString("ScriptUserDefine"));
+    _onDisarm = boost::to_lower_copy(utt.getString(kLabelOnDisarm)); // always empty, but could be useful
+    _onTrapTriggered = boost::to_lower_copy(utt.getString(kLabelOnTrapTriggered)); // always empty, but could be useful
+    _onHeartbeat = boost::to_lower_copy(utt.getString(kLabelScriptHeartbeat));
+    _onEnter = boost::to_lower_copy(utt.getString(kLabelScriptOnEnter));
+    _onExit = boost::to_lower_copy(utt.getString(kLabelScriptOnExit));
+    _onUserDefined = boost::to_lower_copy(utt.getString(kLabelScriptUserDefine));
 
     // Unused fields:
     //
@@ -31,14 +31,22 @@ namespace reone {
 
 namespace game {
 
+static const GffLabel kLabelAppearance("Appearance");
+static const GffLabel kLabelTemplateResRef("TemplateResRef");
+static const GffLabel kLabelTag("Tag");
+static const GffLabel kLabelLocalizedName("LocalizedName");
+static const GffLabel kLabelHasMapNote("HasMapNote");
+static const GffLabel kLabelMapNote("MapNote");
+static const GffLabel kLabelMapNoteEnabled("MapNoteEnabled");
+
 void Waypoint::loadUTW(const GffStruct &utw) {
-    _appearance = utw.getInt("Appearance");
-    _blueprintResRef = boost::to_lower_copy(utw.getString("TemplateResRef"));
-    _tag = boost::to_lower_copy(utw.getString("Tag"));
-    _name = _game->services().resource().strings().get(utw.getInt("LocalizedName"));
-    _hasMapNote = utw.getBool("HasMapNote");
-    _mapNote = _game->services().resource().strings().get(utw.getInt("MapNote"));
-    _mapNoteEnabled = utw.getInt("MapNoteEnabled");
+    _appearance = utw.getInt(kLabelAppearance);
+    _blueprintResRef = boost::to_lower_copy(utw.getString(kLabelTemplateResRef));
+    _tag = boost::to_lower_copy(utw.getString(kLabelTag));
+    _name = _game->services().resource().strings().get(utw.getInt(kLabelLocalizedName));
+    _hasMapNote = utw.getBool(kLabelHasMapNote);
+    _mapNote = _game->services().resource().strings().get(utw.getInt(kLabelMapNote));
+    _mapNoteEnabled = utw.getInt(kLabelMapNoteEnabled);
 
     // Unused fields:
     //
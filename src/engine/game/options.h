@@ -19,6 +19,7 @@
 
 #include "../audio/options.h"
 #include "../graphics/options.h"
+#include "../resource/options.h"
 
 namespace reone {
 
@@ -29,6 +30,7 @@ struct Options {
     std::string module;
     graphics::GraphicsOptions graphics;
     audio::AudioOptions audio;
+    resource::ResourceOptions resource;
 };
 
 } // namespace game
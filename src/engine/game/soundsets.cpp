@@ -32,12 +32,14 @@ namespace reone {
 namespace game {
 
 SoundSets::SoundSets(AudioFiles &audioFiles, ResourceServices &resource) :
-    MemoryCache(bind(&SoundSets::doGet, this, _1)),
+    MemoryCache(
+        bind(&SoundSets::doGet, this, _1),
+        [&resource](const ResRef &resRef) { return resource.resources().isTransient(resRef, ResourceType::Ssf); }),
     _audioFiles(audioFiles),
     _resource(resource) {
 }
 
-shared_ptr<SoundSet> SoundSets::doGet(string resRef) {
+shared_ptr<SoundSet> SoundSets::doGet(const ResRef &resRef) {
     auto data = _resource.resources().getRaw(resRef, ResourceType::Ssf);
     if (!data) return nullptr;
 
@@ -48,8 +50,7 @@ shared_ptr<SoundSet> SoundSets::doGet(string resRef) {
 
     vector<uint32_t> sounds(ssf.soundSet());
     for (size_t i = 0; i < sounds.size(); ++i) {
-        string soundResRef(boost::to_lower_copy(_resource.strings().getSound(sounds[i])));
-        shared_ptr<AudioStream> sound(_audioFiles.get(soundResRef));
+        shared_ptr<AudioStream> sound(_audioFiles.get(_resource.strings().getSound(sounds[i])));
         if (sound) {
             result->insert(make_pair(static_cast<SoundSetEntry>(i), sound));
         }
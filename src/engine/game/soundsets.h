@@ -27,7 +27,7 @@ namespace reone {
 
 namespace game {
 
-class SoundSets : public MemoryCache<std::string, SoundSet> {
+class SoundSets : public MemoryCache<resource::ResRef, SoundSet> {
 public:
     SoundSets(audio::AudioFiles &audioFiles, resource::ResourceServices &resource);
 
@@ -35,7 +35,7 @@ private:
     audio::AudioFiles &_audioFiles;
     resource::ResourceServices &_resource;
 
-    std::shared_ptr<SoundSet> doGet(std::string resRef);
+    std::shared_ptr<SoundSet> doGet(const resource::ResRef &resRef);
 };
 
 } // namespace game
@@ -18,8 +18,6 @@
 
 #include "lips.h"
 
-#include "../../common/streamutil.h"
-
 #include "lipreader.h"
 
 using namespace std;
@@ -32,16 +30,18 @@ namespace reone {
 namespace graphics {
 
 Lips::Lips(Resources &resources) :
-    MemoryCache(bind(&Lips::doGet, this, _1)),
+    MemoryCache(
+        bind(&Lips::doGet, this, _1),
+        [&resources](const ResRef &resRef) { return resources.isTransient(resRef, ResourceType::Lip); }),
     _resources(resources) {
 }
 
-shared_ptr<LipAnimation> Lips::doGet(string resRef) {
-    shared_ptr<ByteArray> lipData(_resources.getRaw(resRef, ResourceType::Lip));
+shared_ptr<LipAnimation> Lips::doGet(const ResRef &resRef) {
+    ByteView lipData(_resources.getView(resRef, ResourceType::Lip));
     if (!lipData) return nullptr;
 
     LipReader lip;
-    lip.load(wrap(lipData));
+    lip.load(lipData);
 
     return lip.animation();
 }
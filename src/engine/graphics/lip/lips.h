@@ -26,14 +26,14 @@ namespace reone {
 
 namespace graphics {
 
-class Lips : public MemoryCache<std::string, LipAnimation> {
+class Lips : public MemoryCache<resource::ResRef, LipAnimation> {
 public:
     Lips(resource::Resources &resources);
 
 private:
     resource::Resources &_resources;
 
-    std::shared_ptr<LipAnimation> doGet(std::string resRef);
+    std::shared_ptr<LipAnimation> doGet(const resource::ResRef &resRef);
 };
 
 } // namespace graphics
@@ -78,16 +78,26 @@ public:
             std::move(defaultValue);
     }
 
+    /**
+     * Reserves storage for the specified number of frames, in addition to existing ones.
+     */
+    void reserve(int count) {
+        _frames.reserve(_frames.size() + count);
+    }
+
     void addFrame(float time, V value) {
         _frames.push_back(std::make_pair(time, std::move(value)));
     }
 
     void update() {
-        std::sort(_frames.begin(), _frames.end(), [](auto &left, auto &right) {
-            return left.first < right.first;
-        });
+        auto compareTime = [](auto &left, auto &right) { return left.first < right.first; };
+        if (!std::is_sorted(_frames.begin(), _frames.end(), compareTime)) {
+            std::sort(_frames.begin(), _frames.end(), compareTime);
+        }
     }
 
+    const std::vector<std::pair<float, V>> &frames() const { return _frames; }
+
 private:
     std::vector<std::pair<float, V>> _frames;
 };
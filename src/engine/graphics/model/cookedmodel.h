@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2020-2021 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+namespace reone {
+
+namespace graphics {
+
+constexpr char kCookedModelSignature[] = "CMD V1.0";
+
+/**
+ * Shared definitions of the cooked model layout.
+ *
+ * @see CookedModelReader
+ * @see CookedModelWriter
+ */
+struct CookedModel {
+    struct NodeParts {
+        static constexpr int mesh = 1;
+        static constexpr int light = 2;
+        static constexpr int emitter = 4;
+        static constexpr int reference = 8;
+    };
+
+    struct MeshParts {
+        static constexpr int skin = 1;
+        static constexpr int danglyMesh = 2;
+        static constexpr int aabbTree = 4;
+    };
+};
+
+} // namespace graphics
+
+} // namespace reone
@@ -0,0 +1,301 @@
+/*
+ * Copyright (c) 2020-2021 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "cookedmodelreader.h"
+
+#include "cookedmodel.h"
+
+using namespace std;
+
+namespace reone {
+
+namespace graphics {
+
+typedef CookedModel::NodeParts NodeParts;
+typedef CookedModel::MeshParts MeshParts;
+
+CookedModelReader::CookedModelReader(Models *models, Textures *textures) :
+    BinaryReader(8, kCookedModelSignature),
+    _models(models),
+    _textures(textures) {
+}
+
+void CookedModelReader::doLoad() {
+    string name(readLengthPrefixedString());
+    auto classification = static_cast<Model::Classification>(readUint32());
+    string superModelName(readLengthPrefixedString());
+    float animationScale = readFloat();
+    bool affectedByFog = readByte() != 0;
+    shared_ptr<ModelNode> rootNode(readNode(nullptr));
+
+    shared_ptr<Model> superModel;
+    if (!superModelName.empty()) {
+        superModel = _models->get(superModelName);
+    }
+
+    uint32_t numAnimations = readUint32();
+    vector<shared_ptr<Animation>> animations;
+    animations.reserve(numAnimations);
+    for (uint32_t i = 0; i < numAnimations; ++i) {
+        string animName(readLengthPrefixedString());
+        float length = readFloat();
+        float transitionTime = readFloat();
+        uint32_t numEvents = readUint32();
+        vector<Animation::Event> events;
+        events.reserve(numEvents);
+        for (uint32_t j = 0; j < numEvents; ++j) {
+            Animation::Event event;
+            event.time = readFloat();
+            event.name = readLengthPrefixedString();
+            events.push_back(move(event));
+        }
+        shared_ptr<ModelNode> animRootNode(readNode(nullptr));
+        animations.push_back(make_shared<Animation>(
+            move(animName),
+            length,
+            transitionTime,
+            move(animRootNode),
+            move(events)));
+    }
+
+    _model = make_shared<Model>(
+        move(name),
+        classification,
+        move(rootNode),
+        move(animations),
+        move(superModel),
+        animationScale);
+
+    _model->setAffectedByFog(affectedByFog);
+}
+
+shared_ptr<ModelNode> CookedModelReader::readNode(const ModelNode *parent) {
+    string name(readLengthPrefixedString());
+    uint16_t flags = readUint16();
+    glm::vec3 restPosition;
+    readValue(restPosition);
+    glm::quat restOrientation;
+    readValue(restOrientation);
+
+    auto node = make_shared<ModelNode>(
+        move(name),
+        move(restPosition),
+        move(restOrientation),
+        parent);
+
+    node->setFlags(flags);
+
+    uint8_t parts = readByte();
+    if (parts & NodeParts::mesh) {
+        node->setMesh(readMesh());
+    }
+    if (parts & NodeParts::light) {
+        node->setLight(readLight());
+    }
+    if (parts & NodeParts::emitter) {
+        node->setEmitter(readEmitter());
+    }
+    if (parts & NodeParts::reference) {
+        node->setReference(readReference());
+    }
+    readAnimatedProperties(*node);
+
+    uint32_t numChildren = readUint32();
+    for (uint32_t i = 0; i < numChildren; ++i) {
+        node->addChild(readNode(node.get()));
+    }
+
+    return move(node);
+}
+
+shared_ptr<ModelNode::TriangleMesh> CookedModelReader::readMesh() {
+    vector<float> vertices(readFloatArray(static_cast<int>(readUint32())));
+    vector<uint16_t> indices(readUint16Array(static_cast<int>(readUint32())));
+
+    VertexAttributes attributes;
+    attributes.stride = readUint32();
+    attributes.offCoords = readInt32();
+    attributes.offNormals = readInt32();
+    attributes.offTexCoords1 = readInt32();
+    attributes.offTexCoords2 = readInt32();
+    attributes.offTangents = readInt32();
+    attributes.offBitangents = readInt32();
+    attributes.offTanSpaceNormals = readInt32();
+    attributes.offBoneIndices = readInt32();
+    attributes.offBoneWeights = readInt32();
+
+    auto mesh = make_shared<ModelNode::TriangleMesh>();
+    mesh->mesh = make_shared<Mesh>(move(vertices), move(indices), move(attributes));
+
+    uint32_t numMaterials = readUint32();
+    for (uint32_t i = 0; i < numMaterials; ++i) {
+        uint32_t material = readUint32();
+        mesh->materialFaces[material] = readUint32Array(static_cast<int>(readUint32()));
+    }
+
+    readValue(mesh->uvAnimation.dir);
+    readValue(mesh->diffuse);
+    readValue(mesh->ambient);
+    mesh->transparency = readInt32();
+    mesh->render = readByte() != 0;
+    mesh->shadow = readByte() != 0;
+    mesh->backgroundGeometry = readByte() != 0;
+    mesh->saber = readByte() != 0;
+    mesh->diffuseMap = readTexture(TextureUsage::Diffuse);
+    mesh->lightmap = readTexture(TextureUsage::Lightmap);
+    mesh->bumpmap = readTexture(TextureUsage::Bumpmap);
+
+    uint8_t parts = readByte();
+    if (parts & MeshParts::skin) {
+        auto skin = make_shared<ModelNode::Skin>();
+        uint32_t numBones = readUint32();
+        skin->boneNodeName.reserve(numBones);
+        for (uint32_t i = 0; i < numBones; ++i) {
+            skin->boneNodeName.push_back(readLengthPrefixedString());
+        }
+        skin->boneMap = readFloatArray(static_cast<int>(readUint32()));
+        mesh->skin = move(skin);
+    }
+    if (parts & MeshParts::danglyMesh) {
+        auto danglyMesh = make_shared<ModelNode::DanglyMesh>();
+        danglyMesh->displacement = readFloat();
+        danglyMesh->tightness = readFloat();
+        danglyMesh->period = readFloat();
+        uint32_t numConstraints = readUint32();
+        danglyMesh->constraints.resize(numConstraints);
+        for (auto &constraint : danglyMesh->constraints) {
+            constraint.multiplier = readFloat();
+            readValue(constraint.position);
+        }
+        mesh->danglyMesh = move(danglyMesh);
+    }
+    if (parts & MeshParts::aabbTree) {
+        mesh->aabbTree = readAABBTree();
+    }
+
+    return move(mesh);
+}
+
+shared_ptr<ModelNode::Light> CookedModelReader::readLight() {
+    auto light = make_shared<ModelNode::Light>();
+    light->priority = readInt32();
+    light->dynamicType = readInt32();
+    light->ambientOnly = readByte() != 0;
+    light->affectDynamic = readByte() != 0;
+    light->shadow = readByte() != 0;
+    light->flareRadius = readFloat();
+
+    uint32_t numFlares = readUint32();
+    light->flares.resize(numFlares);
+    for (auto &flare : light->flares) {
+        flare.texture = readTexture(TextureUsage::Default);
+        readValue(flare.colorShift);
+        flare.position = readFloat();
+        flare.size = readFloat();
+    }
+
+    return move(light);
+}
+
+shared_ptr<ModelNode::Emitter> CookedModelReader::readEmitter() {
+    auto emitter = make_shared<ModelNode::Emitter>();
+    emitter->updateMode = static_cast<ModelNode::Emitter::UpdateMode>(readUint32());
+    emitter->renderMode = static_cast<ModelNode::Emitter::RenderMode>(readUint32());
+    emitter->blendMode = static_cast<ModelNode::Emitter::BlendMode>(readUint32());
+    emitter->texture = readTexture(TextureUsage::Diffuse);
+    emitter->gridSize.x = readInt32();
+    emitter->gridSize.y = readInt32();
+    emitter->renderOrder = readInt32();
+    emitter->loop = readByte() != 0;
+    emitter->p2p = readByte() != 0;
+    emitter->p2pBezier = readByte() != 0;
+
+    return move(emitter);
+}
+
+shared_ptr<ModelNode::Reference> CookedModelReader::readReference() {
+    string modelResRef(readLengthPrefixedString());
+
+    auto reference = make_shared<ModelNode::Reference>();
+    reference->model = _models->get(modelResRef);
+    reference->reattachable = readByte() != 0;
+
+    return move(reference);
+}
+
+shared_ptr<ModelNode::AABBTree> CookedModelReader::readAABBTree() {
+    if (readByte() == 0) return nullptr;
+
+    auto tree = make_shared<ModelNode::AABBTree>();
+    tree->faceIndex = readInt32();
+    tree->mostSignificantPlane = static_cast<ModelNode::AABBTree::Plane>(readUint32());
+    glm::vec3 min, max;
+    readValue(min);
+    readValue(max);
+    tree->aabb = AABB(min, max);
+    tree->left = readAABBTree();
+    tree->right = readAABBTree();
+
+    return move(tree);
+}
+
+void CookedModelReader::readAnimatedProperties(ModelNode &node) {
+    node.visitAnimatedProperties([this](auto &property) {
+        uint32_t numFrames = readUint32();
+        for (uint32_t i = 0; i < numFrames; ++i) {
+            float time = readFloat();
+            typename remove_reference_t<decltype(property.frames())>::value_type::second_type value;
+            readValue(value);
+            property.addFrame(time, move(value));
+        }
+    });
+}
+
+string CookedModelReader::readLengthPrefixedString() {
+    return readString(static_cast<int>(readUint32()));
+}
+
+shared_ptr<Texture> CookedModelReader::readTexture(TextureUsage usage) {
+    string name(readLengthPrefixedString());
+    return name.empty() ? nullptr : _textures->get(name, usage);
+}
+
+void CookedModelReader::readValue(float &value) {
+    value = readFloat();
+}
+
+void CookedModelReader::readValue(glm::vec2 &value) {
+    value.x = readFloat();
+    value.y = readFloat();
+}
+
+void CookedModelReader::readValue(glm::vec3 &value) {
+    value.x = readFloat();
+    value.y = readFloat();
+    value.z = readFloat();
+}
+
+void CookedModelReader::readValue(glm::quat &value) {
+    value.w = readFloat();
+    value.x = readFloat();
+    value.y = readFloat();
+    value.z = readFloat();
+}
+
+} // namespace graphics
+
+} // namespace reone
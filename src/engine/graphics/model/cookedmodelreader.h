@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2020-2021 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../../resource/format/binreader.h"
+
+#include "../texture/textures.h"
+
+#include "model.h"
+#include "models.h"
+
+namespace reone {
+
+namespace graphics {
+
+/**
+ * Reads a model written by CookedModelWriter.
+ *
+ * @see CookedModelWriter
+ */
+class CookedModelReader : public resource::BinaryReader {
+public:
+    CookedModelReader(Models *models, Textures *textures);
+
+    std::shared_ptr<Model> model() const { return _model; }
+
+private:
+    Models *_models;
+    Textures *_textures;
+
+    std::shared_ptr<Model> _model;
+
+    void doLoad() override;
+
+    std::shared_ptr<ModelNode> readNode(const ModelNode *parent);
+    std::shared_ptr<ModelNode::TriangleMesh> readMesh();
+    std::shared_ptr<ModelNode::Light> readLight();
+    std::shared_ptr<ModelNode::Emitter> readEmitter();
+    std::shared_ptr<ModelNode::Reference> readReference();
+    std::shared_ptr<ModelNode::AABBTree> readAABBTree();
+    void readAnimatedProperties(ModelNode &node);
+
+    std::string readLengthPrefixedString();
+    std::shared_ptr<Texture> readTexture(TextureUsage usage);
+
+    void readValue(float &value);
+    void readValue(glm::vec2 &value);
+    void readValue(glm::vec3 &value);
+    void readValue(glm::quat &value);
+};
+
+} // namespace graphics
+
+} // namespace reone
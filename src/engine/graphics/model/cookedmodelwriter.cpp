@@ -0,0 +1,269 @@
+/*
+ * Copyright (c) 2020-2021 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "cookedmodelwriter.h"
+
+#include "../../common/guardutil.h"
+#include "../../common/streamwriter.h"
+
+#include "cookedmodel.h"
+
+using namespace std;
+
+namespace reone {
+
+namespace graphics {
+
+typedef CookedModel::NodeParts NodeParts;
+typedef CookedModel::MeshParts MeshParts;
+
+static void putString(StreamWriter &writer, const string &str) {
+    writer.putUint32(static_cast<uint32_t>(str.length()));
+    writer.putString(str);
+}
+
+static void putTexture(StreamWriter &writer, const shared_ptr<Texture> &texture) {
+    putString(writer, texture ? texture->name() : "");
+}
+
+static void putValue(StreamWriter &writer, float value) {
+    writer.putFloat(value);
+}
+
+static void putValue(StreamWriter &writer, const glm::vec2 &value) {
+    writer.putFloat(value.x);
+    writer.putFloat(value.y);
+}
+
+static void putValue(StreamWriter &writer, const glm::vec3 &value) {
+    writer.putFloat(value.x);
+    writer.putFloat(value.y);
+    writer.putFloat(value.z);
+}
+
+static void putValue(StreamWriter &writer, const glm::quat &value) {
+    writer.putFloat(value.w);
+    writer.putFloat(value.x);
+    writer.putFloat(value.y);
+    writer.putFloat(value.z);
+}
+
+CookedModelWriter::CookedModelWriter(shared_ptr<Model> model, function<string(const Model &)> getResRef) :
+    _model(move(model)),
+    _getResRef(move(getResRef)) {
+
+    ensureNotNull(_model, "model");
+}
+
+void CookedModelWriter::save(const shared_ptr<ostream> &out) {
+    StreamWriter writer(out);
+    writer.putString(kCookedModelSignature);
+    putString(writer, _model->name());
+    writer.putUint32(static_cast<uint32_t>(_model->classification()));
+    putString(writer, getModelResRef(_model->superModel()));
+    writer.putFloat(_model->animationScale());
+    writer.putByte(_model->isAffectedByFog() ? 1 : 0);
+    writeNode(*_model->rootNode(), writer);
+
+    auto &animations = _model->animations();
+    writer.putUint32(static_cast<uint32_t>(animations.size()));
+    for (auto &anim : animations) {
+        putString(writer, anim.second->name());
+        writer.putFloat(anim.second->length());
+        writer.putFloat(anim.second->transitionTime());
+        writer.putUint32(static_cast<uint32_t>(anim.second->events().size()));
+        for (auto &event : anim.second->events()) {
+            writer.putFloat(event.time);
+            putString(writer, event.name);
+        }
+        writeNode(*anim.second->rootNode(), writer);
+    }
+}
+
+void CookedModelWriter::writeNode(const ModelNode &node, StreamWriter &writer) {
+    putString(writer, node.name());
+    writer.putUint16(node.flags());
+    putValue(writer, node.restPosition());
+    putValue(writer, node.restOrientation());
+
+    uint8_t parts = 0;
+    if (node.isMesh()) parts |= NodeParts::mesh;
+    if (node.isLight()) parts |= NodeParts::light;
+    if (node.isEmitter()) parts |= NodeParts::emitter;
+    if (node.isReference()) parts |= NodeParts::reference;
+    writer.putByte(parts);
+
+    if (node.isMesh()) {
+        writeMesh(*node.mesh(), writer);
+    }
+    if (node.isLight()) {
+        writeLight(*node.light(), writer);
+    }
+    if (node.isEmitter()) {
+        writeEmitter(*node.emitter(), writer);
+    }
+    if (node.isReference()) {
+        writeReference(*node.reference(), writer);
+    }
+    writeAnimatedProperties(node, writer);
+
+    writer.putUint32(static_cast<uint32_t>(node.children().size()));
+    for (auto &child : node.children()) {
+        writeNode(*child, writer);
+    }
+}
+
+void CookedModelWriter::writeMesh(const ModelNode::TriangleMesh &mesh, StreamWriter &writer) {
+    const vector<float> &vertices = mesh.mesh->vertices();
+    writer.putUint32(static_cast<uint32_t>(vertices.size()));
+    for (float value : vertices) {
+        writer.putFloat(value);
+    }
+    const vector<uint16_t> &indices = mesh.mesh->indices();
+    writer.putUint32(static_cast<uint32_t>(indices.size()));
+    for (uint16_t index : indices) {
+        writer.putUint16(index);
+    }
+
+    const VertexAttributes &attributes = mesh.mesh->attributes();
+    writer.putUint32(attributes.stride);
+    writer.putInt32(attributes.offCoords);
+    writer.putInt32(attributes.offNormals);
+    writer.putInt32(attributes.offTexCoords1);
+    writer.putInt32(attributes.offTexCoords2);
+    writer.putInt32(attributes.offTangents);
+    writer.putInt32(attributes.offBitangents);
+    writer.putInt32(attributes.offTanSpaceNormals);
+    writer.putInt32(attributes.offBoneIndices);
+    writer.putInt32(attributes.offBoneWeights);
+
+    writer.putUint32(static_cast<uint32_t>(mesh.materialFaces.size()));
+    for (auto &material : mesh.materialFaces) {
+        writer.putUint32(material.first);
+        writer.putUint32(static_cast<uint32_t>(material.second.size()));
+        for (uint32_t face : material.second) {
+            writer.putUint32(face);
+        }
+    }
+
+    putValue(writer, mesh.uvAnimation.dir);
+    putValue(writer, mesh.diffuse);
+    putValue(writer, mesh.ambient);
+    writer.putInt32(mesh.transparency);
+    writer.putByte(mesh.render ? 1 : 0);
+    writer.putByte(mesh.shadow ? 1 : 0);
+    writer.putByte(mesh.backgroundGeometry ? 1 : 0);
+    writer.putByte(mesh.saber ? 1 : 0);
+    putTexture(writer, mesh.diffuseMap);
+    putTexture(writer, mesh.lightmap);
+    putTexture(writer, mesh.bumpmap);
+
+    uint8_t parts = 0;
+    if (mesh.skin) parts |= MeshParts::skin;
+    if (mesh.danglyMesh) parts |= MeshParts::danglyMesh;
+    if (mesh.aabbTree) parts |= MeshParts::aabbTree;
+    writer.putByte(parts);
+
+    if (mesh.skin) {
+        writer.putUint32(static_cast<uint32_t>(mesh.skin->boneNodeName.size()));
+        for (auto &name : mesh.skin->boneNodeName) {
+            putString(writer, name);
+        }
+        writer.putUint32(static_cast<uint32_t>(mesh.skin->boneMap.size()));
+        for (float bone : mesh.skin->boneMap) {
+            writer.putFloat(bone);
+        }
+    }
+    if (mesh.danglyMesh) {
+        writer.putFloat(mesh.danglyMesh->displacement);
+        writer.putFloat(mesh.danglyMesh->tightness);
+        writer.putFloat(mesh.danglyMesh->period);
+        writer.putUint32(static_cast<uint32_t>(mesh.danglyMesh->constraints.size()));
+        for (auto &constraint : mesh.danglyMesh->constraints) {
+            writer.putFloat(constraint.multiplier);
+            putValue(writer, constraint.position);
+        }
+    }
+    if (mesh.aabbTree) {
+        writeAABBTree(mesh.aabbTree.get(), writer);
+    }
+}
+
+void CookedModelWriter::writeLight(const ModelNode::Light &light, StreamWriter &writer) {
+    writer.putInt32(light.priority);
+    writer.putInt32(light.dynamicType);
+    writer.putByte(light.ambientOnly ? 1 : 0);
+    writer.putByte(light.affectDynamic ? 1 : 0);
+    writer.putByte(light.shadow ? 1 : 0);
+    writer.putFloat(light.flareRadius);
+    writer.putUint32(static_cast<uint32_t>(light.flares.size()));
+    for (auto &flare : light.flares) {
+        putTexture(writer, flare.texture);
+        putValue(writer, flare.colorShift);
+        writer.putFloat(flare.position);
+        writer.putFloat(flare.size);
+    }
+}
+
+void CookedModelWriter::writeEmitter(const ModelNode::Emitter &emitter, StreamWriter &writer) {
+    writer.putUint32(static_cast<uint32_t>(emitter.updateMode));
+    writer.putUint32(static_cast<uint32_t>(emitter.renderMode));
+    writer.putUint32(static_cast<uint32_t>(emitter.blendMode));
+    putTexture(writer, emitter.texture);
+    writer.putInt32(emitter.gridSize.x);
+    writer.putInt32(emitter.gridSize.y);
+    writer.putInt32(emitter.renderOrder);
+    writer.putByte(emitter.loop ? 1 : 0);
+    writer.putByte(emitter.p2p ? 1 : 0);
+    writer.putByte(emitter.p2pBezier ? 1 : 0);
+}
+
+void CookedModelWriter::writeReference(const ModelNode::Reference &reference, StreamWriter &writer) {
+    putString(writer, getModelResRef(reference.model));
+    writer.putByte(reference.reattachable ? 1 : 0);
+}
+
+void CookedModelWriter::writeAABBTree(const ModelNode::AABBTree *tree, StreamWriter &writer) {
+    writer.putByte(tree ? 1 : 0);
+    if (!tree) return;
+
+    writer.putInt32(tree->faceIndex);
+    writer.putUint32(static_cast<uint32_t>(tree->mostSignificantPlane));
+    putValue(writer, tree->aabb.min());
+    putValue(writer, tree->aabb.max());
+    writeAABBTree(tree->left.get(), writer);
+    writeAABBTree(tree->right.get(), writer);
+}
+
+void CookedModelWriter::writeAnimatedProperties(const ModelNode &node, StreamWriter &writer) {
+    node.visitAnimatedProperties([&writer](auto &property) {
+        auto &frames = property.frames();
+        writer.putUint32(static_cast<uint32_t>(frames.size()));
+        for (auto &frame : frames) {
+            writer.putFloat(frame.first);
+            putValue(writer, frame.second);
+        }
+    });
+}
+
+string CookedModelWriter::getModelResRef(const shared_ptr<Model> &model) const {
+    return model ? _getResRef(*model) : "";
+}
+
+} // namespace graphics
+
+} // namespace reone
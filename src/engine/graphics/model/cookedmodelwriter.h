@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2020-2021 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "model.h"
+
+namespace reone {
+
+class StreamWriter;
+
+namespace graphics {
+
+/**
+ * Writes a model in the cooked layout, i.e. the node hierarchy, meshes and
+ * keyframes of the model and its animations, as produced by MdlReader.
+ * Textures and models, that the model depends on, are written by name and
+ * resolved again on load.
+ *
+ * @see CookedModelReader
+ */
+class CookedModelWriter {
+public:
+    /**
+     * @param getResRef function, that returns ResRef of a dependent model
+     */
+    CookedModelWriter(std::shared_ptr<Model> model, std::function<std::string(const Model &)> getResRef);
+
+    void save(const std::shared_ptr<std::ostream> &out);
+
+private:
+    std::shared_ptr<Model> _model;
+    std::function<std::string(const Model &)> _getResRef;
+
+    void writeNode(const ModelNode &node, StreamWriter &writer);
+    void writeMesh(const ModelNode::TriangleMesh &mesh, StreamWriter &writer);
+    void writeLight(const ModelNode::Light &light, StreamWriter &writer);
+    void writeEmitter(const ModelNode::Emitter &emitter, StreamWriter &writer);
+    void writeReference(const ModelNode::Reference &reference, StreamWriter &writer);
+    void writeAABBTree(const ModelNode::AABBTree *tree, StreamWriter &writer);
+    void writeAnimatedProperties(const ModelNode &node, StreamWriter &writer);
+
+    std::string getModelResRef(const std::shared_ptr<Model> &model) const;
+};
+
+} // namespace graphics
+
+} // namespace reone
@@ -29,6 +29,8 @@ using namespace std;
 
 using namespace reone::resource;
 
+namespace endian = boost::endian;
+
 namespace reone {
 
 namespace graphics {
@@ -79,12 +81,11 @@ MdlReader::MdlReader(Models *models, Textures *textures) :
 
     ensureNotNull(models, "models");
     ensureNotNull(textures, "textures");
-
-    initControllerFn();
 }
 
-void MdlReader::load(const shared_ptr<istream> &mdl, const shared_ptr<istream> &mdx) {
-    _mdxReader = make_unique<StreamReader>(mdx);
+void MdlReader::load(const ByteView &mdl, const ByteView &mdx) {
+    _mdxView = mdx;
+    _mdxReader = make_unique<MemoryReader>(_mdxView.data(), _mdxView.size());
 
     BinaryReader::load(mdl);
 }
@@ -188,8 +189,14 @@ shared_ptr<ModelNode> MdlReader::readNode(uint32_t offset, const ModelNode *pare
     ignore(2); // padding
     uint32_t offRootNode = readUint32();
     uint32_t offParentNode = readUint32();
-    vector<float> positionValues(readFloatArray(3));
-    vector<float> orientationValues(readFloatArray(4));
+    float positionValues[3];
+    for (int i = 0; i < 3; ++i) {
+        positionValues[i] = readFloat();
+    }
+    float orientationValues[4];
+    for (int i = 0; i < 4; ++i) {
+        orientationValues[i] = readFloat();
+    }
     ArrayDefinition childArrayDef(readArrayDefinition());
     ArrayDefinition controllerArrayDef(readArrayDefinition());
     ArrayDefinition controllerDataArrayDef(readArrayDefinition());
@@ -226,8 +233,8 @@ shared_ptr<ModelNode> MdlReader::readNode(uint32_t offset, const ModelNode *pare
         _nodeFlags.insert(make_pair(name, flags));
     }
 
-    vector<float> controllerData(readFloatArray(kMdlDataOffset + controllerDataArrayDef.offset, controllerDataArrayDef.count));
-    readControllers(controllerArrayDef.offset, controllerArrayDef.count, controllerData, anim, *node);
+    const float *controllerData = readFloatSpan(kMdlDataOffset + controllerDataArrayDef.offset, controllerDataArrayDef.count, _controllerData);
+    readControllers(controllerArrayDef.offset, controllerArrayDef.count, controllerData, controllerDataArrayDef.count, anim, *node);
 
     vector<uint32_t> childOffsets(readUint32Array(kMdlDataOffset + childArrayDef.offset, childArrayDef.count));
     for (uint32_t offset : childOffsets) {
@@ -347,8 +354,10 @@ shared_ptr<ModelNode::TriangleMesh> MdlReader::readMesh(int flags) {
         }
         seek(kMdlDataOffset + offDanglyVertices);
         for (uint32_t i = 0; i < constraintArrayDef.count; ++i) {
-            vector<float> positionValues(readFloatArray(3));
-            danglyMesh->constraints[i].position = glm::make_vec3(&positionValues[0]);
+            glm::vec3 &position = danglyMesh->constraints[i].position;
+            position.x = readFloat();
+            position.y = readFloat();
+            position.z = readFloat();
         }
 
     } else if (flags & NodeFlags::aabb) {
@@ -429,14 +438,12 @@ shared_ptr<ModelNode::TriangleMesh> MdlReader::readMesh(int flags) {
     }
 
     if (!(flags & NodeFlags::saber) && faceArrayDef.count > 0) {
-        // Faces
+        // Faces: only materials are used, skip normals, plane distances, adjacent faces and indices
         seek(kMdlDataOffset + faceArrayDef.offset);
         for (uint32_t i = 0; i < faceArrayDef.count; ++i) {
-            vector<float> normalValues(readFloatArray(3));
-            float distance = readFloat();
+            ignore(4 * 4);
             uint32_t material = readUint32();
-            vector<uint16_t> adjacentFaces(readUint16Array(3));
-            vector<uint16_t> faceIndices(readUint16Array(3));
+            ignore(6 * 2);
             materialFaces[material].push_back(i);
         }
 
@@ -447,7 +454,7 @@ shared_ptr<ModelNode::TriangleMesh> MdlReader::readMesh(int flags) {
         indices = readUint16Array(3 * faceArrayDef.count);
     }
 
-    auto mesh = make_unique<Mesh>(vertices, indices, attributes);
+    auto mesh = make_unique<Mesh>(move(vertices), move(indices), attributes);
 
     ModelNode::UVAnimation uvAnimation;
     if (animateUV) {
@@ -655,7 +662,19 @@ shared_ptr<ModelNode::Reference> MdlReader::readReference() {
     return move(reference);
 }
 
-void MdlReader::readControllers(uint32_t keyOffset, uint32_t keyCount, const vector<float> &data, bool anim, ModelNode &node) {
+const float *MdlReader::readFloatSpan(size_t offset, int count, vector<float> &buffer) {
+    // Read in place when file contents are in memory and floats need neither swapping nor realignment
+    if (_memoryReader && _endianess == endian::order::native) {
+        const char *bytes = _memoryReader->data(offset, sizeof(float) * count);
+        if (reinterpret_cast<uintptr_t>(bytes) % alignof(float) == 0) {
+            return reinterpret_cast<const float *>(bytes);
+        }
+    }
+    buffer = readFloatArray(offset, count);
+    return buffer.data();
+}
+
+void MdlReader::readControllers(uint32_t keyOffset, uint32_t keyCount, const float *data, uint32_t dataCount, bool anim, ModelNode &node) {
     uint16_t nodeFlags;
     if (anim) {
         nodeFlags = _nodeFlags.find(node.name())->second;
@@ -680,8 +699,11 @@ void MdlReader::readControllers(uint32_t keyOffset, uint32_t keyCount, const vec
         key.dataIndex = dataIndex;
         key.numColumns = numColumns;
 
-        auto fn = getControllerFn(key.type, nodeFlags);
+        ControllerFn fn = getControllerFn(key.type, nodeFlags);
         if (fn) {
+            if (timeIndex + numRows > dataCount || dataIndex + numRows * getControllerRowSize(numColumns) > dataCount) {
+                throw runtime_error(str(boost::format("Controller %d: keyframes out of bounds") % type));
+            }
             fn(key, data, node);
         } else {
             debug(boost::format("Unsupported MDL controller type: %d") % static_cast<int>(key.type), 3);
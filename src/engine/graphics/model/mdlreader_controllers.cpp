@@ -17,8 +17,6 @@
 
 #include "mdlreader.h"
 
-#include "../../common/collectionutil.h"
-
 using namespace std;
 
 using namespace reone::resource;
@@ -29,24 +27,26 @@ namespace graphics {
 
 static constexpr int kFlagBezier = 16;
 
-void MdlReader::initControllerFn() {
-    _genericControllers = unordered_map<uint32_t, ControllerFn> {
+MdlReader::ControllerFn MdlReader::getControllerFn(uint32_t type, int nodeFlags) {
+    // Tables are sorted by controller type
+
+    static const ControllerEntry genericControllers[] {
         { 8, &readPositionController },
         { 20, &readOrientationController },
         { 36, &readScaleController }
     };
-    _meshControllers = unordered_map<uint32_t, ControllerFn> {
+    static const ControllerEntry meshControllers[] {
         { 100, &readSelfIllumColorController },
         { 132, &readAlphaController }
     };
-    _lightControllers = unordered_map<uint32_t, ControllerFn> {
+    static const ControllerEntry lightControllers[] {
         { 76, &readColorController },
         { 88, &readRadiusController },
         { 96, &readShadowRadiusController },
         { 100, &readVerticalDisplacementController },
         { 140, &readMultiplierController }
     };
-    _emitterControllers = unordered_map<uint32_t, ControllerFn> {
+    static const ControllerEntry emitterControllers[] {
         { 80, &readAlphaEndController },
         { 84, &readAlphaStartController },
         { 88, &readBirthrateController },
@@ -96,21 +96,32 @@ void MdlReader::initControllerFn() {
         { 392, &readColorStartController },
         { 502, &readDetonateController }
     };
-}
 
-MdlReader::ControllerFn MdlReader::getControllerFn(uint32_t type, int nodeFlags) {
-    ControllerFn fn;
+    auto find = [&type](const ControllerEntry *first, const ControllerEntry *last) -> ControllerFn {
+        auto it = lower_bound(first, last, type, [](auto &entry, uint32_t value) { return entry.type < value; });
+        return (it != last && it->type == type) ? it->fn : nullptr;
+    };
+
+    ControllerFn fn = nullptr;
     if (nodeFlags & NodeFlags::mesh) {
-        fn = getFromLookupOrNull(_meshControllers, type);
+        fn = find(begin(meshControllers), end(meshControllers));
     } else if (nodeFlags & NodeFlags::light) {
-        fn = getFromLookupOrNull(_lightControllers, type);
+        fn = find(begin(lightControllers), end(lightControllers));
     } else if (nodeFlags & NodeFlags::emitter) {
-        fn = getFromLookupOrNull(_emitterControllers, type);
+        fn = find(begin(emitterControllers), end(emitterControllers));
     }
     if (!fn) {
-        fn = getFromLookupOrNull(_genericControllers, type);
+        fn = find(begin(genericControllers), end(genericControllers));
     }
-    return move(fn);
+    return fn;
+}
+
+int MdlReader::getControllerRowSize(uint8_t numColumns) {
+    // Two columns denote a compressed quaternion, packed into a single float
+    if (numColumns == 2) return 1;
+
+    bool bezier = numColumns & kFlagBezier;
+    return (numColumns & ~kFlagBezier) * (bezier ? 3 : 1);
 }
 
 static inline void ensureNumColumnsEquals(int type, int expected, int actual) {
@@ -119,11 +130,12 @@ static inline void ensureNumColumnsEquals(int type, int expected, int actual) {
     }
 }
 
-void MdlReader::readFloatController(const ControllerKey &key, const vector<float> &data, AnimatedProperty<float> &prop) {
+void MdlReader::readFloatController(const ControllerKey &key, const float *data, AnimatedProperty<float> &prop) {
     bool bezier = key.numColumns & kFlagBezier;
     int numColumns = key.numColumns & ~kFlagBezier;
     ensureNumColumnsEquals(key.type, 1, numColumns);
 
+    prop.reserve(key.numRows);
     for (uint16_t i = 0; i < key.numRows; ++i) {
         float time = data[key.timeIndex + i];
         float value = data[key.dataIndex + (bezier ? 3 : 1) * i];
@@ -132,11 +144,12 @@ void MdlReader::readFloatController(const ControllerKey &key, const vector<float
     prop.update();
 }
 
-void MdlReader::readVectorController(const ControllerKey &key, const vector<float> &data, AnimatedProperty<glm::vec3> &prop) {
+void MdlReader::readVectorController(const ControllerKey &key, const float *data, AnimatedProperty<glm::vec3> &prop) {
     bool bezier = key.numColumns & kFlagBezier;
     int numColumns = key.numColumns & ~kFlagBezier;
     ensureNumColumnsEquals(key.type, 3, numColumns);
 
+    prop.reserve(key.numRows);
     for (uint16_t i = 0; i < key.numRows; ++i) {
         float time = data[key.timeIndex + i];
         glm::vec3 value(glm::make_vec3(&data[key.dataIndex + (bezier ? 9 : 3) * i]));
@@ -145,11 +158,13 @@ void MdlReader::readVectorController(const ControllerKey &key, const vector<floa
     prop.update();
 }
 
-void MdlReader::readPositionController(const ControllerKey &key, const vector<float> &data, ModelNode &node) {
+void MdlReader::readPositionController(const ControllerKey &key, const float *data, ModelNode &node) {
     readVectorController(key, data, node.position());
 }
 
-void MdlReader::readOrientationController(const ControllerKey &key, const vector<float> &data, ModelNode &node) {
+void MdlReader::readOrientationController(const ControllerKey &key, const float *data, ModelNode &node) {
+    node.orientation().reserve(key.numRows);
+
     switch (key.numColumns) {
         case 2:
             for (uint16_t i = 0; i < key.numRows; ++i) {
@@ -201,227 +216,227 @@ void MdlReader::readOrientationController(const ControllerKey &key, const vector
     node.orientation().update();
 }
 
-void MdlReader::readScaleController(const ControllerKey &key, const vector<float> &data, ModelNode &node) {
+void MdlReader::readScaleController(const ControllerKey &key, const float *data, ModelNode &node) {
     readFloatController(key, data, node.scale());
 }
 
-void MdlReader::readSelfIllumColorController(const ControllerKey &key, const vector<float> &data, ModelNode &node) {
+void MdlReader::readSelfIllumColorController(const ControllerKey &key, const float *data, ModelNode &node) {
     readVectorController(key, data, node.selfIllumColor());
 }
 
-void MdlReader::readAlphaController(const ControllerKey &key, const vector<float> &data, ModelNode &node) {
+void MdlReader::readAlphaController(const ControllerKey &key, const float *data, ModelNode &node) {
     readFloatController(key, data, node.alpha());
 }
 
-void MdlReader::readColorController(const ControllerKey &key, const vector<float> &data, ModelNode &node) {
+void MdlReader::readColorController(const ControllerKey &key, const float *data, ModelNode &node) {
     readVectorController(key, data, node.color());
 }
 
-void MdlReader::readRadiusController(const ControllerKey &key, const vector<float> &data, ModelNode &node) {
+void MdlReader::readRadiusController(const ControllerKey &key, const float *data, ModelNode &node) {
     readFloatController(key, data, node.radius());
 }
 
-void MdlReader::readShadowRadiusController(const ControllerKey &key, const vector<float> &data, ModelNode &node) {
+void MdlReader::readShadowRadiusController(const ControllerKey &key, const float *data, ModelNode &node) {
     readFloatController(key, data, node.shadowRadius());
 }
 
-void MdlReader::readVerticalDisplacementController(const ControllerKey &key, const vector<float> &data, ModelNode &node) {
+void MdlReader::readVerticalDisplacementController(const ControllerKey &key, const float *data, ModelNode &node) {
     readFloatController(key, data, node.verticalDisplacement());
 }
 
-void MdlReader::readMultiplierController(const ControllerKey &key, const vector<float> &data, ModelNode &node) {
+void MdlReader::readMultiplierController(const ControllerKey &key, const float *data, ModelNode &node) {
     readFloatController(key, data, node.multiplier());
 }
 
-void MdlReader::readAlphaEndController(const ControllerKey &key, const vector<float> &data, ModelNode &node) {
+void MdlReader::readAlphaEndController(const ControllerKey &key, const float *data, ModelNode &node) {
     readFloatController(key, data, node.alphaEnd());
 }
 
-void MdlReader::readAlphaStartController(const ControllerKey &key, const vector<float> &data, ModelNode &node) {
+void MdlReader::readAlphaStartController(const ControllerKey &key, const float *data, ModelNode &node) {
     readFloatController(key, data, node.alphaStart());
 }
 
-void MdlReader::readBirthrateController(const ControllerKey &key, const vector<float> &data, ModelNode &node) {
+void MdlReader::readBirthrateController(const ControllerKey &key, const float *data, ModelNode &node) {
     readFloatController(key, data, node.birthrate());
 }
 
-void MdlReader::readBounceCoController(const ControllerKey &key, const vector<float> &data, ModelNode &node) {
+void MdlReader::readBounceCoController(const ControllerKey &key, const float *data, ModelNode &node) {
     readFloatController(key, data, node.bounceCo());
 }
 
-void MdlReader::readCombineTimeController(const ControllerKey &key, const vector<float> &data, ModelNode &node) {
+void MdlReader::readCombineTimeController(const ControllerKey &key, const float *data, ModelNode &node) {
     readFloatController(key, data, node.combineTime());
 }
 
-void MdlReader::readDragController(const ControllerKey &key, const vector<float> &data, ModelNode &node) {
+void MdlReader::readDragController(const ControllerKey &key, const float *data, ModelNode &node) {
     readFloatController(key, data, node.drag());
 }
 
-void MdlReader::readFPSController(const ControllerKey &key, const vector<float> &data, ModelNode &node) {
+void MdlReader::readFPSController(const ControllerKey &key, const float *data, ModelNode &node) {
     readFloatController(key, data, node.fps());
 }
 
-void MdlReader::readFrameEndController(const ControllerKey &key, const vector<float> &data, ModelNode &node) {
+void MdlReader::readFrameEndController(const ControllerKey &key, const float *data, ModelNode &node) {
     readFloatController(key, data, node.frameEnd());
 }
 
-void MdlReader::readFrameStartController(const ControllerKey &key, const vector<float> &data, ModelNode &node) {
+void MdlReader::readFrameStartController(const ControllerKey &key, const float *data, ModelNode &node) {
     readFloatController(key, data, node.frameStart());
 }
 
-void MdlReader::readGravController(const ControllerKey &key, const vector<float> &data, ModelNode &node) {
+void MdlReader::readGravController(const ControllerKey &key, const float *data, ModelNode &node) {
     readFloatController(key, data, node.grav());
 }
 
-void MdlReader::readLifeExpController(const ControllerKey &key, const vector<float> &data, ModelNode &node) {
+void MdlReader::readLifeExpController(const ControllerKey &key, const float *data, ModelNode &node) {
     readFloatController(key, data, node.lifeExp());
 }
 
-void MdlReader::readMassController(const ControllerKey &key, const vector<float> &data, ModelNode &node) {
+void MdlReader::readMassController(const ControllerKey &key, const float *data, ModelNode &node) {
     readFloatController(key, data, node.mass());
 }
 
-void MdlReader::readP2PBezier2Controller(const ControllerKey &key, const vector<float> &data, ModelNode &node) {
+void MdlReader::readP2PBezier2Controller(const ControllerKey &key, const float *data, ModelNode &node) {
     readFloatController(key, data, node.p2pBezier2());
 }
 
-void MdlReader::readP2PBezier3Controller(const ControllerKey &key, const vector<float> &data, ModelNode &node) {
+void MdlReader::readP2PBezier3Controller(const ControllerKey &key, const float *data, ModelNode &node) {
     readFloatController(key, data, node.p2pBezier3());
 }
 
-void MdlReader::readParticleRotController(const ControllerKey &key, const vector<float> &data, ModelNode &node) {
+void MdlReader::readParticleRotController(const ControllerKey &key, const float *data, ModelNode &node) {
     readFloatController(key, data, node.particleRot());
 }
 
-void MdlReader::readRandVelController(const ControllerKey &key, const vector<float> &data, ModelNode &node) {
+void MdlReader::readRandVelController(const ControllerKey &key, const float *data, ModelNode &node) {
     readFloatController(key, data, node.randVel());
 }
 
-void MdlReader::readSizeStartController(const ControllerKey &key, const vector<float> &data, ModelNode &node) {
+void MdlReader::readSizeStartController(const ControllerKey &key, const float *data, ModelNode &node) {
     readFloatController(key, data, node.sizeStart());
 }
 
-void MdlReader::readSizeEndController(const ControllerKey &key, const vector<float> &data, ModelNode &node) {
+void MdlReader::readSizeEndController(const ControllerKey &key, const float *data, ModelNode &node) {
     readFloatController(key, data, node.sizeEnd());
 }
 
-void MdlReader::readSizeStartYController(const ControllerKey &key, const vector<float> &data, ModelNode &node) {
+void MdlReader::readSizeStartYController(const ControllerKey &key, const float *data, ModelNode &node) {
     readFloatController(key, data, node.sizeStartY());
 }
 
-void MdlReader::readSizeEndYController(const ControllerKey &key, const vector<float> &data, ModelNode &node) {
+void MdlReader::readSizeEndYController(const ControllerKey &key, const float *data, ModelNode &node) {
     readFloatController(key, data, node.sizeEndY());
 }
 
-void MdlReader::readSpreadController(const ControllerKey &key, const vector<float> &data, ModelNode &node) {
+void MdlReader::readSpreadController(const ControllerKey &key, const float *data, ModelNode &node) {
     readFloatController(key, data, node.spread());
 }
 
-void MdlReader::readThresholdController(const ControllerKey &key, const vector<float> &data, ModelNode &node) {
+void MdlReader::readThresholdController(const ControllerKey &key, const float *data, ModelNode &node) {
     readFloatController(key, data, node.threshold());
 }
 
-void MdlReader::readVelocityController(const ControllerKey &key, const vector<float> &data, ModelNode &node) {
+void MdlReader::readVelocityController(const ControllerKey &key, const float *data, ModelNode &node) {
     readFloatController(key, data, node.velocity());
 }
 
-void MdlReader::readXSizeController(const ControllerKey &key, const vector<float> &data, ModelNode &node) {
+void MdlReader::readXSizeController(const ControllerKey &key, const float *data, ModelNode &node) {
     readFloatController(key, data, node.xSize());
 }
 
-void MdlReader::readYSizeController(const ControllerKey &key, const vector<float> &data, ModelNode &node) {
+void MdlReader::readYSizeController(const ControllerKey &key, const float *data, ModelNode &node) {
     readFloatController(key, data, node.ySize());
 }
 
-void MdlReader::readBlurLengthController(const ControllerKey &key, const vector<float> &data, ModelNode &node) {
+void MdlReader::readBlurLengthController(const ControllerKey &key, const float *data, ModelNode &node) {
     readFloatController(key, data, node.blurLength());
 }
 
-void MdlReader::readLightingDelayController(const ControllerKey &key, const vector<float> &data, ModelNode &node) {
+void MdlReader::readLightingDelayController(const ControllerKey &key, const float *data, ModelNode &node) {
     readFloatController(key, data, node.lightingDelay());
 }
 
-void MdlReader::readLightingRadiusController(const ControllerKey &key, const vector<float> &data, ModelNode &node) {
+void MdlReader::readLightingRadiusController(const ControllerKey &key, const float *data, ModelNode &node) {
     readFloatController(key, data, node.lightingRadius());
 }
 
-void MdlReader::readLightingScaleController(const ControllerKey &key, const vector<float> &data, ModelNode &node) {
+void MdlReader::readLightingScaleController(const ControllerKey &key, const float *data, ModelNode &node) {
     readFloatController(key, data, node.lightingScale());
 }
 
-void MdlReader::readLightingSubDivController(const ControllerKey &key, const vector<float> &data, ModelNode &node) {
+void MdlReader::readLightingSubDivController(const ControllerKey &key, const float *data, ModelNode &node) {
     readFloatController(key, data, node.lightingSubDiv());
 }
 
-void MdlReader::readLightingZigZagController(const ControllerKey &key, const vector<float> &data, ModelNode &node) {
+void MdlReader::readLightingZigZagController(const ControllerKey &key, const float *data, ModelNode &node) {
     readFloatController(key, data, node.lightingZigZag());
 }
 
-void MdlReader::readAlphaMidController(const ControllerKey &key, const vector<float> &data, ModelNode &node) {
+void MdlReader::readAlphaMidController(const ControllerKey &key, const float *data, ModelNode &node) {
     readFloatController(key, data, node.alphaMid());
 }
 
-void MdlReader::readPercentStartController(const ControllerKey &key, const vector<float> &data, ModelNode &node) {
+void MdlReader::readPercentStartController(const ControllerKey &key, const float *data, ModelNode &node) {
     readFloatController(key, data, node.percentStart());
 }
 
-void MdlReader::readPercentMidController(const ControllerKey &key, const vector<float> &data, ModelNode &node) {
+void MdlReader::readPercentMidController(const ControllerKey &key, const float *data, ModelNode &node) {
     readFloatController(key, data, node.percentMid());
 }
 
-void MdlReader::readPercentEndController(const ControllerKey &key, const vector<float> &data, ModelNode &node) {
+void MdlReader::readPercentEndController(const ControllerKey &key, const float *data, ModelNode &node) {
     readFloatController(key, data, node.percentEnd());
 }
 
-void MdlReader::readSizeMidController(const ControllerKey &key, const vector<float> &data, ModelNode &node) {
+void MdlReader::readSizeMidController(const ControllerKey &key, const float *data, ModelNode &node) {
     readFloatController(key, data, node.sizeMid());
 }
 
-void MdlReader::readSizeMidYController(const ControllerKey &key, const vector<float> &data, ModelNode &node) {
+void MdlReader::readSizeMidYController(const ControllerKey &key, const float *data, ModelNode &node) {
     readFloatController(key, data, node.sizeMidY());
 }
 
-void MdlReader::readRandomBirthRateController(const ControllerKey &key, const vector<float> &data, ModelNode &node) {
+void MdlReader::readRandomBirthRateController(const ControllerKey &key, const float *data, ModelNode &node) {
     readFloatController(key, data, node.randomBirthRate());
 }
 
-void MdlReader::readTargetSizeController(const ControllerKey &key, const vector<float> &data, ModelNode &node) {
+void MdlReader::readTargetSizeController(const ControllerKey &key, const float *data, ModelNode &node) {
     readFloatController(key, data, node.targetSize());
 }
 
-void MdlReader::readNumControlPtsController(const ControllerKey &key, const vector<float> &data, ModelNode &node) {
+void MdlReader::readNumControlPtsController(const ControllerKey &key, const float *data, ModelNode &node) {
     readFloatController(key, data, node.numControlPts());
 }
 
-void MdlReader::readControlPtRadiusController(const ControllerKey &key, const vector<float> &data, ModelNode &node) {
+void MdlReader::readControlPtRadiusController(const ControllerKey &key, const float *data, ModelNode &node) {
     readFloatController(key, data, node.controlPtRadius());
 }
 
-void MdlReader::readControlPtDelayController(const ControllerKey &key, const vector<float> &data, ModelNode &node) {
+void MdlReader::readControlPtDelayController(const ControllerKey &key, const float *data, ModelNode &node) {
     readFloatController(key, data, node.controlPtDelay());
 }
 
-void MdlReader::readTangentSpreadController(const ControllerKey &key, const vector<float> &data, ModelNode &node) {
+void MdlReader::readTangentSpreadController(const ControllerKey &key, const float *data, ModelNode &node) {
     readFloatController(key, data, node.tangentSpread());
 }
 
-void MdlReader::readTangentLengthController(const ControllerKey &key, const vector<float> &data, ModelNode &node) {
+void MdlReader::readTangentLengthController(const ControllerKey &key, const float *data, ModelNode &node) {
     readFloatController(key, data, node.tangentLength());
 }
 
-void MdlReader::readColorMidController(const ControllerKey &key, const vector<float> &data, ModelNode &node) {
+void MdlReader::readColorMidController(const ControllerKey &key, const float *data, ModelNode &node) {
     readVectorController(key, data, node.colorMid());
 }
 
-void MdlReader::readColorEndController(const ControllerKey &key, const vector<float> &data, ModelNode &node) {
+void MdlReader::readColorEndController(const ControllerKey &key, const float *data, ModelNode &node) {
     readVectorController(key, data, node.colorEnd());
 }
 
-void MdlReader::readColorStartController(const ControllerKey &key, const vector<float> &data, ModelNode &node) {
+void MdlReader::readColorStartController(const ControllerKey &key, const float *data, ModelNode &node) {
     readVectorController(key, data, node.colorStart());
 }
 
-void MdlReader::readDetonateController(const ControllerKey &key, const vector<float> &data, ModelNode &node) {
+void MdlReader::readDetonateController(const ControllerKey &key, const float *data, ModelNode &node) {
     readFloatController(key, data, node.detonate());
 }
 
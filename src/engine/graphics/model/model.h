@@ -61,6 +61,7 @@ public:
     std::shared_ptr<ModelNode> rootNode() const { return _rootNode; }
     std::shared_ptr<Model> superModel() const { return _superModel; }
     float animationScale() const { return _animationScale; }
+    const std::unordered_map<std::string, std::shared_ptr<Animation>> &animations() const { return _animations; }
     const AABB &aabb() const { return _aabb; }
 
     void setAffectedByFog(bool affected) { _affectedByFog = affected; }
@@ -292,6 +292,16 @@ public:
 
     // END Keyframes
 
+    /**
+     * Calls the visitor with every animated property of this node, in the
+     * order of declaration.
+     */
+    template <class Visitor>
+    void visitAnimatedProperties(Visitor &&visitor) { doVisitAnimatedProperties(*this, visitor); }
+
+    template <class Visitor>
+    void visitAnimatedProperties(Visitor &&visitor) const { doVisitAnimatedProperties(*this, visitor); }
+
 private:
     std::string _name;
     const ModelNode *_parent;
@@ -386,6 +396,68 @@ private:
 
     void computeLocalTransform();
     void computeAbsoluteTransform();
+
+    template <class Node, class Visitor>
+    static void doVisitAnimatedProperties(Node &self, Visitor &visitor) {
+        visitor(self._position);
+        visitor(self._orientation);
+        visitor(self._scale);
+        visitor(self._selfIllumColor);
+        visitor(self._alpha);
+        visitor(self._color);
+        visitor(self._radius);
+        visitor(self._shadowRadius);
+        visitor(self._verticalDisplacement);
+        visitor(self._multiplier);
+        visitor(self._alphaEnd);
+        visitor(self._alphaStart);
+        visitor(self._birthrate);
+        visitor(self._bounceCo);
+        visitor(self._combineTime);
+        visitor(self._drag);
+        visitor(self._fps);
+        visitor(self._frameEnd);
+        visitor(self._frameStart);
+        visitor(self._grav);
+        visitor(self._lifeExp);
+        visitor(self._mass);
+        visitor(self._p2pBezier2);
+        visitor(self._p2pBezier3);
+        visitor(self._particleRot);
+        visitor(self._randVel);
+        visitor(self._sizeStart);
+        visitor(self._sizeEnd);
+        visitor(self._sizeStartY);
+        visitor(self._sizeEndY);
+        visitor(self._spread);
+        visitor(self._threshold);
+        visitor(self._velocity);
+        visitor(self._xSize);
+        visitor(self._ySize);
+        visitor(self._blurLength);
+        visitor(self._lightingDelay);
+        visitor(self._lightingRadius);
+        visitor(self._lightingScale);
+        visitor(self._lightingSubDiv);
+        visitor(self._lightingZigZag);
+        visitor(self._alphaMid);
+        visitor(self._percentStart);
+        visitor(self._percentMid);
+        visitor(self._percentEnd);
+        visitor(self._sizeMid);
+        visitor(self._sizeMidY);
+        visitor(self._randomBirthRate);
+        visitor(self._targetSize);
+        visitor(self._numControlPts);
+        visitor(self._controlPtRadius);
+        visitor(self._controlPtDelay);
+        visitor(self._tangentSpread);
+        visitor(self._tangentLength);
+        visitor(self._colorMid);
+        visitor(self._colorEnd);
+        visitor(self._colorStart);
+        visitor(self._detonate);
+    }
 };
 
 } // namespace graphics
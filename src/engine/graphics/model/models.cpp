@@ -18,11 +18,15 @@
 #include "models.h"
 
 #include "../../common/log.h"
-#include "../../common/streamutil.h"
+#include "../../common/stopwatch.h"
 
 #include "../model/mdlreader.h"
 
+#include "cookedmodelreader.h"
+#include "cookedmodelwriter.h"
+
 using namespace std;
+using namespace std::placeholders;
 
 using namespace reone::resource;
 
@@ -30,34 +34,59 @@ namespace reone {
 
 namespace graphics {
 
-Models::Models(Textures &textures, Resources &resources) : _textures(textures), _resources(resources) {
+Models::Models(Textures &textures, Resources &resources, CookedCache &cookedCache) :
+    _textures(textures),
+    _resources(resources),
+    _cookedCache(cookedCache),
+    _cache(bind(&Models::isTransient, this, _1)) {
 }
 
 void Models::invalidateCache() {
     _cache.clear();
 }
 
-shared_ptr<Model> Models::get(const string &resRef) {
+void Models::beginGeneration(int maxAge) {
+    GenerationalCache<ResRef, Model>::Policy policy;
+    policy.maxAge = maxAge;
+    _cache.beginGeneration(policy);
+}
+
+bool Models::isTransient(const ResRef &resRef) const {
+    return _resources.isTransient(resRef, ResourceType::Mdl) || _resources.isTransient(resRef, ResourceType::Mdx);
+}
+
+shared_ptr<Model> Models::get(const ResRef &resRef) {
     if (resRef.empty()) return nullptr;
 
-    auto maybeModel = _cache.find(resRef);
-    if (maybeModel != _cache.end()) return maybeModel->second;
+    shared_ptr<Model> model;
+    if (_cache.find(resRef, model)) return move(model);
 
-    auto inserted = _cache.insert(make_pair(resRef, doGet(resRef)));
-    return inserted.first->second;
+    return _cache.insert(resRef, doGet(resRef));
 }
 
-shared_ptr<Model> Models::doGet(const string &resRef) {
-    debug("Load model " + resRef);
+shared_ptr<Model> Models::doGet(const ResRef &resRef) {
+    debug("Load model " + resRef.str());
 
-    shared_ptr<ByteArray> mdlData(_resources.getRaw(resRef, ResourceType::Mdl));
-    shared_ptr<ByteArray> mdxData(_resources.getRaw(resRef, ResourceType::Mdx));
+    ByteView mdlData(_resources.getView(resRef, ResourceType::Mdl));
+    ByteView mdxData(_resources.getView(resRef, ResourceType::Mdx));
     shared_ptr<Model> model;
 
     if (mdlData && mdxData) {
-        MdlReader mdl(this, &_textures);
-        mdl.load(wrap(mdlData), wrap(mdxData));
-        model = mdl.model();
+        uint64_t hash = 0;
+        if (_cookedCache.isEnabled()) {
+            hash = CookedCache::getContentHash({ mdlData, mdxData });
+            model = loadCooked(resRef, hash);
+        }
+        if (!model) {
+            Stopwatch stopwatch;
+            MdlReader mdl(this, &_textures);
+            mdl.load(mdlData, mdxData);
+            model = mdl.model();
+            _resources.stats().recordDecode(ResourceType::Mdl, stopwatch.getElapsedTime());
+            if (model && _cookedCache.isEnabled()) {
+                saveCooked(model, hash);
+            }
+        }
         if (model) {
             model->init();
         }
@@ -66,6 +95,39 @@ shared_ptr<Model> Models::doGet(const string &resRef) {
     return move(model);
 }
 
+shared_ptr<Model> Models::loadCooked(const ResRef &resRef, uint64_t hash) {
+    ByteView data(_cookedCache.get("models", hash));
+    if (!data) return nullptr;
+
+    try {
+        CookedModelReader reader(this, &_textures);
+        reader.load(data);
+        return reader.model();
+    } catch (const exception &e) {
+        warn(boost::format("Cannot load cooked model %s: %s") % resRef.str() % e.what());
+        return nullptr;
+    }
+}
+
+void Models::saveCooked(const shared_ptr<Model> &model, uint64_t hash) {
+    auto out = make_shared<ostringstream>();
+    CookedModelWriter writer(model, [this](const Model &dependency) { return getResRef(dependency); });
+    writer.save(out);
+
+    string data(out->str());
+    _cookedCache.put("models", hash, ByteArray(data.begin(), data.end()));
+}
+
+string Models::getResRef(const Model &model) const {
+    string result(model.name());
+    _cache.forEach([&](const ResRef &resRef, const shared_ptr<Model> &cached) {
+        if (cached.get() == &model) {
+            result = resRef.str();
+        }
+    });
+    return move(result);
+}
+
 } // namespace graphics
 
 } // namespace reone
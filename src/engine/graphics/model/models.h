@@ -17,6 +17,8 @@
 
 #pragma once
 
+#include "../../common/cache.h"
+#include "../../resource/cookedcache.h"
 #include "../../resource/resources.h"
 
 #include "../texture/textures.h"
@@ -30,19 +32,38 @@ class Model;
 
 class Models : boost::noncopyable {
 public:
-    Models(Textures &textures, resource::Resources &resources);
+    Models(Textures &textures, resource::Resources &resources, resource::CookedCache &cookedCache);
 
     void invalidateCache();
 
-    std::shared_ptr<Model> get(const std::string &resRef);
+    /**
+     * Evicts models, that are no longer needed, e.g. on module transition.
+     *
+     * @param maxAge number of previous generations, in which an unreferenced model must have been used to be retained
+     */
+    void beginGeneration(int maxAge);
+
+    std::shared_ptr<Model> get(const resource::ResRef &resRef);
 
 private:
     Textures &_textures;
     resource::Resources &_resources;
+    resource::CookedCache &_cookedCache;
+
+    GenerationalCache<resource::ResRef, Model> _cache;
+
+    std::shared_ptr<Model> doGet(const resource::ResRef &resRef);
+
+    bool isTransient(const resource::ResRef &resRef) const;
+
+    // Cooked models
+
+    std::shared_ptr<Model> loadCooked(const resource::ResRef &resRef, uint64_t hash);
+    void saveCooked(const std::shared_ptr<Model> &model, uint64_t hash);
 
-    std::unordered_map<std::string, std::shared_ptr<Model>> _cache;
+    std::string getResRef(const Model &model) const;
 
-    std::shared_ptr<Model> doGet(const std::string &resRef);
+    // END Cooked models
 };
 
 } // namespace graphics
@@ -82,8 +82,10 @@ bool PBRIBL::getDerived(const Texture *envmap, Derived &derived) {
         return true;
     }
 
-    // If derived textures are not found, schedule their computation
-    _envmapQueue.insert(envmap);
+    // If derived textures are not found, schedule their computation, unless envmap pixels are not available yet
+    if (!envmap->isLoading()) {
+        _envmapQueue.insert(envmap);
+    }
 
     return false;
 }
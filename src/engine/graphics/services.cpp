@@ -43,14 +43,14 @@ void GraphicsServices::init() {
     _meshes = make_unique<Meshes>();
     _meshes->init();
 
-    _textures = make_unique<Textures>(*_context, _resource.resources());
+    _textures = make_unique<Textures>(*_context, _resource.resources(), _resource.cookedCache());
     _textures->init();
     _textures->bindDefaults();
 
     _materials = make_unique<Materials>(_resource.resources());
     _materials->init();
 
-    _models = make_unique<Models>(*_textures, _resource.resources());
+    _models = make_unique<Models>(*_textures, _resource.resources(), _resource.cookedCache());
     _walkmeshes = make_unique<Walkmeshes>(_resource.resources());
     _lips = make_unique<Lips>(_resource.resources());
 
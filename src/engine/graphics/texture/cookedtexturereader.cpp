@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2020-2021 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "cookedtexturereader.h"
+
+#include "textureutil.h"
+
+using namespace std;
+
+namespace reone {
+
+namespace graphics {
+
+CookedTextureReader::CookedTextureReader(string resRef, TextureUsage usage, bool headless) :
+    BinaryReader(8, "CTX V1.0"),
+    _resRef(move(resRef)),
+    _usage(usage),
+    _headless(headless) {
+}
+
+void CookedTextureReader::doLoad() {
+    int width = static_cast<int>(readUint32());
+    int height = static_cast<int>(readUint32());
+    auto pixelFormat = static_cast<PixelFormat>(readUint32());
+
+    uint32_t numLayers = readUint32();
+    vector<Texture::Layer> layers;
+    layers.reserve(numLayers);
+    for (uint32_t i = 0; i < numLayers; ++i) {
+        Texture::Layer layer;
+        uint32_t numMipMaps = readUint32();
+        layer.mipMaps.reserve(numMipMaps);
+        for (uint32_t j = 0; j < numMipMaps; ++j) {
+            Texture::MipMap mipMap;
+            mipMap.width = static_cast<int>(readUint32());
+            mipMap.height = static_cast<int>(readUint32());
+            mipMap.pixels = make_shared<ByteArray>(readBytes(static_cast<int>(readUint32())));
+            layer.mipMaps.push_back(move(mipMap));
+        }
+        layers.push_back(move(layer));
+    }
+
+    Texture::Features features;
+    features.envmapTexture = readLengthPrefixedString();
+    features.bumpyShinyTexture = readLengthPrefixedString();
+    features.bumpmapTexture = readLengthPrefixedString();
+    features.bumpMapScaling = readFloat();
+    features.blending = static_cast<Texture::Blending>(readUint32());
+    features.numChars = readInt32();
+    features.fontHeight = readFloat();
+    features.upperLeftCoords = readVectors();
+    features.lowerRightCoords = readVectors();
+    features.waterAlpha = readFloat();
+    features.procedureType = static_cast<Texture::ProcedureType>(readUint32());
+    features.numX = readInt32();
+    features.numY = readInt32();
+    features.fps = readInt32();
+
+    _texture = make_shared<Texture>(_resRef, getTextureProperties(_usage, _headless));
+    if (!_headless) {
+        _texture->init();
+        _texture->bind();
+    }
+    _texture->setPixels(width, height, pixelFormat, move(layers));
+    _texture->setFeatures(move(features));
+}
+
+string CookedTextureReader::readLengthPrefixedString() {
+    return readString(static_cast<int>(readUint32()));
+}
+
+vector<glm::vec3> CookedTextureReader::readVectors() {
+    uint32_t count = readUint32();
+    vector<glm::vec3> result;
+    result.reserve(count);
+    for (uint32_t i = 0; i < count; ++i) {
+        glm::vec3 vec(readFloat(), readFloat(), readFloat());
+        result.push_back(move(vec));
+    }
+    return move(result);
+}
+
+} // namespace graphics
+
+} // namespace reone
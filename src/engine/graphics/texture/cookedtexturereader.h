@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2020-2021 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../../resource/format/binreader.h"
+
+#include "texture.h"
+
+namespace reone {
+
+namespace graphics {
+
+/**
+ * Reads a texture written by CookedTextureWriter.
+ *
+ * @see CookedTextureWriter
+ */
+class CookedTextureReader : public resource::BinaryReader {
+public:
+    /**
+     * @param headless true if texture will not be used for rendering
+     */
+    CookedTextureReader(std::string resRef, TextureUsage usage, bool headless = false);
+
+    std::shared_ptr<Texture> texture() const { return _texture; }
+
+private:
+    std::string _resRef;
+    TextureUsage _usage;
+    bool _headless;
+
+    std::shared_ptr<Texture> _texture;
+
+    void doLoad() override;
+
+    std::string readLengthPrefixedString();
+    std::vector<glm::vec3> readVectors();
+};
+
+} // namespace graphics
+
+} // namespace reone
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2020-2021 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "cookedtexturewriter.h"
+
+#include "../../common/guardutil.h"
+#include "../../common/streamwriter.h"
+
+using namespace std;
+
+namespace reone {
+
+namespace graphics {
+
+CookedTextureWriter::CookedTextureWriter(shared_ptr<Texture> texture) : _texture(move(texture)) {
+    ensureNotNull(_texture, "texture");
+}
+
+static void putString(StreamWriter &writer, const string &str) {
+    writer.putUint32(static_cast<uint32_t>(str.length()));
+    writer.putString(str);
+}
+
+static void putVectors(StreamWriter &writer, const vector<glm::vec3> &vectors) {
+    writer.putUint32(static_cast<uint32_t>(vectors.size()));
+    for (auto &vec : vectors) {
+        writer.putFloat(vec.x);
+        writer.putFloat(vec.y);
+        writer.putFloat(vec.z);
+    }
+}
+
+void CookedTextureWriter::save(const shared_ptr<ostream> &out) {
+    StreamWriter writer(out);
+    writer.putString("CTX V1.0");
+    writer.putUint32(static_cast<uint32_t>(_texture->width()));
+    writer.putUint32(static_cast<uint32_t>(_texture->height()));
+    writer.putUint32(static_cast<uint32_t>(_texture->pixelFormat()));
+
+    const vector<Texture::Layer> &layers = _texture->layers();
+    writer.putUint32(static_cast<uint32_t>(layers.size()));
+    for (auto &layer : layers) {
+        writer.putUint32(static_cast<uint32_t>(layer.mipMaps.size()));
+        for (auto &mipMap : layer.mipMaps) {
+            uint32_t size = mipMap.pixels ? static_cast<uint32_t>(mipMap.pixels->size()) : 0;
+            writer.putUint32(static_cast<uint32_t>(mipMap.width));
+            writer.putUint32(static_cast<uint32_t>(mipMap.height));
+            writer.putUint32(size);
+            if (size > 0) {
+                writer.putBytes(*mipMap.pixels);
+            }
+        }
+    }
+
+    const Texture::Features &features = _texture->features();
+    putString(writer, features.envmapTexture);
+    putString(writer, features.bumpyShinyTexture);
+    putString(writer, features.bumpmapTexture);
+    writer.putFloat(features.bumpMapScaling);
+    writer.putUint32(static_cast<uint32_t>(features.blending));
+    writer.putInt32(features.numChars);
+    writer.putFloat(features.fontHeight);
+    putVectors(writer, features.upperLeftCoords);
+    putVectors(writer, features.lowerRightCoords);
+    writer.putFloat(features.waterAlpha);
+    writer.putUint32(static_cast<uint32_t>(features.procedureType));
+    writer.putInt32(features.numX);
+    writer.putInt32(features.numY);
+    writer.putInt32(features.fps);
+}
+
+} // namespace graphics
+
+} // namespace reone
@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2020-2021 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "texture.h"
+
+namespace reone {
+
+namespace graphics {
+
+/**
+ * Writes a texture in the cooked layout, i.e. decoded pixels of every layer
+ * and mip map, followed by the texture features, so that it can be uploaded
+ * without decoding.
+ *
+ * @see CookedTextureReader
+ */
+class CookedTextureWriter {
+public:
+    CookedTextureWriter(std::shared_ptr<Texture> texture);
+
+    void save(const std::shared_ptr<std::ostream> &out);
+
+private:
+    std::shared_ptr<Texture> _texture;
+};
+
+} // namespace graphics
+
+} // namespace reone
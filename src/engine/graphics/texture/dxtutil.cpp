@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2020-2021 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "dxtutil.h"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+using namespace std;
+
+namespace reone {
+
+namespace graphics {
+
+static constexpr int kBlockSize = 4;
+
+/**
+ * Palette of a color block, with each entry packed as RGBA bytes in memory order.
+ */
+struct ColorPalette {
+    uint32_t entries[4];
+};
+
+static inline uint32_t packRGBA(uint32_t r, uint32_t g, uint32_t b, uint32_t a) {
+    uint8_t bytes[4] {
+        static_cast<uint8_t>(r),
+        static_cast<uint8_t>(g),
+        static_cast<uint8_t>(b),
+        static_cast<uint8_t>(a)
+    };
+    uint32_t result;
+    memcpy(&result, bytes, 4);
+    return result;
+}
+
+static inline uint16_t readUint16LE(const uint8_t *data) {
+    return static_cast<uint16_t>(data[0] | (data[1] << 8));
+}
+
+static inline uint32_t readUint32LE(const uint8_t *data) {
+    return static_cast<uint32_t>(data[0]) |
+        (static_cast<uint32_t>(data[1]) << 8) |
+        (static_cast<uint32_t>(data[2]) << 16) |
+        (static_cast<uint32_t>(data[3]) << 24);
+}
+
+static inline void expandRGB565(uint16_t color, uint32_t &r, uint32_t &g, uint32_t &b) {
+    uint32_t temp = (color >> 11) * 255 + 16;
+    r = (temp / 32 + temp) / 32;
+    temp = ((color & 0x07e0) >> 5) * 255 + 32;
+    g = (temp / 64 + temp) / 64;
+    temp = (color & 0x001f) * 255 + 16;
+    b = (temp / 32 + temp) / 32;
+}
+
+/**
+ * @param allowTransparent true if blocks with color0 <= color1 use three colors and black, as in DXT1
+ */
+static inline ColorPalette getColorPalette(const uint8_t *block, bool allowTransparent) {
+    uint16_t color0 = readUint16LE(block);
+    uint16_t color1 = readUint16LE(block + 2);
+
+    uint32_t r0, g0, b0, r1, g1, b1;
+    expandRGB565(color0, r0, g0, b0);
+    expandRGB565(color1, r1, g1, b1);
+
+    ColorPalette palette;
+    palette.entries[0] = packRGBA(r0, g0, b0, 0);
+    palette.entries[1] = packRGBA(r1, g1, b1, 0);
+
+    if (color0 > color1 || !allowTransparent) {
+        palette.entries[2] = packRGBA((2 * r0 + r1) / 3, (2 * g0 + g1) / 3, (2 * b0 + b1) / 3, 0);
+        palette.entries[3] = packRGBA((r0 + 2 * r1) / 3, (g0 + 2 * g1) / 3, (b0 + 2 * b1) / 3, 0);
+    } else {
+        palette.entries[2] = packRGBA((r0 + r1) / 2, (g0 + g1) / 2, (b0 + b1) / 2, 0);
+        palette.entries[3] = packRGBA(0, 0, 0, 0);
+    }
+
+    return move(palette);
+}
+
+static inline void getAlphaPalette(const uint8_t *block, uint32_t palette[8]) {
+    uint32_t alpha0 = block[0];
+    uint32_t alpha1 = block[1];
+
+    palette[0] = alpha0;
+    palette[1] = alpha1;
+
+    if (alpha0 > alpha1) {
+        for (uint32_t code = 2; code < 8; ++code) {
+            palette[code] = ((8 - code) * alpha0 + (code - 1) * alpha1) / 7;
+        }
+    } else {
+        for (uint32_t code = 2; code < 6; ++code) {
+            palette[code] = ((6 - code) * alpha0 + (code - 1) * alpha1) / 5;
+        }
+        palette[6] = 0;
+        palette[7] = 255;
+    }
+}
+
+static inline uint64_t readAlphaCodes(const uint8_t *block) {
+    uint64_t codes = 0;
+    for (int i = 0; i < 6; ++i) {
+        codes |= static_cast<uint64_t>(block[2 + i]) << (8 * i);
+    }
+    return codes;
+}
+
+void decompressDXT1(int width, int height, const uint8_t *blocks, uint8_t *pixels) {
+    int blockCountX = (width + kBlockSize - 1) / kBlockSize;
+    int blockCountY = (height + kBlockSize - 1) / kBlockSize;
+
+    for (int by = 0; by < blockCountY; ++by) {
+        int rowCount = min(kBlockSize, height - by * kBlockSize);
+
+        for (int bx = 0; bx < blockCountX; ++bx) {
+            const uint8_t *block = blocks + 8ll * (by * blockCountX + bx);
+            ColorPalette palette(getColorPalette(block, true));
+            uint32_t codes = readUint32LE(block + 4);
+            int columnCount = min(kBlockSize, width - bx * kBlockSize);
+
+            for (int y = 0; y < rowCount; ++y) {
+                uint8_t *dest = pixels + 3ll * ((by * kBlockSize + y) * static_cast<size_t>(width) + bx * kBlockSize);
+                uint32_t rowCodes = codes >> (8 * y);
+                for (int x = 0; x < columnCount; ++x) {
+                    memcpy(dest, &palette.entries[(rowCodes >> (2 * x)) & 3], 3);
+                    dest += 3;
+                }
+            }
+        }
+    }
+}
+
+void decompressDXT5(int width, int height, const uint8_t *blocks, uint8_t *pixels) {
+    int blockCountX = (width + kBlockSize - 1) / kBlockSize;
+    int blockCountY = (height + kBlockSize - 1) / kBlockSize;
+
+    for (int by = 0; by < blockCountY; ++by) {
+        int rowCount = min(kBlockSize, height - by * kBlockSize);
+
+        for (int bx = 0; bx < blockCountX; ++bx) {
+            const uint8_t *block = blocks + 16ll * (by * blockCountX + bx);
+
+            uint32_t alphas[8];
+            getAlphaPalette(block, alphas);
+            uint64_t alphaCodes = readAlphaCodes(block);
+
+            ColorPalette palette(getColorPalette(block + 8, false));
+            uint32_t colorCodes = readUint32LE(block + 12);
+
+            // Merge color and alpha of every pixel of the block
+            alignas(16) uint32_t blockPixels[16];
+            for (int i = 0; i < 16; ++i) {
+                uint32_t color = palette.entries[(colorCodes >> (2 * i)) & 3];
+                uint32_t alpha = alphas[(alphaCodes >> (3 * i)) & 7];
+                blockPixels[i] = color | packRGBA(0, 0, 0, alpha);
+            }
+
+            int columnCount = min(kBlockSize, width - bx * kBlockSize);
+            for (int y = 0; y < rowCount; ++y) {
+                uint8_t *dest = pixels + 4ll * ((by * kBlockSize + y) * static_cast<size_t>(width) + bx * kBlockSize);
+#ifdef __SSE2__
+                if (columnCount == kBlockSize) {
+                    _mm_storeu_si128(reinterpret_cast<__m128i *>(dest), _mm_load_si128(reinterpret_cast<const __m128i *>(&blockPixels[4 * y])));
+                    continue;
+                }
+#endif
+                memcpy(dest, &blockPixels[4 * y], 4ll * columnCount);
+            }
+        }
+    }
+}
+
+} // namespace graphics
+
+} // namespace reone
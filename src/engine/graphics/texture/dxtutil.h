@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2020-2021 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+namespace reone {
+
+namespace graphics {
+
+/**
+ * Decompresses DXT1 blocks into tightly packed RGB pixels.
+ *
+ * @param width width of the image in pixels
+ * @param height height of the image in pixels
+ * @param blocks DXT1 blocks, 8 bytes each, in row-major order
+ * @param pixels destination buffer of 3 * width * height bytes
+ */
+void decompressDXT1(int width, int height, const uint8_t *blocks, uint8_t *pixels);
+
+/**
+ * Decompresses DXT5 blocks into tightly packed RGBA pixels.
+ *
+ * @param width width of the image in pixels
+ * @param height height of the image in pixels
+ * @param blocks DXT5 blocks, 16 bytes each, in row-major order
+ * @param pixels destination buffer of 4 * width * height bytes
+ */
+void decompressDXT5(int width, int height, const uint8_t *blocks, uint8_t *pixels);
+
+} // namespace graphics
+
+} // namespace reone
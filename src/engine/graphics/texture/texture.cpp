@@ -311,6 +311,11 @@ void Texture::setPixels(int w, int h, PixelFormat format, vector<Layer> layers)
 
     if (!_properties.headless) {
         refresh();
+
+        // Release CPU copies of pixels, now that the GPU has them
+        if (!_properties.keepPixels) {
+            _layers.clear();
+        }
     }
 }
 
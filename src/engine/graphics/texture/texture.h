@@ -62,6 +62,7 @@ public:
         glm::vec3 borderColor { 1.0f };
         bool cubemap { false }; /**< is this a cube map texture? */
         bool headless { false }; /**< must an OpenGL texture be created? */
+        bool keepPixels { false }; /**< must pixels be kept in memory after upload to the GPU? */
     };
 
     /**
@@ -119,6 +120,11 @@ public:
     bool isAdditive() const;
     bool isGrayscale() const;
 
+    /**
+     * @return true if pixels of this texture are still being decoded in the background
+     */
+    bool isLoading() const { return _loading; }
+
     const std::string &name() const { return _name; }
     int width() const { return _width; }
     int height() const { return _height; }
@@ -134,22 +140,25 @@ public:
 
     /**
      * Sets this texture pixels from multiple images. Texture must be bound, unless it is headless.
+     * Unless the texture is headless or keepPixels is set, pixels are released after upload.
      */
     void setPixels(int w, int h, PixelFormat format, std::vector<Layer> layers);
 
     void setFeatures(Features features);
+    void setLoading(bool loading) { _loading = loading; }
 
 private:
     std::string _name;
     Properties _properties;
 
     bool _inited { false };
+    bool _loading { false };
     uint32_t _textureId { 0 };
 
     int _width { 0 };
     int _height { 0 };
     PixelFormat _pixelFormat { PixelFormat::BGR };
-    std::vector<Layer> _layers; /**< either one for 2D textures, or six for cube maps */
+    std::vector<Layer> _layers; /**< either one for 2D textures, or six for cube maps, empty if pixels are not resident in memory */
     Features _features;
 
     void configure2D();
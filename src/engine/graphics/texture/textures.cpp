@@ -18,11 +18,14 @@
 #include "textures.h"
 
 #include "../../common/log.h"
+#include "../../common/stopwatch.h"
 #include "../../common/streamutil.h"
 
 #include "../services.h"
 #include "../types.h"
 
+#include "cookedtexturereader.h"
+#include "cookedtexturewriter.h"
 #include "curreader.h"
 #include "textureutil.h"
 #include "tgareader.h"
@@ -30,6 +33,7 @@
 #include "txireader.h"
 
 using namespace std;
+using namespace std::placeholders;
 
 using namespace reone::resource;
 
@@ -37,7 +41,64 @@ namespace reone {
 
 namespace graphics {
 
-Textures::Textures(Context &context, Resources &resources) : _context(context), _resources(resources) {
+static constexpr int kNumDecodeThreads = 2;
+static constexpr size_t kUploadBudgetPerFrame = 8 * 1024 * 1024; /**< bytes of pixels to upload per frame */
+static constexpr size_t kRetentionBudget = 256 * 1024 * 1024; /**< estimated bytes of GPU memory of retained unreferenced textures */
+
+static bool isDecodedInBackground(TextureUsage usage) {
+    switch (usage) {
+        case TextureUsage::Diffuse:
+        case TextureUsage::Lightmap:
+        case TextureUsage::EnvironmentMap:
+        case TextureUsage::Bumpmap:
+            return true;
+        default:
+            return false;
+    }
+}
+
+static size_t getPixelsSize(const Texture &texture) {
+    size_t size = 0;
+    for (auto &layer : texture.layers()) {
+        for (auto &mipMap : layer.mipMaps) {
+            if (mipMap.pixels) {
+                size += mipMap.pixels->size();
+            }
+        }
+    }
+    return size;
+}
+
+static size_t getTextureCost(const Texture &texture) {
+    size_t pixelCount = static_cast<size_t>(texture.width()) * texture.height();
+    if (texture.isCubeMap()) {
+        pixelCount *= kNumCubeFaces;
+    }
+    switch (texture.pixelFormat()) {
+        case PixelFormat::DXT1:
+            return pixelCount / 2;
+        case PixelFormat::DXT5:
+        case PixelFormat::Grayscale:
+            return pixelCount;
+        case PixelFormat::RGB:
+        case PixelFormat::BGR:
+            return 3 * pixelCount;
+        default:
+            return 4 * pixelCount;
+    }
+}
+
+Textures::Textures(Context &context, Resources &resources, CookedCache &cookedCache) :
+    _context(context),
+    _resources(resources),
+    _cookedCache(cookedCache),
+    _cache(bind(&Textures::isTransient, this, _1), getTextureCost) {
+}
+
+Textures::~Textures() {
+    // Let pending decoding tasks exit early
+    _cache.clear();
+    _decodePool.reset();
 }
 
 void Textures::init() {
@@ -52,12 +113,28 @@ void Textures::init() {
     _defaultCubemap->init();
     _defaultCubemap->bind();
     _defaultCubemap->clearPixels(1, 1, PixelFormat::RGB);
+
+    _decodePool = make_unique<ThreadPool>(kNumDecodeThreads);
 }
 
 void Textures::invalidateCache() {
     _cache.clear();
 }
 
+void Textures::beginGeneration(int maxAge) {
+    GenerationalCache<ResRef, Texture>::Policy policy;
+    policy.maxAge = maxAge;
+    policy.budget = kRetentionBudget;
+    _cache.beginGeneration(policy);
+}
+
+bool Textures::isTransient(const ResRef &resRef) const {
+    return
+        _resources.isTransient(resRef, ResourceType::Tga) ||
+        _resources.isTransient(resRef, ResourceType::Txi) ||
+        _resources.isTransient(resRef, ResourceType::Tpc);
+}
+
 void Textures::bindDefaults() {
     _context.setActiveTextureUnit(TextureUnits::diffuseMap);
     _default->bind();
@@ -90,54 +167,215 @@ void Textures::bindDefaults() {
     _defaultCubemap->bind();
 }
 
-shared_ptr<Texture> Textures::get(const string &resRef, TextureUsage usage) {
+shared_ptr<Texture> Textures::get(const ResRef &resRef, TextureUsage usage) {
     if (resRef.empty()) return nullptr;
 
-    auto maybeTexture = _cache.find(resRef);
-    if (maybeTexture != _cache.end()) {
-        return maybeTexture->second;
+    shared_ptr<Texture> texture;
+    if (_cache.find(resRef, texture)) return move(texture);
+
+    return _cache.insert(resRef, doGet(resRef, usage));
+}
+
+shared_ptr<Texture> Textures::doGet(const ResRef &resRef, TextureUsage usage) {
+    string name(resRef.str());
+
+    ByteView tgaData, txiData, tpcData;
+    if (!findData(resRef, tgaData, txiData, tpcData)) {
+        warn("Texture not found: " + name);
+        return nullptr;
+    }
+
+    if (_decodePool && isDecodedInBackground(usage)) {
+        return decodeInBackground(name, usage, move(tgaData), move(txiData), move(tpcData));
     }
-    string lcResRef(boost::to_lower_copy(resRef));
-    auto inserted = _cache.insert(make_pair(lcResRef, doGet(lcResRef, usage)));
 
-    return inserted.first->second;
+    shared_ptr<Texture> decoded(decode(name, usage, tgaData, txiData, tpcData));
+    if (!decoded) return nullptr;
+
+    auto texture = make_shared<Texture>(name, getTextureProperties(usage));
+    texture->init();
+    upload(*decoded, *texture);
+
+    return move(texture);
 }
 
-shared_ptr<Texture> Textures::doGet(const string &resRef, TextureUsage usage) {
+shared_ptr<Texture> Textures::decodePixels(const ResRef &resRef, TextureUsage usage) {
+    if (resRef.empty()) return nullptr;
+
+    ByteView tgaData, txiData, tpcData;
+    if (!findData(resRef, tgaData, txiData, tpcData)) return nullptr;
+
+    return decode(resRef.str(), usage, tgaData, txiData, tpcData);
+}
+
+bool Textures::findData(const ResRef &resRef, ByteView &tgaData, ByteView &txiData, ByteView &tpcData) {
+    tgaData = _resources.getView(resRef, ResourceType::Tga, false);
+    if (tgaData) {
+        txiData = _resources.getView(resRef, ResourceType::Txi, false);
+        return true;
+    }
+    tpcData = _resources.getView(resRef, ResourceType::Tpc, false);
+
+    return static_cast<bool>(tpcData);
+}
+
+shared_ptr<Texture> Textures::decode(
+    const string &name,
+    TextureUsage usage,
+    const ByteView &tgaData,
+    const ByteView &txiData,
+    const ByteView &tpcData) {
+
     shared_ptr<Texture> texture;
 
-    shared_ptr<ByteArray> tgaData(_resources.getRaw(resRef, ResourceType::Tga, false));
     if (tgaData) {
-        TgaReader tga(resRef, usage);
-        tga.load(wrap(tgaData));
+        uint64_t hash = 0;
+        if (_cookedCache.isEnabled()) {
+            hash = CookedCache::getContentHash({ tgaData, txiData }, static_cast<uint64_t>(usage));
+            texture = loadCooked(name, usage, hash);
+            if (texture) return move(texture);
+        }
+
+        Stopwatch stopwatch;
+        TgaReader tga(name, usage, true);
+        tga.load(tgaData);
         texture = tga.texture();
+        _resources.stats().recordDecode(ResourceType::Tga, stopwatch.getElapsedTime());
 
         if (texture) {
-            shared_ptr<ByteArray> txiData(_resources.getRaw(resRef, ResourceType::Txi, false));
             if (txiData) {
                 TxiReader txi;
                 txi.load(wrap(txiData));
                 texture->setFeatures(txi.features());
             }
+            if (_cookedCache.isEnabled()) {
+                saveCooked(texture, hash);
+            }
         }
-    }
 
-    if (!texture) {
-        shared_ptr<ByteArray> tpcData(_resources.getRaw(resRef, ResourceType::Tpc, false));
-        if (tpcData) {
-            TpcReader tpc(resRef, usage);
-            tpc.load(wrap(tpcData));
-            texture = tpc.texture();
+    } else if (tpcData) {
+        uint64_t hash = 0;
+        if (_cookedCache.isEnabled()) {
+            hash = CookedCache::getContentHash({ tpcData }, static_cast<uint64_t>(usage));
+            texture = loadCooked(name, usage, hash);
+            if (texture) return move(texture);
+        }
+
+        Stopwatch stopwatch;
+        TpcReader tpc(name, usage, true);
+        tpc.load(tpcData);
+        texture = tpc.texture();
+        _resources.stats().recordDecode(ResourceType::Tpc, stopwatch.getElapsedTime());
+
+        if (texture && _cookedCache.isEnabled()) {
+            saveCooked(texture, hash);
         }
     }
 
-    if (!texture) {
-        warn("Texture not found: " + resRef);
+    return move(texture);
+}
+
+shared_ptr<Texture> Textures::decodeInBackground(
+    const string &name,
+    TextureUsage usage,
+    ByteView tgaData,
+    ByteView txiData,
+    ByteView tpcData) {
+
+    // Features are required immediately, e.g. to resolve environment and bump maps of meshes
+    Texture::Features features;
+    if (txiData) {
+        TxiReader txi;
+        txi.load(wrap(txiData));
+        features = txi.features();
+    } else if (tpcData) {
+        features = TpcReader::readFeatures(tpcData);
     }
 
+    auto texture = make_shared<Texture>(name, getTextureProperties(usage));
+    texture->init();
+    texture->bind();
+    texture->clearPixels(1, 1, PixelFormat::RGB);
+    texture->setFeatures(move(features));
+    texture->setLoading(true);
+
+    // Worker threads must not own the placeholder, as it can only be destroyed on the rendering thread
+    weak_ptr<Texture> weakTexture(texture);
+
+    _decodePool->enqueue([this, name, usage, weakTexture, tgaData, txiData, tpcData]() {
+        if (weakTexture.expired()) return;
+
+        shared_ptr<Texture> decoded;
+        try {
+            decoded = decode(name, usage, tgaData, txiData, tpcData);
+        } catch (const exception &e) {
+            warn(boost::format("Cannot decode texture %s: %s") % name % e.what());
+        }
+
+        lock_guard<mutex> lock(_uploadsMutex);
+        _uploads.push_back(PendingUpload { weakTexture, move(decoded) });
+    });
+
     return move(texture);
 }
 
+void Textures::processUploads() {
+    size_t budget = kUploadBudgetPerFrame;
+
+    while (true) {
+        PendingUpload upload;
+        {
+            lock_guard<mutex> lock(_uploadsMutex);
+            if (_uploads.empty()) break;
+
+            // Always upload at least one texture per frame
+            size_t size = _uploads.front().decoded ? getPixelsSize(*_uploads.front().decoded) : 0;
+            if (size > budget && budget < kUploadBudgetPerFrame) break;
+            budget -= glm::min(size, budget);
+
+            upload = move(_uploads.front());
+            _uploads.pop_front();
+        }
+
+        shared_ptr<Texture> texture(upload.texture.lock());
+        if (!texture) continue;
+
+        if (upload.decoded) {
+            Textures::upload(*upload.decoded, *texture);
+        }
+        texture->setLoading(false);
+    }
+}
+
+void Textures::upload(const Texture &decoded, Texture &texture) {
+    texture.bind();
+    texture.setPixels(decoded.width(), decoded.height(), decoded.pixelFormat(), decoded.layers());
+    texture.setFeatures(decoded.features());
+}
+
+shared_ptr<Texture> Textures::loadCooked(const string &name, TextureUsage usage, uint64_t hash) {
+    ByteView data(_cookedCache.get("textures", hash));
+    if (!data) return nullptr;
+
+    try {
+        CookedTextureReader reader(name, usage, true);
+        reader.load(data);
+        return reader.texture();
+    } catch (const exception &e) {
+        warn(boost::format("Cannot load cooked texture %s: %s") % name % e.what());
+        return nullptr;
+    }
+}
+
+void Textures::saveCooked(const shared_ptr<Texture> &texture, uint64_t hash) {
+    auto out = make_shared<ostringstream>();
+    CookedTextureWriter writer(texture);
+    writer.save(out);
+
+    string data(out->str());
+    _cookedCache.put("textures", hash, ByteArray(data.begin(), data.end()));
+}
+
 } // namespace graphics
 
 } // namespace reone
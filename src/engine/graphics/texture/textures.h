@@ -17,6 +17,9 @@
 
 #pragma once
 
+#include "../../common/cache.h"
+#include "../../common/threadpool.h"
+#include "../../resource/cookedcache.h"
 #include "../../resource/resources.h"
 
 #include "../context.h"
@@ -30,27 +33,99 @@ namespace graphics {
 
 class Textures : boost::noncopyable {
 public:
-    Textures(Context &context, resource::Resources &resources);
+    Textures(Context &context, resource::Resources &resources, resource::CookedCache &cookedCache);
+    ~Textures();
 
     void init();
     void invalidateCache();
 
+    /**
+     * Evicts textures, that are no longer needed, e.g. on module transition.
+     *
+     * @param maxAge number of previous generations, in which an unreferenced texture must have been used to be retained
+     */
+    void beginGeneration(int maxAge);
+
+    /**
+     * Uploads textures, decoded in the background, to the GPU, within the
+     * per-frame budget. Call once per frame from the rendering thread.
+     */
+    void processUploads();
+
     /**
      * Binds default textures to all texture units. Call once per framebuffer.
      */
     void bindDefaults();
 
-    std::shared_ptr<Texture> get(const std::string &resRef, TextureUsage usage = TextureUsage::Default);
+    /**
+     * Textures of world usages (diffuse, lightmap, environment and bump maps)
+     * are decoded in the background: a placeholder texture with the final
+     * features is returned immediately and receives its pixels in
+     * processUploads.
+     */
+    std::shared_ptr<Texture> get(const resource::ResRef &resRef, TextureUsage usage = TextureUsage::Default);
+
+    /**
+     * Decodes the texture anew, without caching it or uploading it to the GPU.
+     * Use when pixels are required, as textures release them after upload.
+     *
+     * @return headless texture, or nullptr if not found
+     */
+    std::shared_ptr<Texture> decodePixels(const resource::ResRef &resRef, TextureUsage usage = TextureUsage::Default);
 
 private:
+    struct PendingUpload {
+        std::weak_ptr<Texture> texture;
+        std::shared_ptr<Texture> decoded; /**< headless texture with decoded pixels, nullptr if decoding failed */
+    };
+
     Context &_context;
     resource::Resources &_resources;
+    resource::CookedCache &_cookedCache;
 
     std::shared_ptr<graphics::Texture> _default;
     std::shared_ptr<graphics::Texture> _defaultCubemap;
-    std::unordered_map<std::string, std::shared_ptr<Texture>> _cache;
+    GenerationalCache<resource::ResRef, Texture> _cache;
+
+    // Background decoding
+
+    std::unique_ptr<ThreadPool> _decodePool;
+    std::deque<PendingUpload> _uploads;
+    std::mutex _uploadsMutex;
+
+    // END Background decoding
+
+    std::shared_ptr<Texture> doGet(const resource::ResRef &resRef, TextureUsage usage);
+
+    bool isTransient(const resource::ResRef &resRef) const;
+
+    bool findData(const resource::ResRef &resRef, ByteView &tgaData, ByteView &txiData, ByteView &tpcData);
+
+    /**
+     * @return headless texture with decoded pixels
+     */
+    std::shared_ptr<Texture> decode(
+        const std::string &name,
+        TextureUsage usage,
+        const ByteView &tgaData,
+        const ByteView &txiData,
+        const ByteView &tpcData);
+
+    std::shared_ptr<Texture> decodeInBackground(
+        const std::string &name,
+        TextureUsage usage,
+        ByteView tgaData,
+        ByteView txiData,
+        ByteView tpcData);
+
+    static void upload(const Texture &decoded, Texture &texture);
+
+    // Cooked textures
+
+    std::shared_ptr<Texture> loadCooked(const std::string &name, TextureUsage usage, uint64_t hash);
+    void saveCooked(const std::shared_ptr<Texture> &texture, uint64_t hash);
 
-    std::shared_ptr<Texture> doGet(const std::string &resRef, TextureUsage usage);
+    // END Cooked textures
 };
 
 } // namespace graphics
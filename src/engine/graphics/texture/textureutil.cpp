@@ -17,7 +17,7 @@
 
 #include "textureutil.h"
 
-#include "s3tc.h"
+#include "dxtutil.h"
 
 using namespace std;
 
@@ -78,6 +78,18 @@ static int getBitsPerPixel(PixelFormat format) {
     }
 }
 
+static constexpr int kRotationTileSize = 32; /**< side of a square tile of pixels, rotated at once */
+
+static void prepareCubeFace(Texture::Layer &layer, int rotation, PixelFormat srcFormat, PixelFormat &destFormat) {
+    // Cube maps only ever use the base mip map level
+    Texture::MipMap &mipMap = layer.mipMaps.front();
+    if (isCompressed(srcFormat)) {
+        decompressMipMap(mipMap, srcFormat, destFormat);
+    }
+    rotateMipMap90(mipMap, getBitsPerPixel(destFormat), rotation);
+    layer.mipMaps.erase(layer.mipMaps.begin() + 1, layer.mipMaps.end());
+}
+
 void prepareCubeMap(vector<Texture::Layer> &layers, PixelFormat srcFormat, PixelFormat &destFormat) {
     static int rotations[] = { 1, 3, 0, 2, 2, 0 };
 
@@ -85,29 +97,30 @@ void prepareCubeMap(vector<Texture::Layer> &layers, PixelFormat srcFormat, Pixel
     if (layerCount != kNumCubeFaces) {
         throw invalid_argument("layer count is invalid");
     }
-
-    swap(layers[0], layers[1]);
-
-    destFormat = srcFormat;
-
-    bool compressed = isCompressed(srcFormat);
     for (int i = 0; i < kNumCubeFaces; ++i) {
-        Texture::Layer &layer = layers[i];
-
-        if (layer.mipMaps.empty()) {
+        if (layers[i].mipMaps.empty()) {
             throw invalid_argument("layer has no mip maps: " + to_string(i));
         }
+    }
 
-        // Cube maps only ever use the base mip map level
-        Texture::MipMap &mipMap = layer.mipMaps.front();
-        if (compressed) {
-            decompressMipMap(mipMap, srcFormat, destFormat);
-        }
-        for (int j = 0; j < rotations[i]; ++j) {
-            rotateMipMap90(mipMap, getBitsPerPixel(destFormat));
-        }
-        layer.mipMaps.erase(layer.mipMaps.begin() + 1, layer.mipMaps.end());
+    swap(layers[0], layers[1]);
+
+    // Faces are independent, process them in parallel
+    PixelFormat faceFormats[kNumCubeFaces];
+    vector<future<void>> faces;
+    for (int i = 1; i < kNumCubeFaces; ++i) {
+        faceFormats[i] = srcFormat;
+        faces.push_back(async(launch::async, [&layers, &faceFormats, i, srcFormat]() {
+            prepareCubeFace(layers[i], rotations[i], srcFormat, faceFormats[i]);
+        }));
+    }
+    faceFormats[0] = srcFormat;
+    prepareCubeFace(layers[0], rotations[0], srcFormat, faceFormats[0]);
+    for (auto &face : faces) {
+        face.get();
     }
+
+    destFormat = faceFormats[0];
 }
 
 void decompressMipMap(Texture::MipMap &mipMap, PixelFormat srcFormat, PixelFormat &destFormat) {
@@ -116,62 +129,67 @@ void decompressMipMap(Texture::MipMap &mipMap, PixelFormat srcFormat, PixelForma
     }
 
     size_t pixelCount = static_cast<size_t>(mipMap.width) * mipMap.height;
-    const uint8_t *srcPixels = reinterpret_cast<const uint8_t *>(mipMap.pixels->data());
-    vector<unsigned long> decompPixels(pixelCount);
-    unsigned long *decompPixelsPtr = &decompPixels[0];
-    bool alpha;
-
-    if (srcFormat == PixelFormat::DXT5) {
-        BlockDecompressImageDXT5(mipMap.width, mipMap.height, srcPixels, decompPixelsPtr);
-        alpha = true;
-    } else {
-        BlockDecompressImageDXT1(mipMap.width, mipMap.height, srcPixels, decompPixelsPtr);
-        alpha = false;
+    size_t blockCount = static_cast<size_t>((mipMap.width + 3) / 4) * ((mipMap.height + 3) / 4);
+    bool alpha = srcFormat == PixelFormat::DXT5;
+    if (mipMap.pixels->size() < blockCount * (alpha ? 16 : 8)) {
+        throw invalid_argument("mipMap is too small");
     }
 
+    const uint8_t *srcPixels = reinterpret_cast<const uint8_t *>(mipMap.pixels->data());
     auto destPixels = make_shared<ByteArray>((alpha ? 4ll : 3ll) * pixelCount);
     uint8_t *destPixelsPtr = reinterpret_cast<uint8_t *>(destPixels->data());
-    decompPixelsPtr = &decompPixels[0];
-
-    for (int i = 0; i < mipMap.width * mipMap.height; ++i) {
-        unsigned long pixel = *(decompPixelsPtr++);
-        *(destPixelsPtr++) = (pixel >> 24) & 0xff;
-        *(destPixelsPtr++) = (pixel >> 16) & 0xff;
-        *(destPixelsPtr++) = (pixel >> 8) & 0xff;
-        if (alpha) {
-            *(destPixelsPtr++) = pixel & 0xff;
-        }
+
+    if (alpha) {
+        decompressDXT5(mipMap.width, mipMap.height, srcPixels, destPixelsPtr);
+    } else {
+        decompressDXT1(mipMap.width, mipMap.height, srcPixels, destPixelsPtr);
     }
 
     mipMap.pixels = move(destPixels);
     destFormat = alpha ? PixelFormat::RGBA : PixelFormat::RGB;
 }
 
-void rotateMipMap90(Texture::MipMap &mipMap, int bpp) {
+void rotateMipMap90(Texture::MipMap &mipMap, int bpp, int times) {
     if (mipMap.width != mipMap.height) {
         throw invalid_argument("mipMap size is invalid");
     }
+    times = ((times % 4) + 4) % 4;
+    if (times == 0) return;
+
     size_t n = mipMap.width;
-    size_t w = n / 2;
-    size_t h = (n + 1) / 2;
-    uint8_t *pixels = reinterpret_cast<uint8_t *>(mipMap.pixels->data());
-
-    for (size_t x = 0; x < w; ++x) {
-        for (size_t y = 0; y < h; ++y) {
-            const size_t d0 = ( y          * n +  x         ) * bpp;
-            const size_t d1 = ((n - 1 - x) * n +  y         ) * bpp;
-            const size_t d2 = ((n - 1 - y) * n + (n - 1 - x)) * bpp;
-            const size_t d3 = ( x          * n + (n - 1 - y)) * bpp;
-
-            for (size_t p = 0; p < static_cast<size_t>(bpp); ++p) {
-                uint8_t tmp = pixels[d0 + p];
-                pixels[d0 + p] = pixels[d1 + p];
-                pixels[d1 + p] = pixels[d2 + p];
-                pixels[d2 + p] = pixels[d3 + p];
-                pixels[d3 + p] = tmp;
+    auto destPixels = make_shared<ByteArray>(mipMap.pixels->size());
+    const uint8_t *src = reinterpret_cast<const uint8_t *>(mipMap.pixels->data());
+    uint8_t *dest = reinterpret_cast<uint8_t *>(destPixels->data());
+
+    // Destination is written in square tiles, so that source reads of a tile stay within a few cache lines
+    for (size_t tileY = 0; tileY < n; tileY += kRotationTileSize) {
+        size_t endY = min(tileY + kRotationTileSize, n);
+        for (size_t tileX = 0; tileX < n; tileX += kRotationTileSize) {
+            size_t endX = min(tileX + kRotationTileSize, n);
+            for (size_t y = tileY; y < endY; ++y) {
+                for (size_t x = tileX; x < endX; ++x) {
+                    size_t srcY, srcX;
+                    switch (times) {
+                        case 1:
+                            srcY = n - 1 - x;
+                            srcX = y;
+                            break;
+                        case 2:
+                            srcY = n - 1 - y;
+                            srcX = n - 1 - x;
+                            break;
+                        default:
+                            srcY = x;
+                            srcX = n - 1 - y;
+                            break;
+                    }
+                    memcpy(dest + (y * n + x) * bpp, src + (srcY * n + srcX) * bpp, bpp);
+                }
             }
         }
     }
+
+    mipMap.pixels = move(destPixels);
 }
 
 } // namespace graphics
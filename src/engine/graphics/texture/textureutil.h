@@ -49,12 +49,13 @@ void prepareCubeMap(std::vector<Texture::Layer> &layers, PixelFormat srcFormat,
 void decompressMipMap(Texture::MipMap &mipMap, PixelFormat srcFormat, PixelFormat &destFormat);
 
 /**
- * Rotates the mip map by 90 degrees.
+ * Rotates the mip map by 90 degrees the specified number of times, in a single pass.
  *
  * @param mipMap mip map to rotate - must be uncompressed
  * @param bpp number of bytes per pixel
+ * @param times number of rotations
  */
-void rotateMipMap90(Texture::MipMap &mipMap, int bpp);
+void rotateMipMap90(Texture::MipMap &mipMap, int bpp, int times = 1);
 
 } // namespace graphics
 
@@ -27,7 +27,8 @@ namespace reone {
 
 namespace graphics {
 
-TgaReader::TgaReader(const string &resRef, TextureUsage usage) : BinaryReader(0), _resRef(resRef), _usage(usage) {
+TgaReader::TgaReader(const string &resRef, TextureUsage usage, bool headless) :
+    BinaryReader(0), _resRef(resRef), _usage(usage), _headless(headless) {
 }
 
 void TgaReader::doLoad() {
@@ -109,9 +110,11 @@ void TgaReader::loadTexture() {
         prepareCubeMap(layers, format, format);
     }
 
-    _texture = make_shared<Texture>(_resRef, getTextureProperties(_usage));
-    _texture->init();
-    _texture->bind();
+    _texture = make_shared<Texture>(_resRef, getTextureProperties(_usage, _headless));
+    if (!_headless) {
+        _texture->init();
+        _texture->bind();
+    }
     _texture->setPixels(_width, _height, format, move(layers));
 }
 
@@ -121,7 +124,7 @@ ByteArray TgaReader::readPixels(int w, int h) {
     }
     int dataSize = (isRGBA() ? (_alpha ? 4 : 3) : 1) * w * h;
 
-    return _reader->getBytes(dataSize);
+    return readBytes(dataSize);
 }
 
 bool TgaReader::isRLE() const {
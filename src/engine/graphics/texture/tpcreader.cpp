@@ -34,6 +34,14 @@ TpcReader::TpcReader(const string &resRef, TextureUsage usage, bool headless) :
     BinaryReader(0), _resRef(resRef), _usage(usage), _headless(headless) {
 }
 
+Texture::Features TpcReader::readFeatures(const ByteView &data) {
+    TpcReader tpc("", TextureUsage::Default, true);
+    tpc._featuresOnly = true;
+    tpc.load(data);
+
+    return move(tpc._features);
+}
+
 void TpcReader::doLoad() {
     uint32_t dataSize = readUint32();
     _compressed = dataSize > 0;
@@ -56,6 +64,12 @@ void TpcReader::doLoad() {
         _dataSize = getMipMapDataSize(w, h);
     }
 
+    if (_featuresOnly) {
+        skipPixels();
+        loadFeatures();
+        return;
+    }
+
     loadPixels();
     loadFeatures();
 
@@ -112,7 +126,7 @@ void TpcReader::loadPixels() {
                 getMipMapSize(i, mipMap.width, mipMap.height);
                 dataSize = getMipMapDataSize(mipMap.width, mipMap.height);
             }
-            mipMap.pixels = make_shared<ByteArray>(_reader->getBytes(dataSize));
+            mipMap.pixels = make_shared<ByteArray>(readBytes(dataSize));
             mipMaps.push_back(move(mipMap));
         }
 
@@ -129,10 +143,26 @@ void TpcReader::loadPixels() {
     }
 }
 
+void TpcReader::skipPixels() {
+    size_t layerSize = 0;
+    for (int i = 0; i < _mipMapCount; ++i) {
+        if (i == 0) {
+            layerSize += _dataSize;
+        } else {
+            int w, h;
+            getMipMapSize(i, w, h);
+            layerSize += getMipMapDataSize(w, h);
+        }
+    }
+    int layerCount = _cubeMap ? 6 : 1;
+
+    seek(glm::min(128 + layerCount * layerSize, _size));
+}
+
 void TpcReader::loadFeatures() {
     size_t pos = tell();
     if (pos < _size) {
-        _txiData = _reader->getBytes(static_cast<int>(_size - pos));
+        _txiData = readBytes(static_cast<int>(_size - pos));
 
         TxiReader txi;
         txi.load(wrap(_txiData));
@@ -32,6 +32,11 @@ public:
      */
     TpcReader(const std::string &resRef, TextureUsage usage, bool headless = false);
 
+    /**
+     * Reads features, embedded into the TPC file, skipping its pixels.
+     */
+    static Texture::Features readFeatures(const ByteView &data);
+
     std::shared_ptr<Texture> texture() const { return _texture; }
     const ByteArray &txiData() const { return _txiData; }
 
@@ -45,6 +50,7 @@ private:
     std::string _resRef;
     TextureUsage _usage;
     bool _headless;
+    bool _featuresOnly { false };
 
     uint32_t _dataSize { 0 };
     bool _compressed { false };
@@ -62,6 +68,7 @@ private:
     void doLoad() override;
 
     void loadPixels();
+    void skipPixels();
     void loadFeatures();
 
     void makeTexture();
@@ -17,8 +17,6 @@
 
 #include "walkmeshes.h"
 
-#include "../../common/streamutil.h"
-
 #include "bwmreader.h"
 
 using namespace std;
@@ -29,30 +27,36 @@ namespace reone {
 
 namespace graphics {
 
-Walkmeshes::Walkmeshes(Resources &resources) : _resources(resources) {
+Walkmeshes::Walkmeshes(Resources &resources) :
+    _resources(resources),
+    _cache([&resources](const ResourceId &id) { return resources.isTransient(id.resRef, id.type); }) {
 }
 
 void Walkmeshes::invalidateCache() {
     _cache.clear();
 }
 
-shared_ptr<Walkmesh> Walkmeshes::get(const string &resRef, ResourceType type) {
-    auto maybeWalkmesh = _cache.find(resRef);
-    if (maybeWalkmesh != _cache.end()) {
-        return maybeWalkmesh->second;
-    }
-    auto inserted = _cache.insert(make_pair(resRef, doGet(resRef, type)));
+void Walkmeshes::beginGeneration(int maxAge) {
+    GenerationalCache<ResourceId, Walkmesh>::Policy policy;
+    policy.maxAge = maxAge;
+    _cache.beginGeneration(policy);
+}
+
+shared_ptr<Walkmesh> Walkmeshes::get(const ResRef &resRef, ResourceType type) {
+    ResourceId id(resRef, type);
+    shared_ptr<Walkmesh> walkmesh;
+    if (_cache.find(id, walkmesh)) return move(walkmesh);
 
-    return inserted.first->second;
+    return _cache.insert(id, doGet(resRef, type));
 }
 
-shared_ptr<Walkmesh> Walkmeshes::doGet(const string &resRef, ResourceType type) {
-    shared_ptr<ByteArray> data(_resources.getRaw(resRef, type));
+shared_ptr<Walkmesh> Walkmeshes::doGet(const ResRef &resRef, ResourceType type) {
+    ByteView data(_resources.getView(resRef, type));
     shared_ptr<Walkmesh> walkmesh;
 
     if (data) {
         BwmReader bwm(_walkableSurfaces);
-        bwm.load(wrap(data));
+        bwm.load(data);
         walkmesh = bwm.walkmesh();
     }
 
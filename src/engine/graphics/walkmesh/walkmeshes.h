@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include "../../common/cache.h"
 #include "../../resource/resources.h"
 #include "../../resource/types.h"
 
@@ -34,17 +35,24 @@ public:
 
     void invalidateCache();
 
-    std::shared_ptr<Walkmesh> get(const std::string &resRef, resource::ResourceType type);
+    /**
+     * Evicts walkmeshes, that are no longer needed, e.g. on module transition.
+     *
+     * @param maxAge number of previous generations, in which an unreferenced walkmesh must have been used to be retained
+     */
+    void beginGeneration(int maxAge);
+
+    std::shared_ptr<Walkmesh> get(const resource::ResRef &resRef, resource::ResourceType type);
 
     void setWalkableSurfaces(std::set<uint32_t> walkableSurfaces) { _walkableSurfaces = std::move(walkableSurfaces); }
 
 private:
     resource::Resources &_resources;
 
-    std::unordered_map<std::string, std::shared_ptr<Walkmesh>> _cache;
+    GenerationalCache<resource::ResourceId, Walkmesh> _cache;
     std::set<uint32_t> _walkableSurfaces;
 
-    std::shared_ptr<Walkmesh> doGet(const std::string &resRef, resource::ResourceType type);
+    std::shared_ptr<Walkmesh> doGet(const resource::ResRef &resRef, resource::ResourceType type);
 };
 
 } // namespace graphics
@@ -41,6 +41,7 @@ static constexpr int kDefaultMusicVolume = 85;
 static constexpr int kDefaultVoiceVolume = 85;
 static constexpr int kDefaultSoundVolume = 85;
 static constexpr int kDefaultMovieVolume = 85;
+static constexpr int kDefaultResourceCacheSize = 512;
 
 Program::Program(int argc, char **argv) : _argc(argc), _argv(argv) {
     ensureNotNull(argv, "argv");
@@ -72,6 +73,9 @@ void Program::initOptions() {
         ("voicevol", po::value<int>()->default_value(kDefaultVoiceVolume), "voice volume in percents")
         ("soundvol", po::value<int>()->default_value(kDefaultSoundVolume), "sound volume in percents")
         ("movievol", po::value<int>()->default_value(kDefaultMovieVolume), "movie volume in percents")
+        ("rescache", po::value<int>()->default_value(kDefaultResourceCacheSize), "resource cache size in megabytes, 0 for unlimited")
+        ("cookcache", po::value<string>(), "path to cooked asset cache directory, disabled if not specified")
+        ("resstats", po::value<string>(), "path to resource access statistics JSON file written on exit, disabled if not specified")
         ("debug", po::value<int>()->default_value(0), "debug log level (0-3)")
         ("debugch", po::value<int>(), "debug channel mask")
         ("logfile", po::value<bool>()->default_value(false), "log to file");
@@ -105,6 +109,9 @@ void Program::loadOptions() {
     _options.audio.voiceVolume = vars["voicevol"].as<int>();
     _options.audio.soundVolume = vars["soundvol"].as<int>();
     _options.audio.movieVolume = vars["movievol"].as<int>();
+    _options.resource.cacheSize = vars["rescache"].as<int>();
+    _options.resource.cookedCachePath = vars.count("cookcache") > 0 ? vars["cookcache"].as<string>() : "";
+    _options.resource.statsPath = vars.count("resstats") > 0 ? vars["resstats"].as<string>() : "";
 
     setDebugLogLevel(vars["debug"].as<int>());
     setLogToFile(vars["logfile"].as<bool>());
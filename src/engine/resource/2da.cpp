@@ -19,6 +19,8 @@
 
 #include <stdexcept>
 
+#include <boost/functional/hash.hpp>
+
 #include "../common/collectionutil.h"
 #include "../common/log.h"
 
@@ -30,12 +32,63 @@ namespace resource {
 
 static constexpr char kCellValueDeleted[] = "****";
 
+TwoDA::TwoDA() {
+    intern("");
+    _deletedValueId = intern(kCellValueDeleted);
+}
+
+uint32_t TwoDA::intern(const string &value) {
+    auto maybeId = _valueIds.find(value);
+    if (maybeId != _valueIds.end()) return maybeId->second;
+
+    uint32_t id = static_cast<uint32_t>(_values.size());
+    _values.push_back(value);
+    _valueIds.insert(make_pair(value, id));
+
+    return id;
+}
+
 void TwoDA::addColumn(string name) {
+    int columnIdx = static_cast<int>(_columns.size());
+    _columnIndices.insert(make_pair(name, columnIdx));
     _columns.push_back(move(name));
+
+    // Cells of existing rows are empty
+    Column column;
+    column.cells.resize(_rowCount, 0);
+    column.ints = make_unique<ParsedColumn<int>>();
+    column.floats = make_unique<ParsedColumn<float>>();
+    column.index = make_unique<CellIndex>();
+    _columnData.push_back(move(column));
+
+    resetCaches();
 }
 
 void TwoDA::add(Row row) {
-    _rows.push_back(move(row));
+    for (size_t i = 0; i < _columnData.size(); ++i) {
+        uint32_t valueId = i < row.values.size() ? intern(row.values[i]) : 0;
+        _columnData[i].cells.push_back(valueId);
+    }
+    ++_rowCount;
+
+    resetCaches();
+}
+
+void TwoDA::resetCaches() {
+    for (auto &column : _columnData) {
+        if (column.ints->done) {
+            column.ints = make_unique<ParsedColumn<int>>();
+        }
+        if (column.floats->done) {
+            column.floats = make_unique<ParsedColumn<float>>();
+        }
+        if (column.index->done) {
+            column.index = make_unique<CellIndex>();
+        }
+    }
+
+    lock_guard<mutex> lock(_compositeIndicesMutex);
+    _compositeIndices.clear();
 }
 
 int TwoDA::indexByCellValue(const string &column, const string &value) const {
@@ -44,18 +97,61 @@ int TwoDA::indexByCellValue(const string &column, const string &value) const {
         warn("2DA: column not found: " + column);
         return -1;
     }
-    for (size_t i = 0; i < _rows.size(); ++i) {
-        if (_rows[i].values[columnIdx] == value) return static_cast<int>(i);
+
+    auto maybeValueId = _valueIds.find(value);
+    if (maybeValueId == _valueIds.end()) return -1;
+
+    const CellIndex &index = getCellIndex(_columnData[columnIdx]);
+    auto maybeRow = index.rows.find(maybeValueId->second);
+
+    return maybeRow != index.rows.end() ? maybeRow->second : -1;
+}
+
+const TwoDA::CellIndex &TwoDA::getCellIndex(const Column &column) const {
+    CellIndex &index = *column.index;
+    call_once(index.buildOnce, [&]() {
+        index.rows.reserve(column.cells.size());
+        for (size_t i = 0; i < column.cells.size(); ++i) {
+            // If a value occurs more than once, the first row wins
+            index.rows.insert(make_pair(column.cells[i], static_cast<int>(i)));
+        }
+        index.done = true;
+    });
+    return index;
+}
+
+size_t TwoDA::CompositeKeyHash::operator()(const vector<uint32_t> &key) const {
+    size_t seed = 0;
+    for (auto &valueId : key) {
+        boost::hash_combine(seed, valueId);
+    }
+    return seed;
+}
+
+shared_ptr<TwoDA::CompositeIndex> TwoDA::getCompositeIndex(const vector<int> &columnIndices) const {
+    lock_guard<mutex> lock(_compositeIndicesMutex);
+
+    auto maybeIndex = _compositeIndices.find(columnIndices);
+    if (maybeIndex != _compositeIndices.end()) return maybeIndex->second;
+
+    auto index = make_shared<CompositeIndex>();
+    index->reserve(_rowCount);
+
+    vector<uint32_t> key(columnIndices.size());
+    for (int i = 0; i < _rowCount; ++i) {
+        for (size_t j = 0; j < columnIndices.size(); ++j) {
+            key[j] = _columnData[columnIndices[j]].cells[i];
+        }
+        index->insert(make_pair(key, i));
     }
+    _compositeIndices.insert(make_pair(columnIndices, index));
 
-    return -1;
+    return move(index);
 }
 
 int TwoDA::getColumnIndex(const string &column) const {
-    for (size_t i = 0; i < _columns.size(); ++i) {
-        if (_columns[i] == column) return static_cast<int>(i);
-    }
-    return -1;
+    auto maybeIndex = _columnIndices.find(column);
+    return maybeIndex != _columnIndices.end() ? maybeIndex->second : -1;
 }
 
 static vector<string> getColumnNames(const vector<pair<string, string>> &values) {
@@ -66,19 +162,18 @@ int TwoDA::indexByCellValues(const vector<pair<string, string>> &values) const {
     vector<string> columns(getColumnNames(values));
     vector<int> columnIndices(getColumnIndices(columns));
 
-    for (size_t i = 0; i < _rows.size(); ++i) {
-        bool match = true;
-        for (size_t j = 0; j < values.size(); ++j) {
-            int columnIdx = columnIndices[j];
-            if (_rows[i].values[columnIdx] != values[j].second) {
-                match = false;
-                break;
-            }
-        }
-        if (match) return static_cast<int>(i);
+    vector<uint32_t> valueIds;
+    for (auto &value : values) {
+        auto maybeValueId = _valueIds.find(value.second);
+        if (maybeValueId == _valueIds.end()) return -1;
+
+        valueIds.push_back(maybeValueId->second);
     }
 
-    return -1;
+    shared_ptr<CompositeIndex> index(getCompositeIndex(columnIndices));
+    auto maybeRow = index->find(valueIds);
+
+    return maybeRow != index->end() ? maybeRow->second : -1;
 }
 
 vector<int> TwoDA::getColumnIndices(const vector<string> &columns) const {
@@ -93,8 +188,12 @@ vector<int> TwoDA::getColumnIndices(const vector<string> &columns) const {
     return move(indices);
 }
 
+const string &TwoDA::getCellValue(int row, int column) const {
+    return _values[_columnData[column].cells[row]];
+}
+
 string TwoDA::getString(int row, const string &column, string defValue) const {
-    if (row < 0 || row >= _rows.size()) {
+    if (row < 0 || row >= _rowCount) {
         warn("2DA: row index out of range: " + to_string(row));
         return move(defValue);
     }
@@ -105,17 +204,58 @@ string TwoDA::getString(int row, const string &column, string defValue) const {
         return move(defValue);
     }
 
-    const string &value = _rows[row].values[columnIdx];
+    uint32_t valueId = _columnData[columnIdx].cells[row];
 
-    if (value == kCellValueDeleted) {
+    if (valueId == _deletedValueId) {
         warn(boost::format("2DA: cell value was deleted: %d %s") % row % column);
         return move(defValue);
     }
 
-    return value;
+    return _values[valueId];
+}
+
+template <class T, class Parse>
+static void parseColumn(const vector<uint32_t> &cells, const vector<string> &values, Parse parse, vector<T> &parsedValues, vector<bool> &parsed) {
+    parsedValues.resize(cells.size());
+    parsed.resize(cells.size(), false);
+
+    for (size_t i = 0; i < cells.size(); ++i) {
+        const string &value = values[cells[i]];
+        if (value.empty() || value == kCellValueDeleted) continue;
+        try {
+            parsedValues[i] = parse(value);
+            parsed[i] = true;
+        } catch (const logic_error &) {
+            // Malformed values are parsed on access, so that they throw
+        }
+    }
+}
+
+const TwoDA::ParsedColumn<int> &TwoDA::getParsedInts(const Column &column) const {
+    ParsedColumn<int> &ints = *column.ints;
+    call_once(ints.parseOnce, [&]() {
+        parseColumn<int>(column.cells, _values, [](const string &value) { return stoi(value); }, ints.values, ints.parsed);
+        ints.done = true;
+    });
+    return ints;
+}
+
+const TwoDA::ParsedColumn<float> &TwoDA::getParsedFloats(const Column &column) const {
+    ParsedColumn<float> &floats = *column.floats;
+    call_once(floats.parseOnce, [&]() {
+        parseColumn<float>(column.cells, _values, [](const string &value) { return stof(value); }, floats.values, floats.parsed);
+        floats.done = true;
+    });
+    return floats;
 }
 
 int TwoDA::getInt(int row, const string &column, int defValue) const {
+    int columnIdx = getColumnIndex(column);
+    if (columnIdx != -1 && row >= 0 && row < _rowCount) {
+        const ParsedColumn<int> &ints = getParsedInts(_columnData[columnIdx]);
+        if (ints.parsed[row]) return ints.values[row];
+    }
+
     const string &value = getString(row, column);
     if (value.empty()) return defValue;
 
@@ -130,6 +270,12 @@ uint32_t TwoDA::getUint(int row, const string &column, uint32_t defValue) const
 }
 
 float TwoDA::getFloat(int row, const string &column, float defValue) const {
+    int columnIdx = getColumnIndex(column);
+    if (columnIdx != -1 && row >= 0 && row < _rowCount) {
+        const ParsedColumn<float> &floats = getParsedFloats(_columnData[columnIdx]);
+        if (floats.parsed[row]) return floats.values[row];
+    }
+
     const string &value = getString(row, column);
     if (value.empty()) return defValue;
 
@@ -137,6 +283,12 @@ float TwoDA::getFloat(int row, const string &column, float defValue) const {
 }
 
 bool TwoDA::getBool(int row, const string &column, bool defValue) const {
+    int columnIdx = getColumnIndex(column);
+    if (columnIdx != -1 && row >= 0 && row < _rowCount) {
+        const ParsedColumn<int> &ints = getParsedInts(_columnData[columnIdx]);
+        if (ints.parsed[row]) return ints.values[row] != 0;
+    }
+
     const string &value = getString(row, column);
     if (value.empty()) return defValue;
 
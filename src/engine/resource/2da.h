@@ -25,6 +25,11 @@ class TwoDaReader;
 
 /**
  * Two-dimensional array, similar to a database table.
+ *
+ * Cells are stored by column, as identifiers of cell values, that are
+ * interned per table. Integer and float values of a column are parsed once,
+ * on first access, and are cached. Lookups by cell values build hash indexes
+ * on first query, over a single column or a combination of columns.
  */
 class TwoDA : boost::noncopyable {
 public:
@@ -32,6 +37,8 @@ public:
         std::vector<std::string> values;
     };
 
+    TwoDA();
+
     void addColumn(std::string name);
     void add(Row row);
 
@@ -46,7 +53,7 @@ public:
     int indexByCellValues(const std::vector<std::pair<std::string, std::string>> &values) const;
 
     int getColumnCount() const { return static_cast<int>(_columns.size()); }
-    int getRowCount() const { return static_cast<int>(_rows.size()); }
+    int getRowCount() const { return _rowCount; }
 
     std::string getString(int row, const std::string &column, std::string defValue = "") const;
     int getInt(int row, const std::string &column, int defValue = 0) const;
@@ -54,16 +61,76 @@ public:
     float getFloat(int row, const std::string &column, float defValue = 0.0f) const;
     bool getBool(int row, const std::string &column, bool defValue = false) const;
 
+    /**
+     * @return raw value of the cell, including deleted values
+     */
+    const std::string &getCellValue(int row, int column) const;
+
     const std::vector<std::string> &columns() const { return _columns; }
-    const std::vector<Row> &rows() const { return _rows; }
 
 private:
+    /**
+     * Values of a column, parsed by a single function. Cells, whose values
+     * are empty, deleted or malformed, are not parsed and are handled on
+     * access, same as if there was no cache.
+     */
+    template <class T>
+    struct ParsedColumn {
+        std::once_flag parseOnce;
+        std::vector<T> values;
+        std::vector<bool> parsed;
+        bool done { false }; /**< parsed at least once, must be reset when cells change */
+    };
+
+    /**
+     * Maps identifiers of cell values to the first row, that contains them.
+     */
+    struct CellIndex {
+        std::once_flag buildOnce;
+        std::unordered_map<uint32_t, int> rows;
+        bool done { false }; /**< built at least once, must be reset when cells change */
+    };
+
+    struct CompositeKeyHash {
+        size_t operator()(const std::vector<uint32_t> &key) const;
+    };
+
+    /**
+     * Maps combinations of identifiers of cell values to the first row, that
+     * contains them.
+     */
+    typedef std::unordered_map<std::vector<uint32_t>, int, CompositeKeyHash> CompositeIndex;
+
+    struct Column {
+        std::vector<uint32_t> cells; /**< identifiers of cell values */
+        std::unique_ptr<ParsedColumn<int>> ints;
+        std::unique_ptr<ParsedColumn<float>> floats;
+        std::unique_ptr<CellIndex> index;
+    };
+
     std::vector<std::string> _columns;
-    std::vector<Row> _rows;
+    std::unordered_map<std::string, int> _columnIndices;
+    std::vector<Column> _columnData;
+    int _rowCount { 0 };
+
+    std::vector<std::string> _values; /**< interned cell values */
+    std::unordered_map<std::string, uint32_t> _valueIds;
+    uint32_t _deletedValueId { 0 };
+
+    mutable std::map<std::vector<int>, std::shared_ptr<CompositeIndex>> _compositeIndices; /**< keyed by column indices */
+    mutable std::mutex _compositeIndicesMutex;
 
     int getColumnIndex(const std::string &column) const;
     std::vector<int> getColumnIndices(const std::vector<std::string> &columns) const;
 
+    uint32_t intern(const std::string &value);
+    void resetCaches();
+
+    const ParsedColumn<int> &getParsedInts(const Column &column) const;
+    const ParsedColumn<float> &getParsedFloats(const Column &column) const;
+    const CellIndex &getCellIndex(const Column &column) const;
+    std::shared_ptr<CompositeIndex> getCompositeIndex(const std::vector<int> &columnIndices) const;
+
     friend class TwoDaReader;
 };
 
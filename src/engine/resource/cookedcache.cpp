@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2020-2021 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "cookedcache.h"
+
+#include "../common/log.h"
+#include "../common/mappedfile.h"
+#include "../common/streamwriter.h"
+
+using namespace std;
+
+namespace fs = boost::filesystem;
+
+namespace reone {
+
+namespace resource {
+
+static constexpr char kSignature[] = "RCK V1.0";
+static constexpr int kSignatureSize = 8;
+
+static constexpr uint64_t kPrime1 = 0x9e3779b185ebca87ull;
+static constexpr uint64_t kPrime2 = 0xc2b2ae3d27d4eb4full;
+static constexpr uint64_t kPrime3 = 0x165667b19e3779f9ull;
+
+static inline uint64_t rotateLeft(uint64_t value, int bits) {
+    return (value << bits) | (value >> (64 - bits));
+}
+
+static inline uint64_t mixWord(uint64_t hash, uint64_t word) {
+    hash ^= rotateLeft(word * kPrime2, 31) * kPrime1;
+    return rotateLeft(hash, 27) * kPrime1 + kPrime3;
+}
+
+CookedCache::CookedCache(fs::path path) : _path(move(path)) {
+}
+
+ByteView CookedCache::get(const string &kind, uint64_t hash) const {
+    if (!isEnabled()) return ByteView();
+
+    fs::path path(getEntryPath(kind, hash));
+    boost::system::error_code ec;
+    uintmax_t fileSize = fs::file_size(path, ec);
+    if (ec || fileSize < kHeaderSize) return ByteView();
+
+    shared_ptr<MappedFile> file;
+    try {
+        file = make_shared<MappedFile>(path);
+    } catch (const exception &e) {
+        warn(boost::format("Cannot read cooked asset %s: %s") % path % e.what());
+        return ByteView();
+    }
+    const char *data = file->data();
+
+    uint64_t entryHash, payloadSize;
+    memcpy(&entryHash, data + kSignatureSize, sizeof(uint64_t));
+    memcpy(&payloadSize, data + kSignatureSize + sizeof(uint64_t), sizeof(uint64_t));
+    boost::endian::little_to_native_inplace(entryHash);
+    boost::endian::little_to_native_inplace(payloadSize);
+
+    if (strncmp(data, kSignature, kSignatureSize) != 0 ||
+        entryHash != hash ||
+        payloadSize != file->size() - kHeaderSize) {
+
+        warn("Invalid cooked asset: " + path.string());
+        return ByteView();
+    }
+
+    return ByteView(file, data + kHeaderSize, static_cast<size_t>(payloadSize));
+}
+
+void CookedCache::put(const string &kind, uint64_t hash, const ByteArray &payload) {
+    if (!isEnabled()) return;
+
+    fs::path path(getEntryPath(kind, hash));
+    fs::path tmpPath(path);
+    tmpPath += fs::unique_path(".%%%%%%%%.tmp");
+
+    try {
+        fs::create_directories(path.parent_path());
+        {
+            auto out = make_shared<fs::ofstream>(tmpPath, ios::binary);
+            StreamWriter writer(out);
+            writer.putString(kSignature);
+            writer.putUint64(hash);
+            writer.putUint64(payload.size());
+            writer.putBytes(8);
+            if (!payload.empty()) {
+                writer.putBytes(payload);
+            }
+            out->close();
+            if (!*out) {
+                throw runtime_error("Cannot write file " + tmpPath.string());
+            }
+        }
+        fs::rename(tmpPath, path);
+    } catch (const exception &e) {
+        boost::system::error_code ec;
+        fs::remove(tmpPath, ec);
+        warn(boost::format("Cannot store cooked asset %s: %s") % path % e.what());
+    }
+}
+
+fs::path CookedCache::getEntryPath(const string &kind, uint64_t hash) const {
+    return _path / kind / str(boost::format("%016x") % hash);
+}
+
+uint64_t CookedCache::getContentHash(initializer_list<ByteView> sources, uint64_t seed) {
+    uint64_t hash = kPrime3 ^ (seed * kPrime1);
+
+    for (auto &source : sources) {
+        const char *data = source.data();
+        size_t size = source.size();
+        hash = mixWord(hash, size);
+
+        size_t numWords = size / sizeof(uint64_t);
+        for (size_t i = 0; i < numWords; ++i) {
+            uint64_t word;
+            memcpy(&word, data + i * sizeof(uint64_t), sizeof(uint64_t));
+            hash = mixWord(hash, word);
+        }
+        size_t tailSize = size % sizeof(uint64_t);
+        if (tailSize > 0) {
+            uint64_t word = 0;
+            memcpy(&word, data + numWords * sizeof(uint64_t), tailSize);
+            hash = mixWord(hash, word);
+        }
+    }
+
+    hash ^= hash >> 33;
+    hash *= kPrime2;
+    hash ^= hash >> 29;
+    hash *= kPrime3;
+    hash ^= hash >> 32;
+
+    return hash;
+}
+
+} // namespace resource
+
+} // namespace reone
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2020-2021 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../common/byteview.h"
+#include "../common/types.h"
+
+namespace reone {
+
+namespace resource {
+
+/**
+ * Opt-in on-disk cache of cooked assets, i.e. assets post-processed into a
+ * ready-to-use binary layout. Entries are keyed by a content hash of the
+ * source bytes, so that modified sources never hit stale entries, and are
+ * grouped into a subdirectory per kind of asset.
+ *
+ * Entry layout, all integers are little-endian:
+ * - header, kHeaderSize bytes: signature "RCK V1.0", uint64 content hash,
+ *   uint64 payload size, 8 reserved bytes
+ * - payload, in the format of the kind of asset
+ *
+ * The cache is best-effort: failures to read or write an entry are logged
+ * and treated as a cache miss.
+ */
+class CookedCache : boost::noncopyable {
+public:
+    static constexpr int kHeaderSize = 32;
+
+    /**
+     * @param path cache directory, empty to disable the cache
+     */
+    CookedCache(boost::filesystem::path path = boost::filesystem::path());
+
+    /**
+     * @return view of the payload of the matching entry, sharing ownership of
+     *         the memory-mapped entry file, or an empty view if there is no
+     *         valid entry
+     */
+    ByteView get(const std::string &kind, uint64_t hash) const;
+
+    /**
+     * Stores an entry, replacing the existing one. The entry file is written
+     * under a temporary name and then renamed, so that concurrent readers
+     * never observe a partial entry.
+     */
+    void put(const std::string &kind, uint64_t hash, const ByteArray &payload);
+
+    bool isEnabled() const { return !_path.empty(); }
+
+    /**
+     * @param seed value mixed into the hash, e.g. to separate variants of an asset cooked from the same sources
+     * @return 64-bit content hash of the specified views
+     */
+    static uint64_t getContentHash(std::initializer_list<ByteView> sources, uint64_t seed = 0);
+
+private:
+    boost::filesystem::path _path;
+
+    boost::filesystem::path getEntryPath(const std::string &kind, uint64_t hash) const;
+};
+
+} // namespace resource
+
+} // namespace reone
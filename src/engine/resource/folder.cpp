@@ -34,6 +34,7 @@ void Folder::load(const fs::path &path) {
         throw runtime_error("Folder not found: " + path.string());
     }
     loadDirectory(path);
+    indexResources();
     _path = path;
 }
 
@@ -46,16 +47,30 @@ void Folder::loadDirectory(const fs::path &path) {
         }
 
         string resRef(childPath.filename().replace_extension("").string());
-        boost::to_lower(resRef);
 
         string ext(childPath.extension().string().substr(1));
         boost::to_lower(ext);
 
         Resource res;
+        res.resRef = resRef;
         res.path = childPath;
         res.type = getResTypeByExt(ext);
 
-        _resources.insert(make_pair(resRef, res));
+        _resources.push_back(move(res));
+    }
+}
+
+void Folder::indexResources() {
+    _index.clear();
+    _index.reserve(static_cast<int>(_resources.size()));
+
+    int idx;
+    for (size_t i = 0; i < _resources.size(); ++i) {
+        // If a resource is present in several subdirectories, the first one found wins
+        ResourceId id(_resources[i].resRef, _resources[i].type);
+        if (!_index.find(id, idx)) {
+            _index.add(id, static_cast<int>(i));
+        }
     }
 }
 
@@ -63,18 +78,25 @@ bool Folder::supports(ResourceType type) const {
     return true;
 }
 
-shared_ptr<ByteArray> Folder::find(const string &resRef, ResourceType type) {
-    fs::path path;
-    for (auto &res : _resources) {
-        if (res.first == resRef && res.second.type == type) {
-            path = res.second.path;
-            break;
-        }
-    }
-    if (path.empty()) {
-        return shared_ptr<ByteArray>();
+shared_ptr<ByteArray> Folder::find(const ResRef &resRef, ResourceType type) {
+    int idx;
+    if (!_index.find(ResourceId(resRef, type), idx)) return shared_ptr<ByteArray>();
+
+    return readResource(_resources[idx]);
+}
+
+void Folder::forEachResource(const function<void(int, const ResRef &, ResourceType)> &fn) {
+    for (size_t i = 0; i < _resources.size(); ++i) {
+        fn(static_cast<int>(i), _resources[i].resRef, _resources[i].type);
     }
-    fs::ifstream in(path, ios::binary);
+}
+
+ByteView Folder::getResourceView(int idx) {
+    return ByteView(readResource(_resources.at(idx)));
+}
+
+shared_ptr<ByteArray> Folder::readResource(const Resource &res) const {
+    fs::ifstream in(res.path, ios::binary);
 
     in.seekg(0, ios::end);
     size_t size = in.tellg();
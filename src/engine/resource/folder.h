@@ -19,6 +19,7 @@
 
 #include "../common/types.h"
 
+#include "resourceindex.h"
 #include "resourceprovider.h"
 #include "types.h"
 
@@ -31,18 +32,25 @@ public:
     void load(const boost::filesystem::path &path);
 
     bool supports(ResourceType type) const override;
-    std::shared_ptr<ByteArray> find(const std::string &resRef, ResourceType type) override;
+    std::shared_ptr<ByteArray> find(const ResRef &resRef, ResourceType type) override;
+    void forEachResource(const std::function<void(int, const ResRef &, ResourceType)> &fn) override;
+    ByteView getResourceView(int idx) override;
 
 private:
     struct Resource {
+        ResRef resRef;
         boost::filesystem::path path;
         ResourceType type;
     };
 
     boost::filesystem::path _path;
-    std::multimap<std::string, Resource> _resources;
+    std::vector<Resource> _resources;
+    ResourceIndex _index;
 
     void loadDirectory(const boost::filesystem::path &path);
+    void indexResources();
+
+    std::shared_ptr<ByteArray> readResource(const Resource &res) const;
 };
 
 } // namespace resource
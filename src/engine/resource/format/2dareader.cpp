@@ -44,7 +44,7 @@ void TwoDaReader::doLoad() {
 void TwoDaReader::loadHeaders() {
     string token;
     while (readToken(token)) {
-        _twoDa->_columns.push_back(token);
+        _twoDa->addColumn(token);
     }
 }
 
@@ -52,7 +52,13 @@ bool TwoDaReader::readToken(string &token) {
     size_t pos = tell();
 
     char buf[256];
-    streamsize chRead = _in->rdbuf()->sgetn(buf, sizeof(buf));
+    streamsize chRead;
+    if (_memoryReader) {
+        chRead = static_cast<streamsize>(min(sizeof(buf), pos < _size ? _size - pos : 0));
+        memcpy(buf, _memoryReader->data(pos, chRead), chRead);
+    } else {
+        chRead = _in->rdbuf()->sgetn(buf, sizeof(buf));
+    }
     const char *pch = buf;
 
     for (; pch - buf < chRead; ++pch) {
@@ -79,9 +85,11 @@ void TwoDaReader::loadLabels() {
 }
 
 void TwoDaReader::loadRows() {
-    _twoDa->_rows.reserve(_rowCount);
+    int columnCount = _twoDa->getColumnCount();
+    for (auto &column : _twoDa->_columnData) {
+        column.cells.reserve(_rowCount);
+    }
 
-    int columnCount = static_cast<int>(_twoDa->_columns.size());
     int cellCount = _rowCount * columnCount;
     vector<uint16_t> offsets(cellCount);
     for (int i = 0; i < cellCount; ++i) {
@@ -91,15 +99,24 @@ void TwoDaReader::loadRows() {
     uint16_t dataSize = readUint16();
     size_t pos = tell();
 
+    // Cells with equal values share an offset, so values are interned once per offset
+    unordered_map<uint16_t, uint32_t> valueIds;
+
     for (int i = 0; i < _rowCount; ++i) {
-        TwoDA::Row row;
         for (int j = 0; j < columnCount; ++j) {
-            int cellIdx = i * columnCount + j;
-            size_t off = pos + offsets[cellIdx];
-            row.values.push_back(readCStringAt(off));
+            uint16_t off = offsets[i * columnCount + j];
+            auto maybeValueId = valueIds.find(off);
+            uint32_t valueId;
+            if (maybeValueId != valueIds.end()) {
+                valueId = maybeValueId->second;
+            } else {
+                valueId = _twoDa->intern(readCStringAt(pos + off));
+                valueIds.insert(make_pair(off, valueId));
+            }
+            _twoDa->_columnData[j].cells.push_back(valueId);
         }
-        _twoDa->_rows.push_back(row);
     }
+    _twoDa->_rowCount = _rowCount;
 }
 
 } // namespace bioware
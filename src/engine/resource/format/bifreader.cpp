@@ -46,16 +46,21 @@ unique_ptr<ByteArray> BifReader::getResourceData(int idx) {
     return make_unique<ByteArray>(readBytes(entry.offset, entry.fileSize));
 }
 
-BifReader::ResourceEntry BifReader::readResourceEntry(int idx) {
-    seek(_tableOffset + 16 * idx);
+ByteView BifReader::getResourceView(int idx) {
+    if (idx >= _resourceCount) {
+        throw out_of_range("BIF: resource index out of range: " + to_string(idx));
+    }
+    ResourceEntry entry(readResourceEntry(idx));
 
-    ignore(4);
-    uint32_t offset = readUint32();
-    uint32_t fileSize = readUint32();
+    return readView(entry.offset, entry.fileSize);
+}
+
+BifReader::ResourceEntry BifReader::readResourceEntry(int idx) {
+    vector<uint32_t> offsetAndSize(readUint32Array(_tableOffset + 16ll * idx + 4, 2));
 
     ResourceEntry entry;
-    entry.offset = offset;
-    entry.fileSize = fileSize;
+    entry.offset = offsetAndSize[0];
+    entry.fileSize = offsetAndSize[1];
 
     return move(entry);
 }
@@ -28,6 +28,7 @@ public:
     BifReader();
 
     std::unique_ptr<ByteArray> getResourceData(int idx);
+    ByteView getResourceView(int idx);
 
 private:
     struct ResourceEntry {
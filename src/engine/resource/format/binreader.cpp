@@ -19,6 +19,9 @@
 
 #include <boost/format.hpp>
 
+#include "../../common/log.h"
+#include "../../common/mappedfile.h"
+
 using namespace std;
 
 namespace fs = boost::filesystem;
@@ -51,6 +54,10 @@ void BinaryReader::load() {
 }
 
 void BinaryReader::querySize() {
+    if (_memoryReader) {
+        _size = _memoryReader->size();
+        return;
+    }
     _in->seekg(0, ios::end);
     _size = _in->tellg();
     _in->seekg(0);
@@ -60,10 +67,9 @@ void BinaryReader::checkSignature() {
     if (_size < _signSize) {
         throw runtime_error("Invalid binary file size");
     }
-    char buf[16];
-    _in->read(buf, _signSize);
-    if (!equal(_sign.begin(), _sign.end(), buf)) {
-        throw runtime_error(str(boost::format("Invalid binary file signature: %s") % string(buf, _signSize)));
+    string sign(readString(_signSize));
+    if (!equal(_sign.begin(), _sign.end(), sign.begin())) {
+        throw runtime_error(str(boost::format("Invalid binary file signature: %s") % sign));
     }
 }
 
@@ -71,60 +77,53 @@ void BinaryReader::load(const fs::path &path) {
     if (!fs::exists(path)) {
         throw runtime_error("File not found: " + path.string());
     }
-    _in = make_shared<fs::ifstream>(path, ios::binary);
-    _reader = make_unique<StreamReader>(_in, _endianess);
     _path = path;
 
-    load();
-}
-
-size_t BinaryReader::tell() const {
-    return _reader->tell();
-}
-
-void BinaryReader::seek(size_t pos) {
-    _reader->seek(pos);
-}
-
-void BinaryReader::ignore(int count) {
-    _reader->ignore(count);
-}
-
-uint8_t BinaryReader::readByte() {
-    return _reader->getByte();
-}
-
-uint16_t BinaryReader::readUint16() {
-    return _reader->getUint16();
-}
+    shared_ptr<MappedFile> mappedFile;
+    try {
+        mappedFile = make_shared<MappedFile>(path);
+    } catch (const runtime_error &e) {
+        debug(boost::format("BinaryReader: falling back to file stream: %s") % e.what());
+    }
+    if (mappedFile) {
+        const char *data = mappedFile->data();
+        size_t size = mappedFile->size();
+        _view = ByteView(move(mappedFile), data, size);
+        loadInMemory();
+        return;
+    }
 
-uint32_t BinaryReader::readUint32() {
-    return _reader->getUint32();
-}
+    _in = make_shared<fs::ifstream>(path, ios::binary);
+    _reader = make_unique<StreamReader>(_in, _endianess);
 
-uint64_t BinaryReader::readUint64() {
-    return _reader->getUint64();
+    load();
 }
 
-int16_t BinaryReader::readInt16() {
-    return _reader->getInt16();
+void BinaryReader::load(const ByteView &view) {
+    if (!view) {
+        throw invalid_argument("Invalid view");
+    }
+    _view = view;
+    loadInMemory();
 }
 
-int32_t BinaryReader::readInt32() {
-    return _reader->getInt32();
-}
+void BinaryReader::loadInMemory() {
+    _memoryReader = make_unique<MemoryReader>(_view.data(), _view.size(), _endianess);
 
-float BinaryReader::readFloat() {
-    return _reader->getFloat();
+    load();
 }
 
 string BinaryReader::readCString(int len) {
-    string result(_reader->getString(len));
+    string result(readString(len));
     result.erase(find(result.begin(), result.end(), '\0'), result.end());
     return move(result);
 }
 
 string BinaryReader::readCString(size_t off, int len) {
+    if (_memoryReader) {
+        return _memoryReader->getCString(off, len);
+    }
+    lock_guard<mutex> lock(_streamMutex);
     size_t pos = _reader->tell();
     _reader->seek(off);
 
@@ -135,6 +134,10 @@ string BinaryReader::readCString(size_t off, int len) {
 }
 
 string BinaryReader::readCStringAt(size_t off) {
+    if (_memoryReader) {
+        return _memoryReader->getCString(off);
+    }
+    lock_guard<mutex> lock(_streamMutex);
     size_t pos = _reader->tell();
     _reader->seek(off);
 
@@ -145,10 +148,14 @@ string BinaryReader::readCStringAt(size_t off) {
 }
 
 string BinaryReader::readString(int len) {
-    return _reader->getString(len);
+    return _memoryReader ? _memoryReader->getString(len) : _reader->getString(len);
 }
 
 string BinaryReader::readString(size_t off, int len) {
+    if (_memoryReader) {
+        return _memoryReader->getString(off, len);
+    }
+    lock_guard<mutex> lock(_streamMutex);
     size_t pos = _reader->tell();
     _reader->seek(off);
 
@@ -159,10 +166,14 @@ string BinaryReader::readString(size_t off, int len) {
 }
 
 ByteArray BinaryReader::readBytes(int count) {
-    return _reader->getBytes(count);
+    return _memoryReader ? _memoryReader->getBytes(count) : _reader->getBytes(count);
 }
 
 ByteArray BinaryReader::readBytes(size_t off, int count) {
+    if (_memoryReader) {
+        return _memoryReader->getBytes(off, count);
+    }
+    lock_guard<mutex> lock(_streamMutex);
     size_t pos = _reader->tell();
     _reader->seek(off);
 
@@ -172,6 +183,42 @@ ByteArray BinaryReader::readBytes(size_t off, int count) {
     return move(result);
 }
 
+ByteView BinaryReader::readView(size_t off, int count) {
+    if (_memoryReader) {
+        _memoryReader->data(off, count);
+        return _view.slice(off, count);
+    }
+    return ByteView(make_shared<ByteArray>(readBytes(off, count)));
+}
+
+vector<uint16_t> BinaryReader::readUint16Array(int count) {
+    return _memoryReader ? _memoryReader->getUint16Array(count) : _reader->getUint16Array(count);
+}
+
+vector<uint32_t> BinaryReader::readUint32Array(int count) {
+    return _memoryReader ? _memoryReader->getUint32Array(count) : _reader->getUint32Array(count);
+}
+
+vector<uint32_t> BinaryReader::readUint32Array(size_t offset, int count) {
+    if (_memoryReader) {
+        return _memoryReader->getUint32Array(offset, count);
+    }
+    lock_guard<mutex> lock(_streamMutex);
+    return _reader->getUint32Array(offset, count);
+}
+
+vector<float> BinaryReader::readFloatArray(int count) {
+    return _memoryReader ? _memoryReader->getFloatArray(count) : _reader->getFloatArray(count);
+}
+
+vector<float> BinaryReader::readFloatArray(size_t offset, int count) {
+    if (_memoryReader) {
+        return _memoryReader->getFloatArray(offset, count);
+    }
+    lock_guard<mutex> lock(_streamMutex);
+    return _reader->getFloatArray(offset, count);
+}
+
 } // namespace resource
 
 } // namespace reone
@@ -17,6 +17,8 @@
 
 #pragma once
 
+#include "../../common/byteview.h"
+#include "../../common/memoryreader.h"
 #include "../../common/streamreader.h"
 #include "../../common/types.h"
 
@@ -28,67 +30,120 @@ namespace resource {
  * Abstract class with utility methods for reading binary files. Descendants are
  * expected to specify the file signature through the constructor and override
  * the doLoad function.
+ *
+ * When the file contents are in memory, i.e. the file is memory-mapped or
+ * loaded from a view, reads are served by a MemoryReader. Otherwise, they go
+ * through a StreamReader.
+ *
+ * Once loaded, offset-addressed reads do not depend on the current read
+ * position and are safe to call concurrently.
  */
 class BinaryReader : boost::noncopyable {
 public:
     void load(const std::shared_ptr<std::istream> &in);
+
+    /**
+     * Loads the file at the specified path. The file is memory-mapped for the
+     * lifetime of this reader, so that offset-addressed reads do not require
+     * stream seeks. Falls back to a file stream if the file cannot be mapped.
+     */
     void load(const boost::filesystem::path &path);
 
+    /**
+     * Loads the file from memory. The view is kept for the lifetime of this
+     * reader, so that offset-addressed reads do not require stream seeks.
+     */
+    void load(const ByteView &view);
+
 protected:
     boost::endian::order _endianess { boost::endian::order::little };
     boost::filesystem::path _path;
-    std::shared_ptr<std::istream> _in;
-    std::unique_ptr<StreamReader> _reader;
+    ByteView _view; /**< file contents, if the file is memory-mapped or loaded from a view */
+    std::shared_ptr<std::istream> _in; /**< input stream, unless file contents are in memory */
+    std::unique_ptr<StreamReader> _reader; /**< reads from the input stream, unless file contents are in memory */
+    std::unique_ptr<MemoryReader> _memoryReader; /**< reads from the view, if file contents are in memory */
+    std::mutex _streamMutex; /**< serializes offset-addressed reads from the input stream */
     size_t _size { 0 };
 
     BinaryReader(int signSize, const char *sign = 0);
 
     virtual void doLoad() = 0;
 
-    size_t tell() const;
-    void seek(size_t off);
-    void ignore(int count);
-
-    uint8_t readByte();
-    uint16_t readUint16();
-    uint32_t readUint32();
-    uint64_t readUint64();
-    int16_t readInt16();
-    int32_t readInt32();
-    float readFloat();
-    std::string readCString(int len);
-    std::string readCString(size_t off, int len);
-    std::string readCStringAt(size_t off);
-    std::string readString(int len);
-    std::string readString(size_t off, int len);
-    ByteArray readBytes(int count);
-    ByteArray readBytes(size_t off, int count);
+    inline size_t tell() const {
+        return _memoryReader ? _memoryReader->tell() : _reader->tell();
+    }
+
+    inline void seek(size_t off) {
+        if (_memoryReader) {
+            _memoryReader->seek(off);
+        } else {
+            _reader->seek(off);
+        }
+    }
+
+    inline void ignore(int count) {
+        if (_memoryReader) {
+            _memoryReader->ignore(count);
+        } else {
+            _reader->ignore(count);
+        }
+    }
+
+    inline uint8_t readByte() {
+        return _memoryReader ? _memoryReader->getByte() : _reader->getByte();
+    }
+
+    inline uint16_t readUint16() {
+        return _memoryReader ? _memoryReader->getUint16() : _reader->getUint16();
+    }
 
-    inline std::vector<uint16_t> readUint16Array(int count) {
-        return _reader->getUint16Array(count);
+    inline uint32_t readUint32() {
+        return _memoryReader ? _memoryReader->getUint32() : _reader->getUint32();
     }
 
-    inline std::vector<uint32_t> readUint32Array(int count) {
-        return _reader->getUint32Array(count);
+    inline uint64_t readUint64() {
+        return _memoryReader ? _memoryReader->getUint64() : _reader->getUint64();
     }
 
-    inline std::vector<uint32_t> readUint32Array(size_t offset, int count) {
-        return _reader->getUint32Array(offset, count);
+    inline int16_t readInt16() {
+        return _memoryReader ? _memoryReader->getInt16() : _reader->getInt16();
     }
 
-    inline std::vector<float> readFloatArray(int count) {
-        return _reader->getFloatArray(count);
+    inline int32_t readInt32() {
+        return _memoryReader ? _memoryReader->getInt32() : _reader->getInt32();
     }
 
-    inline std::vector<float> readFloatArray(size_t offset, int count) {
-        return _reader->getFloatArray(offset, count);
+    inline float readFloat() {
+        return _memoryReader ? _memoryReader->getFloat() : _reader->getFloat();
     }
 
+    std::string readCString(int len);
+    std::string readCString(size_t off, int len);
+    std::string readCStringAt(size_t off);
+    std::string readString(int len);
+    std::string readString(size_t off, int len);
+    ByteArray readBytes(int count);
+    ByteArray readBytes(size_t off, int count);
+
+    /**
+     * @return view of the specified range of the file, sharing ownership of
+     *         the file contents if they are in memory, or owning a copy of the
+     *         range otherwise
+     */
+    ByteView readView(size_t off, int count);
+
+    std::vector<uint16_t> readUint16Array(int count);
+    std::vector<uint32_t> readUint32Array(int count);
+    std::vector<uint32_t> readUint32Array(size_t offset, int count);
+    std::vector<float> readFloatArray(int count);
+    std::vector<float> readFloatArray(size_t offset, int count);
+
 private:
     int _signSize { 0 };
     ByteArray _sign;
 
     void load();
+    void loadInMemory();
     void querySize();
     void checkSignature();
 };
@@ -53,7 +53,7 @@ void ErfReader::checkSignature() {
     if (_size < kSignatureSize) {
         throw runtime_error("Invalid binary file size");
     }
-    string sign(_reader->getString(kSignatureSize));
+    string sign(readString(kSignatureSize));
 
     bool erf = strncmp(&sign[0], kSignatureErf, kSignatureSize) == 0;
     if (!erf) {
@@ -71,6 +71,22 @@ void ErfReader::loadKeys() {
     for (int i = 0; i < _entryCount; ++i) {
         _keys.push_back(readKey());
     }
+
+    indexKeys();
+}
+
+void ErfReader::indexKeys() {
+    _index.clear();
+    _index.reserve(_entryCount);
+
+    int idx;
+    for (int i = 0; i < _entryCount; ++i) {
+        // If a resource is duplicated, the first occurrence wins
+        ResourceId id(_keys[i].resRef, _keys[i].resType);
+        if (!_index.find(id, idx)) {
+            _index.add(id, i);
+        }
+    }
 }
 
 ErfReader::Key ErfReader::readKey() {
@@ -111,20 +127,40 @@ bool ErfReader::supports(ResourceType type) const {
     return true;
 }
 
-shared_ptr<ByteArray> ErfReader::find(const string &resRef, ResourceType type) {
-    string lcResRef(boost::to_lower_copy(resRef));
-    int idx = -1;
+shared_ptr<ByteArray> ErfReader::find(const ResRef &resRef, ResourceType type) {
+    int idx = getResourceIndex(resRef, type);
+    if (idx == -1) return nullptr;
+
+    return make_shared<ByteArray>(getResourceData(_resources[idx]));
+}
+
+ByteView ErfReader::findView(const ResRef &resRef, ResourceType type) {
+    int idx = getResourceIndex(resRef, type);
+    if (idx == -1) return ByteView();
+
+    const Resource &res = _resources[idx];
+
+    return readView(res.offset, res.size);
+}
 
+void ErfReader::forEachResource(const function<void(int, const ResRef &, ResourceType)> &fn) {
     for (int i = 0; i < _entryCount; ++i) {
-        if (_keys[i].resRef == lcResRef && _keys[i].resType == type) {
-            idx = i;
-            break;
-        }
+        fn(i, _keys[i].resRef, _keys[i].resType);
+    }
+}
+
+ByteView ErfReader::getResourceView(int idx) {
+    if (idx >= _entryCount) {
+        throw out_of_range("ERF: resource index out of range: " + to_string(idx));
     }
-    if (idx == -1) return nullptr;
     const Resource &res = _resources[idx];
 
-    return make_shared<ByteArray>(getResourceData(res));
+    return readView(res.offset, res.size);
+}
+
+int ErfReader::getResourceIndex(const ResRef &resRef, ResourceType type) const {
+    int idx;
+    return _index.find(ResourceId(resRef, type), idx) ? idx : -1;
 }
 
 ByteArray ErfReader::getResourceData(const Resource &res) {
@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include "../resourceindex.h"
 #include "../resourceprovider.h"
 #include "../types.h"
 
@@ -42,7 +43,10 @@ public:
     ErfReader();
 
     bool supports(ResourceType type) const override;
-    std::shared_ptr<ByteArray> find(const std::string &resRef, ResourceType type) override;
+    std::shared_ptr<ByteArray> find(const ResRef &resRef, ResourceType type) override;
+    ByteView findView(const ResRef &resRef, ResourceType type) override;
+    void forEachResource(const std::function<void(int, const ResRef &, ResourceType)> &fn) override;
+    ByteView getResourceView(int idx) override;
     ByteArray getResourceData(int idx);
 
     int entryCount() const { return _entryCount; }
@@ -54,11 +58,15 @@ private:
     uint32_t _resourcesOffset { 0 };
     std::vector<Key> _keys;
     std::vector<Resource> _resources;
+    ResourceIndex _index;
 
     void doLoad() override;
 
+    int getResourceIndex(const ResRef &resRef, ResourceType type) const;
+
     void checkSignature();
     void loadKeys();
+    void indexKeys();
     Key readKey();
     void loadResources();
     Resource readResource();
@@ -49,6 +49,11 @@ void GffReader::doLoad() {
     _fieldIncidesCount = readUint32();
     _listIndicesOffset = readUint32();
     _listIndicesCount = readUint32();
+
+    loadLabels();
+
+    // Records are about as large as the field data they are read from
+    _arena = make_shared<GffArena>(_fieldDataCount);
     _root = move(readStruct(0));
 }
 
@@ -59,14 +64,14 @@ unique_ptr<GffStruct> GffReader::readStruct(int idx) {
     uint32_t dataOffset = readUint32();
     uint32_t fieldCount = readUint32();
 
-    auto gffs = make_unique<GffStruct>(type);
+    auto gffs = make_unique<GffStruct>(type, _arena);
 
     if (fieldCount == 1) {
-        gffs->_fields.push_back(readField(dataOffset));
+        gffs->add(readField(dataOffset));
     } else {
         vector<uint32_t> indices(readFieldIndices(dataOffset, fieldCount));
         for (auto &idx : indices) {
-            gffs->_fields.push_back(readField(idx));
+            gffs->add(readField(idx));
         }
     }
 
@@ -80,86 +85,78 @@ GffStruct::Field GffReader::readField(int idx) {
     uint32_t labelIndex = readUint32();
     uint32_t dataOrDataOffset = readUint32();
 
-    GffStruct::Field field;
-    field.type = static_cast<GffStruct::FieldType>(type);
-    field.label = readLabel(labelIndex);
+    if (labelIndex >= _labels.size()) {
+        throw runtime_error("GFF: label index out of range: " + to_string(labelIndex));
+    }
+    const GffLabel &label = _labels[labelIndex];
 
-    switch (field.type) {
+    switch (static_cast<GffStruct::FieldType>(type)) {
         case GffStruct::FieldType::Byte:
+            return GffStruct::Field::newByte(label, dataOrDataOffset);
         case GffStruct::FieldType::Word:
+            return GffStruct::Field::newWord(label, dataOrDataOffset);
         case GffStruct::FieldType::Dword:
-            field.uintValue = dataOrDataOffset;
-            break;
+            return GffStruct::Field::newDword(label, dataOrDataOffset);
         case GffStruct::FieldType::Char:
+            return GffStruct::Field::newChar(label, *reinterpret_cast<int *>(&dataOrDataOffset));
         case GffStruct::FieldType::Short:
+            return GffStruct::Field::newShort(label, *reinterpret_cast<int *>(&dataOrDataOffset));
         case GffStruct::FieldType::Int:
-            field.intValue = *reinterpret_cast<int *>(&dataOrDataOffset);
-            break;
+            return GffStruct::Field::newInt(label, *reinterpret_cast<int *>(&dataOrDataOffset));
         case GffStruct::FieldType::Dword64:
-            field.uint64Value = readQWordFieldData(dataOrDataOffset);
-            break;
+            return GffStruct::Field::newDword64(label, readQWordFieldData(dataOrDataOffset));
         case GffStruct::FieldType::Int64: {
             uint64_t tmp = readQWordFieldData(dataOrDataOffset);
-            field.int64Value = *reinterpret_cast<int64_t *>(&tmp);
-            break;
+            return GffStruct::Field::newInt64(label, *reinterpret_cast<int64_t *>(&tmp));
         }
         case GffStruct::FieldType::Float:
-            field.floatValue = *reinterpret_cast<float *>(&dataOrDataOffset);
-            break;
+            return GffStruct::Field::newFloat(label, *reinterpret_cast<float *>(&dataOrDataOffset));
         case GffStruct::FieldType::Double: {
             uint64_t tmp = readQWordFieldData(dataOrDataOffset);
-            field.doubleValue = *reinterpret_cast<double *>(&tmp);
-            break;
+            return GffStruct::Field::newDouble(label, *reinterpret_cast<double *>(&tmp));
         }
         case GffStruct::FieldType::CExoString:
-            field.strValue = readStringFieldData(dataOrDataOffset);
-            break;
+            return GffStruct::Field::newCExoString(label, readStringFieldData(dataOrDataOffset), _arena.get());
         case GffStruct::FieldType::ResRef:
-            field.strValue = readResRefFieldData(dataOrDataOffset);
-            break;
+            return GffStruct::Field::newResRef(label, readResRefFieldData(dataOrDataOffset), _arena.get());
         case GffStruct::FieldType::CExoLocString: {
             LocString locString(readCExoLocStringFieldData(dataOrDataOffset));
-            field.intValue = locString.strRef;
-            field.strValue = locString.subString;
-            break;
+            return GffStruct::Field::newCExoLocString(label, locString.strRef, locString.subString, _arena.get());
         }
         case GffStruct::FieldType::Void:
-            field.data = readByteArrayFieldData(dataOrDataOffset);
-            break;
+            return GffStruct::Field::newVoid(label, readByteArrayFieldData(dataOrDataOffset), _arena.get());
         case GffStruct::FieldType::Struct:
-            field.children.push_back(readStruct(dataOrDataOffset));
-            break;
+            return GffStruct::Field::newStruct(label, readStruct(dataOrDataOffset));
         case GffStruct::FieldType::List: {
             vector<uint32_t> list(readList(dataOrDataOffset));
+            vector<shared_ptr<GffStruct>> children;
+            children.reserve(list.size());
             for (auto &item : list) {
-                field.children.push_back(readStruct(item));
+                children.push_back(readStruct(item));
             }
-            break;
+            return GffStruct::Field::newList(label, move(children));
         }
         case GffStruct::FieldType::Orientation: {
             ByteArray data(readByteArrayFieldData(dataOrDataOffset, 4 * sizeof(float)));
             auto floatData = reinterpret_cast<float *>(&data[0]);
-            field.quatValue = glm::quat(floatData[0], floatData[1], floatData[2], floatData[3]);
-            break;
+            return GffStruct::Field::newOrientation(label, glm::quat(floatData[0], floatData[1], floatData[2], floatData[3]), _arena.get());
         }
         case GffStruct::FieldType::Vector: {
             ByteArray data(readByteArrayFieldData(dataOrDataOffset, 3 * sizeof(float)));
-            field.vecValue = glm::make_vec3(reinterpret_cast<float *>(&data[0]));
-            break;
+            return GffStruct::Field::newVector(label, glm::make_vec3(reinterpret_cast<float *>(&data[0])), _arena.get());
         }
         case GffStruct::FieldType::StrRef:
-            field.intValue = readStrRefFieldData(dataOrDataOffset);
-            break;
+            return GffStruct::Field::newStrRef(label, readStrRefFieldData(dataOrDataOffset));
         default:
             throw runtime_error("Unsupported field type: " + to_string(type));
     }
-
-    return move(field);
 }
 
-string GffReader::readLabel(int idx) {
-    uint32_t off = _labelOffset + 16 * idx;
-    return readCString(off, 16);
+void GffReader::loadLabels() {
+    _labels.reserve(_labelCount);
+    for (int i = 0; i < _labelCount; ++i) {
+        _labels.push_back(GffLabel(readCString(_labelOffset + 16ll * i, 16)));
+    }
 }
 
 vector<uint32_t> GffReader::readFieldIndices(uint32_t off, int count) {
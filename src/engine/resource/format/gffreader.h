@@ -49,13 +49,15 @@ private:
     int _fieldIncidesCount { 0 };
     uint32_t _listIndicesOffset { 0 };
     int _listIndicesCount { 0 };
+    std::vector<GffLabel> _labels; /**< labels are interned once per file */
+    std::shared_ptr<GffArena> _arena; /**< shared by all structs of the file */
     std::shared_ptr<GffStruct> _root;
 
     void doLoad() override;
 
     std::unique_ptr<GffStruct> readStruct(int idx);
     GffStruct::Field readField(int idx);
-    std::string readLabel(int idx);
+    void loadLabels();
     std::vector<uint32_t> readFieldIndices(uint32_t off, int count);
     uint64_t readQWordFieldData(uint32_t off);
     std::string readStringFieldData(uint32_t off);
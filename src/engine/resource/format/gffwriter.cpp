@@ -94,69 +94,84 @@ static FieldClassification getFieldData(const GffStruct::Field &field, uint32_t
         case GffStruct::FieldType::Byte:
         case GffStruct::FieldType::Word:
         case GffStruct::FieldType::Dword:
-            simple = field.uintValue;
+            simple = field.uintValue();
             return FieldClassification::Simple;
 
         case GffStruct::FieldType::Char:
         case GffStruct::FieldType::Short:
-        case GffStruct::FieldType::Int:
-            simple = *reinterpret_cast<const uint32_t *>(&field.intValue);
+        case GffStruct::FieldType::Int: {
+            int32_t value = field.intValue();
+            simple = *reinterpret_cast<const uint32_t *>(&value);
             return FieldClassification::Simple;
+        }
 
-        case GffStruct::FieldType::Dword64:
+        case GffStruct::FieldType::Dword64: {
+            uint64_t value = field.uint64Value();
             complex.resize(8);
-            memcpy(&complex[0], &field.uint64Value, 8);
+            memcpy(&complex[0], &value, 8);
             return FieldClassification::Complex;
+        }
 
-        case GffStruct::FieldType::Int64:
+        case GffStruct::FieldType::Int64: {
+            int64_t value = field.int64Value();
             complex.resize(8);
-            memcpy(&complex[0], &field.int64Value, 8);
+            memcpy(&complex[0], &value, 8);
             return FieldClassification::Complex;
+        }
 
-        case GffStruct::FieldType::Float:
-            simple = *reinterpret_cast<const uint32_t *>(&field.floatValue);
+        case GffStruct::FieldType::Float: {
+            float value = field.floatValue();
+            simple = *reinterpret_cast<const uint32_t *>(&value);
             return FieldClassification::Simple;
+        }
 
-        case GffStruct::FieldType::Double:
+        case GffStruct::FieldType::Double: {
+            double value = field.doubleValue();
             complex.resize(8);
-            memcpy(&complex[0], &field.doubleValue, sizeof(double));
+            memcpy(&complex[0], &value, sizeof(double));
             return FieldClassification::Complex;
+        }
 
         case GffStruct::FieldType::CExoString: {
-            uint32_t length = static_cast<uint32_t>(field.strValue.length());
+            string value(field.strValue());
+            uint32_t length = static_cast<uint32_t>(value.length());
             complex.resize(4ll + length);
             memcpy(&complex[0], &length, 4);
-            memcpy(&complex[4], &field.strValue[0], length);
+            memcpy(&complex[4], &value[0], length);
             return FieldClassification::Complex;
         }
         case GffStruct::FieldType::ResRef: {
-            uint32_t length = static_cast<uint32_t>(field.strValue.length());
+            string value(field.strValue());
+            uint32_t length = static_cast<uint32_t>(value.length());
             complex.resize(1ll + length);
             complex[0] = length;
-            memcpy(&complex[1], &field.strValue[0], length);
+            memcpy(&complex[1], &value[0], length);
             return FieldClassification::Complex;
         }
         case GffStruct::FieldType::CExoLocString: {
-            uint32_t numSubstrings = !field.strValue.empty() ? 1 : 0;
-            uint32_t totalSize = static_cast<uint32_t>(8 + (numSubstrings > 0 ? (8 + field.strValue.length()) : 0));
+            string value(field.strValue());
+            int32_t strRef = field.intValue();
+            uint32_t numSubstrings = !value.empty() ? 1 : 0;
+            uint32_t totalSize = static_cast<uint32_t>(8 + (numSubstrings > 0 ? (8 + value.length()) : 0));
             complex.resize(4ll + totalSize);
             memcpy(&complex[0], &totalSize, 4);
-            memcpy(&complex[4], &field.intValue, 4);
+            memcpy(&complex[4], &strRef, 4);
             memcpy(&complex[8], &numSubstrings, 4);
             if (numSubstrings > 0) {
                 uint32_t id = 0;
-                uint32_t length = static_cast<uint32_t>(field.strValue.length());
+                uint32_t length = static_cast<uint32_t>(value.length());
                 memcpy(&complex[12], &id, 4);
                 memcpy(&complex[16], &length, 4);
-                memcpy(&complex[20], &field.strValue[0], length);
+                memcpy(&complex[20], &value[0], length);
             }
             return FieldClassification::Complex;
         }
         case GffStruct::FieldType::Void: {
-            uint32_t dataSize = static_cast<uint32_t>(field.data.size());
+            ByteArray data(field.data());
+            uint32_t dataSize = static_cast<uint32_t>(data.size());
             complex.resize(4ll + dataSize);
             memcpy(&complex[0], &dataSize, 4);
-            memcpy(&complex[4], &field.data[0], dataSize);
+            memcpy(&complex[4], &data[0], dataSize);
             return FieldClassification::Complex;
         }
         case GffStruct::FieldType::Struct:
@@ -165,24 +180,27 @@ static FieldClassification getFieldData(const GffStruct::Field &field, uint32_t
         case GffStruct::FieldType::List: 
             return FieldClassification::List;
 
-        case GffStruct::FieldType::Orientation:
+        case GffStruct::FieldType::Orientation: {
+            glm::quat value(field.quatValue());
             complex.resize(16);
-            memcpy(&complex[0], &field.quatValue.w, 4);
-            memcpy(&complex[4], &field.quatValue.x, 4);
-            memcpy(&complex[8], &field.quatValue.y, 4);
-            memcpy(&complex[12], &field.quatValue.z, 4);
+            memcpy(&complex[0], &value.w, 4);
+            memcpy(&complex[4], &value.x, 4);
+            memcpy(&complex[8], &value.y, 4);
+            memcpy(&complex[12], &value.z, 4);
             return FieldClassification::Complex;
-
-        case GffStruct::FieldType::Vector:
+        }
+        case GffStruct::FieldType::Vector: {
+            glm::vec3 value(field.vecValue());
             complex.resize(12);
-            memcpy(&complex[0], &field.vecValue[0], 12);
+            memcpy(&complex[0], &value[0], 12);
             return FieldClassification::Complex;
-
+        }
         case GffStruct::FieldType::StrRef: {
             uint32_t totalSize = 4;
+            int32_t strRef = field.intValue();
             complex.resize(8);
             memcpy(&complex[0], &totalSize, 4);
-            memcpy(&complex[4], &field.intValue, 4);
+            memcpy(&complex[4], &strRef, 4);
             return FieldClassification::Complex;
         }
         default:
@@ -229,15 +247,15 @@ void GffWriter::processTree() {
                 case FieldClassification::Struct:
                     // Set data offset to the next struct index
                     dataOrDataOffset = ++numStructs;
-                    aQueue.push(field.children[0].get());
+                    aQueue.push(field.children()[0].get());
                     break;
                 case FieldClassification::List:
                     // Set data offset to the current size of the list indices array
                     dataOrDataOffset = static_cast<uint32_t>(4 * _context.listIndices.size());
-                    _context.listIndices.push_back(static_cast<uint32_t>(field.children.size()));
-                    for (size_t i = 0; i < field.children.size(); ++i) {
+                    _context.listIndices.push_back(static_cast<uint32_t>(field.children().size()));
+                    for (size_t i = 0; i < field.children().size(); ++i) {
                         _context.listIndices.push_back(++numStructs);
-                        aQueue.push(field.children[i].get());
+                        aQueue.push(field.children()[i].get());
                     }
                     break;
                 default:
@@ -330,7 +348,7 @@ void GffWriter::writeLabelArray() {
     for (auto &label : _context.labels) {
         string tmp;
         tmp.resize(16);
-        strncpy(&tmp[0], label.c_str(), 16);
+        strncpy(&tmp[0], label.str().c_str(), 16);
         _writer->putString(tmp);
     }
 }
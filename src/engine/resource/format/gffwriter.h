@@ -49,7 +49,7 @@ private:
     struct WriteContext {
         std::vector<WriteStruct> structs;
         std::vector<WriteField> fields;
-        std::vector<std::string> labels;
+        std::vector<GffLabel> labels;
         ByteArray fieldData;
         std::vector<uint32_t> fieldIndices;
         std::vector<uint32_t> listIndices;
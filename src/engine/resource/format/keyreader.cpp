@@ -67,10 +67,17 @@ KeyReader::FileEntry KeyReader::readFileEntry() {
 
 void KeyReader::loadKeys() {
     _keys.reserve(_keyCount);
+    _keyIdxByResource.reserve(_keyCount);
     seek(_keysOffset);
 
     for (int i = 0; i < _keyCount; ++i) {
-        _keys.push_back(readKeyEntry());
+        KeyEntry key(readKeyEntry());
+        ResourceId id(key.resRef, key.resType);
+        int existingIdx;
+        if (!_keyIdxByResource.find(id, existingIdx)) {
+            _keyIdxByResource.add(id, i);
+        }
+        _keys.push_back(move(key));
     }
 }
 
@@ -95,19 +102,11 @@ const string &KeyReader::getFilename(int idx) const {
     return _files[idx].filename;
 }
 
-bool KeyReader::find(const string &resRef, ResourceType type, KeyEntry &key) const {
-    string lcResRef(boost::to_lower_copy(resRef));
+const KeyReader::KeyEntry *KeyReader::find(const ResRef &resRef, ResourceType type) const {
+    int idx;
+    if (!_keyIdxByResource.find(ResourceId(resRef, type), idx)) return nullptr;
 
-    auto it = find_if(
-        _keys.begin(),
-        _keys.end(),
-        [&](const KeyEntry &e) { return e.resRef == lcResRef && e.resType == type; });
-
-    if (it == _keys.end()) return false;
-
-    key = *it;
-
-    return true;
+    return &_keys[idx];
 }
 
 } // namespace resource
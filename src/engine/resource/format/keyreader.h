@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include "../resourceindex.h"
 #include "../types.h"
 
 #include "binreader.h"
@@ -42,7 +43,12 @@ public:
     KeyReader();
 
     const std::string &getFilename(int idx) const;
-    bool find(const std::string &resRef, ResourceType type, KeyEntry &key) const;
+
+    /**
+     * @return pointer to the KEY entry of the specified resource, or nullptr
+     *         if the resource is not found
+     */
+    const KeyEntry *find(const ResRef &resRef, ResourceType type) const;
 
     const std::vector<FileEntry> &files() const { return _files; }
     const std::vector<KeyEntry> &keys() const { return _keys; }
@@ -54,6 +60,7 @@ private:
     uint32_t _keysOffset { 0 };
     std::vector<FileEntry> _files;
     std::vector<KeyEntry> _keys;
+    ResourceIndex _keyIdxByResource;
 
     void doLoad() override;
     void loadFiles();
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2020-2021 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "packwriter.h"
+
+#include <boost/filesystem.hpp>
+
+#include "../../common/lz4codec.h"
+#include "../../common/streamwriter.h"
+
+#include "../packprovider.h"
+
+using namespace std;
+
+namespace fs = boost::filesystem;
+
+namespace reone {
+
+namespace resource {
+
+static constexpr int kDataAlignment = 16;
+static constexpr size_t kMinCompressedSize = 64;
+
+struct PackEntry {
+    ResourceId id;
+    PackResourceProvider::Compression compression { PackResourceProvider::Compression::None };
+    uint64_t offset { 0 };
+    uint32_t size { 0 };
+    uint32_t originalSize { 0 };
+};
+
+static uint64_t alignUp(uint64_t value, uint64_t alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+/**
+ * @return offset of a resource, so that it is page-aligned if it is at least
+ *         a page in size, and does not straddle a page boundary otherwise
+ */
+static uint64_t getDataOffset(uint64_t end, size_t size) {
+    uint64_t offset = alignUp(end, kDataAlignment);
+    if (size >= PackResourceProvider::kPageSize ||
+        (size > 0 && offset / PackResourceProvider::kPageSize != (offset + size - 1) / PackResourceProvider::kPageSize)) {
+        offset = alignUp(end, PackResourceProvider::kPageSize);
+    }
+    return offset;
+}
+
+PackWriter::PackWriter(bool compress) : _compress(compress) {
+}
+
+void PackWriter::add(Resource &&res) {
+    ResourceId id(res.resRef, res.resType);
+    auto maybeIdx = _indexById.find(id);
+    if (maybeIdx != _indexById.end()) {
+        _resources[maybeIdx->second] = move(res);
+        return;
+    }
+    _indexById.insert(make_pair(id, static_cast<int>(_resources.size())));
+    _resources.push_back(move(res));
+}
+
+void PackWriter::save(const fs::path &path) {
+    auto numResources = static_cast<uint32_t>(_resources.size());
+    uint32_t numBuckets = 1;
+    while (numBuckets < numResources) {
+        numBuckets *= 2;
+    }
+    uint32_t offBuckets = PackResourceProvider::kHeaderSize;
+    uint32_t offEntries = offBuckets + 4 * (numBuckets + 1);
+    uint64_t offData = offEntries + static_cast<uint64_t>(PackResourceProvider::kEntrySize) * numResources;
+
+    auto pack = make_shared<fs::ofstream>(path, ios::binary);
+    StreamWriter writer(pack);
+
+    // Entry table is written last, once data offsets and sizes are known
+    writer.putBytes(static_cast<int>(offData));
+
+    // Write resource data in the order of addition
+    vector<PackEntry> entries;
+    entries.reserve(numResources);
+    uint64_t end = offData;
+    for (auto &res : _resources) {
+        ByteView data(res.data());
+
+        PackEntry entry;
+        entry.id = ResourceId(res.resRef, res.resType);
+        entry.originalSize = static_cast<uint32_t>(data.size());
+
+        ByteArray compressed;
+        if (_compress && data.size() >= kMinCompressedSize) {
+            compressed = compressLZ4(data.data(), data.size());
+            if (compressed.size() <= data.size() / 4 * 3) {
+                entry.compression = PackResourceProvider::Compression::LZ4;
+                data = ByteView(make_shared<ByteArray>(move(compressed)));
+            }
+        }
+        entry.size = static_cast<uint32_t>(data.size());
+        entry.offset = getDataOffset(end, data.size());
+
+        if (entry.offset > end) {
+            writer.putBytes(static_cast<int>(entry.offset - end));
+        }
+        writer.putBytes(data);
+        end = entry.offset + entry.size;
+
+        entries.push_back(move(entry));
+    }
+
+    // Order entries by bucket
+    uint32_t mask = numBuckets - 1;
+    stable_sort(entries.begin(), entries.end(), [&mask](auto &left, auto &right) {
+        return (left.id.hash() & mask) < (right.id.hash() & mask);
+    });
+
+    pack->seekp(0);
+    writer.putString("RPK V1.0");
+    writer.putUint32(numResources);
+    writer.putUint32(numBuckets);
+    writer.putUint32(offBuckets);
+    writer.putUint32(offEntries);
+    writer.putBytes(PackResourceProvider::kHeaderSize - 24); // reserved
+
+    // Write bucket table
+    uint32_t entryIdx = 0;
+    for (uint32_t bucket = 0; bucket <= numBuckets; ++bucket) {
+        while (entryIdx < numResources && (entries[entryIdx].id.hash() & mask) < bucket) {
+            ++entryIdx;
+        }
+        writer.putUint32(entryIdx);
+    }
+
+    // Write entry table
+    for (auto &entry : entries) {
+        writer.putString(string(entry.id.resRef.data(), ResRef::kMaxLength));
+        writer.putUint16(static_cast<uint16_t>(entry.id.type));
+        writer.putUint16(static_cast<uint16_t>(entry.compression));
+        writer.putUint32(entry.id.hash());
+        writer.putUint64(entry.offset);
+        writer.putUint32(entry.size);
+        writer.putUint32(entry.originalSize);
+    }
+}
+
+} // namespace resource
+
+} // namespace reone
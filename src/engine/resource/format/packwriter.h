@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2020-2021 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../../common/byteview.h"
+
+#include "../resref.h"
+#include "../types.h"
+
+namespace reone {
+
+namespace resource {
+
+/**
+ * Writes resource packs. See PackResourceProvider for the file layout.
+ */
+class PackWriter : boost::noncopyable {
+public:
+    struct Resource {
+        std::string resRef;
+        ResourceType resType { ResourceType::Invalid };
+        std::function<ByteView()> data; /**< called once, when the pack is saved */
+    };
+
+    /**
+     * @param compress whether to compress resources with LZ4, when it makes them at least a quarter smaller
+     */
+    PackWriter(bool compress = false);
+
+    /**
+     * Adds the resource to this pack, replacing a previously added resource
+     * with the same ResRef and ResType.
+     */
+    void add(Resource &&res);
+
+    void save(const boost::filesystem::path &path);
+
+    int resourceCount() const { return static_cast<int>(_resources.size()); }
+
+private:
+    bool _compress;
+    std::vector<Resource> _resources;
+    std::unordered_map<ResourceId, int> _indexById;
+};
+
+} // namespace resource
+
+} // namespace reone
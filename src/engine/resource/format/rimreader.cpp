@@ -49,6 +49,22 @@ void RimReader::loadResources() {
     for (int i = 0; i < _resourceCount; ++i) {
         _resources.push_back(readResource());
     }
+
+    indexResources();
+}
+
+void RimReader::indexResources() {
+    _index.clear();
+    _index.reserve(_resourceCount);
+
+    int idx;
+    for (int i = 0; i < _resourceCount; ++i) {
+        // If a resource is duplicated, the first occurrence wins
+        ResourceId id(_resources[i].resRef, _resources[i].resType);
+        if (!_index.find(id, idx)) {
+            _index.add(id, i);
+        }
+    }
 }
 
 RimReader::Resource RimReader::readResource() {
@@ -71,17 +87,38 @@ bool RimReader::supports(ResourceType type) const {
     return true;
 }
 
-shared_ptr<ByteArray> RimReader::find(const string &resRef, ResourceType type) {
-    string lcResRef(boost::to_lower_copy(resRef));
+shared_ptr<ByteArray> RimReader::find(const ResRef &resRef, ResourceType type) {
+    const Resource *res = findResource(resRef, type);
+    if (!res) return nullptr;
+
+    return make_shared<ByteArray>(getResourceData(*res));
+}
 
-    auto it = find_if(
-        _resources.begin(),
-        _resources.end(),
-        [&](const Resource &res) { return res.resRef == lcResRef && res.resType == type; });
+ByteView RimReader::findView(const ResRef &resRef, ResourceType type) {
+    const Resource *res = findResource(resRef, type);
+    if (!res) return ByteView();
+
+    return readView(res->offset, res->size);
+}
 
-    if (it == _resources.end()) return nullptr;
+void RimReader::forEachResource(const function<void(int, const ResRef &, ResourceType)> &fn) {
+    for (int i = 0; i < _resourceCount; ++i) {
+        fn(i, _resources[i].resRef, _resources[i].resType);
+    }
+}
+
+ByteView RimReader::getResourceView(int idx) {
+    if (idx >= _resourceCount) {
+        throw logic_error("RIM: resource index out of range: " + to_string(idx));
+    }
+    const Resource &res = _resources[idx];
+
+    return readView(res.offset, res.size);
+}
 
-    return make_shared<ByteArray>(getResourceData(*it));
+const RimReader::Resource *RimReader::findResource(const ResRef &resRef, ResourceType type) const {
+    int idx;
+    return _index.find(ResourceId(resRef, type), idx) ? &_resources[idx] : nullptr;
 }
 
 ByteArray RimReader::getResourceData(const Resource &res) {
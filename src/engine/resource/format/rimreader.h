@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include "../resourceindex.h"
 #include "../resourceprovider.h"
 #include "../types.h"
 
@@ -38,7 +39,10 @@ public:
     RimReader();
 
     bool supports(ResourceType type) const override;
-    std::shared_ptr<ByteArray> find(const std::string &resRef, ResourceType resType) override;
+    std::shared_ptr<ByteArray> find(const ResRef &resRef, ResourceType resType) override;
+    ByteView findView(const ResRef &resRef, ResourceType resType) override;
+    void forEachResource(const std::function<void(int, const ResRef &, ResourceType)> &fn) override;
+    ByteView getResourceView(int idx) override;
     ByteArray getResourceData(int idx);
 
     const std::vector<Resource> &resources() const { return _resources; }
@@ -47,9 +51,12 @@ private:
     int _resourceCount { 0 };
     uint32_t _resourcesOffset { 0 };
     std::vector<Resource> _resources;
+    ResourceIndex _index;
 
     void doLoad() override;
     void loadResources();
+    void indexResources();
+    const Resource *findResource(const ResRef &resRef, ResourceType type) const;
     Resource readResource();
     ByteArray getResourceData(const Resource &res);
 };
@@ -17,19 +17,13 @@
 
 #include "tlkreader.h"
 
-#include <boost/algorithm/string.hpp>
-
 using namespace std;
 
 namespace reone {
 
 namespace resource {
 
-struct StringFlags {
-    static constexpr int textPresent = 1;
-    static constexpr int soundPresent = 2;
-    static constexpr int soundLengthPresent = 4;
-};
+static constexpr int kHeaderSize = 20;
 
 TlkReader::TlkReader() : BinaryReader(8, "TLK V3.0") {
 }
@@ -43,29 +37,13 @@ void TlkReader::doLoad() {
 }
 
 void TlkReader::loadStrings() {
-    _table = make_shared<TalkTable>();
-
-    for (uint32_t i = 0; i < _stringCount; ++i) {
-        uint32_t flags = readUint32();
-
-        string soundResRef(readCString(16));
-        boost::to_lower(soundResRef);
-
-        ignore(8);
-
-        uint32_t stringOffset = readUint32();
-        uint32_t stringSize = readUint32();
-        float soundLength = readFloat();
-
-        TalkTableString tableString;
-        if (flags & StringFlags::textPresent) {
-            tableString.text = readString(_stringsOffset + stringOffset, stringSize);
-        }
-        if (flags & StringFlags::soundPresent) {
-            tableString.soundResRef = soundResRef;
-        }
-        _table->addString(move(tableString));
+    if (_stringsOffset > _size) {
+        throw runtime_error("TLK: strings offset is out of range");
     }
+    ByteView entries(readView(kHeaderSize, static_cast<int>(_stringCount * TalkTable::kEntrySize)));
+    ByteView strings(readView(_stringsOffset, static_cast<int>(_size - _stringsOffset)));
+
+    _table = make_shared<TalkTable>(move(entries), move(strings));
 }
 
 } // namespace resource
@@ -65,7 +65,7 @@ void TlkWriter::save(const fs::path &path) {
     writer.putString("TLK V3.0");
     writer.putUint32(0); // language id
     writer.putUint32(_talkTable->getStringCount());
-    writer.putUint32(20 + _talkTable->getStringCount() * sizeof(StringDataElement)); // offset to string entries
+    writer.putUint32(20 + _talkTable->getStringCount() * TalkTable::kEntrySize); // offset to string entries
 
     for (int i = 0; i < _talkTable->getStringCount(); ++i) {
         const StringDataElement &strDataElem = strData[i];
@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2020-2021 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "gffarena.h"
+
+using namespace std;
+
+namespace reone {
+
+namespace resource {
+
+GffArena::GffArena(size_t blockSize) : _blockSize(max<size_t>(blockSize, 1)) {
+}
+
+char *GffArena::allocate(size_t size) {
+    if (_blocks.empty() || _blockUsed + size > _blockCapacity) {
+        size_t blockSize = max(size, _blockSize);
+        _blocks.push_back(make_unique<char[]>(blockSize));
+        _blockCapacity = blockSize;
+        _blockUsed = 0;
+        _bytes += blockSize;
+    }
+    char *result = _blocks.back().get() + _blockUsed;
+    _blockUsed += size;
+
+    return result;
+}
+
+} // namespace resource
+
+} // namespace reone
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2020-2021 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+namespace reone {
+
+namespace resource {
+
+/**
+ * Storage of out-of-line field values (strings, blobs, vectors and
+ * orientations) of structs read from a single GFF file. Memory is allocated
+ * in blocks and released all at once, when the last struct is destroyed.
+ */
+class GffArena : boost::noncopyable {
+public:
+    /**
+     * @param blockSize preferred size of a block, e.g. size of the field data of a GFF file
+     */
+    GffArena(size_t blockSize = kDefaultBlockSize);
+
+    /**
+     * @return unaligned memory, valid for the lifetime of this arena
+     */
+    char *allocate(size_t size);
+
+    /**
+     * @return total size of the allocated blocks
+     */
+    size_t bytes() const { return _bytes; }
+
+private:
+    static constexpr size_t kDefaultBlockSize = 4096;
+
+    size_t _blockSize;
+    std::vector<std::unique_ptr<char[]>> _blocks;
+    size_t _blockCapacity { 0 }; /**< size of the last block */
+    size_t _blockUsed { 0 }; /**< allocated bytes in the last block */
+    size_t _bytes { 0 };
+};
+
+} // namespace resource
+
+} // namespace reone
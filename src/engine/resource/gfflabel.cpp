@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2020-2021 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "gfflabel.h"
+
+using namespace std;
+
+namespace reone {
+
+namespace resource {
+
+/**
+ * Interned labels are never removed. Labels are stored in a deque, so that
+ * references to them remain valid as the table grows.
+ */
+struct GffLabelTable {
+    mutex labelsMutex;
+    unordered_map<string, uint32_t> ids;
+    deque<string> labels;
+
+    GffLabelTable() {
+        // The empty label always has identifier zero
+        labels.push_back("");
+        ids.insert(make_pair("", 0));
+    }
+};
+
+static GffLabelTable &getLabelTable() {
+    // Function-local, so that labels can be interned during static initialization
+    static GffLabelTable table;
+    return table;
+}
+
+static uint32_t intern(const string &label) {
+    GffLabelTable &table = getLabelTable();
+    lock_guard<mutex> lock(table.labelsMutex);
+
+    auto maybeId = table.ids.find(label);
+    if (maybeId != table.ids.end()) return maybeId->second;
+
+    uint32_t id = static_cast<uint32_t>(table.labels.size());
+    table.labels.push_back(label);
+    table.ids.insert(make_pair(label, id));
+
+    return id;
+}
+
+GffLabel::GffLabel(const char *label) : _id(intern(label)) {
+}
+
+GffLabel::GffLabel(const string &label) : _id(intern(label)) {
+}
+
+const string &GffLabel::str() const {
+    GffLabelTable &table = getLabelTable();
+    lock_guard<mutex> lock(table.labelsMutex);
+
+    return table.labels[_id];
+}
+
+} // namespace resource
+
+} // namespace reone
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2020-2021 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+namespace reone {
+
+namespace resource {
+
+/**
+ * Handle of a GFF field label, interned in a global label table, so that
+ * labels are compared by a single integer. Labels are case-sensitive.
+ *
+ * Interning a label takes a lock and a hash table lookup. Code that looks up
+ * fields repeatedly, e.g. blueprint loaders, should construct labels once and
+ * reuse them.
+ */
+class GffLabel {
+public:
+    /**
+     * Constructs an empty label.
+     */
+    GffLabel() = default;
+
+    GffLabel(const char *label);
+    GffLabel(const std::string &label);
+
+    bool operator==(const GffLabel &other) const { return _id == other._id; }
+    bool operator!=(const GffLabel &other) const { return _id != other._id; }
+
+    bool empty() const { return _id == 0; }
+
+    /**
+     * @return label string, valid for the lifetime of the program
+     */
+    const std::string &str() const;
+
+    /**
+     * @return unique identifier of the label, zero for the empty label
+     */
+    uint32_t id() const { return _id; }
+
+private:
+    uint32_t _id { 0 };
+};
+
+} // namespace resource
+
+} // namespace reone
+
+namespace std {
+
+template <>
+struct hash<reone::resource::GffLabel> {
+    size_t operator()(const reone::resource::GffLabel &label) const {
+        return label.id();
+    }
+};
+
+} // namespace std
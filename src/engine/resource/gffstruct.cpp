@@ -25,44 +25,102 @@ namespace reone {
 
 namespace resource {
 
+static constexpr size_t kMinIndexedFieldCount = 8; /**< fields of smaller structs are scanned linearly */
+
 GffStruct::GffStruct(uint32_t type) : _type(type) {
 }
 
 GffStruct::GffStruct(uint32_t type, vector<Field> fields) : _type(type), _fields(move(fields)) {
+    if (_fields.size() >= kMinIndexedFieldCount) {
+        rebuildFieldIndex();
+    }
+}
+
+GffStruct::GffStruct(uint32_t type, shared_ptr<GffArena> arena) : _type(type), _arena(move(arena)) {
 }
 
 void GffStruct::add(Field &&field) {
-    _fields.push_back(field);
+    if (_arena) {
+        field.moveRecordTo(*_arena);
+    }
+    _fields.push_back(move(field));
+
+    if (_fields.size() < kMinIndexedFieldCount) return;
+
+    if (2 * _fields.size() > _fieldIndex.size()) {
+        rebuildFieldIndex();
+    } else {
+        indexField(static_cast<int>(_fields.size()) - 1);
+    }
 }
 
-bool GffStruct::getBool(const string &name, bool defValue) const {
-    const Field *field = get(name);
-    if (!field) return defValue;
+void GffStruct::rebuildFieldIndex() {
+    size_t capacity = 16;
+    while (capacity < 2 * _fields.size()) {
+        capacity *= 2;
+    }
+    _fieldIndex.assign(capacity, -1);
+
+    for (size_t i = 0; i < _fields.size(); ++i) {
+        indexField(static_cast<int>(i));
+    }
+}
 
-    return field->intValue != 0;
+static inline size_t getFieldSlot(const GffLabel &label) {
+    return label.id() * 2654435761u;
 }
 
-const GffStruct::Field *GffStruct::get(const string &name) const {
-    auto maybeField = find_if(
-        _fields.begin(),
-        _fields.end(),
-        [&](auto &f) { return f.label == name; });
+void GffStruct::indexField(int idx) {
+    const GffLabel &label = _fields[idx].label;
+    size_t mask = _fieldIndex.size() - 1;
+
+    for (size_t i = getFieldSlot(label) & mask;; i = (i + 1) & mask) {
+        int existing = _fieldIndex[i];
+        if (existing == -1) {
+            _fieldIndex[i] = idx;
+            return;
+        }
+        // If a label is duplicated, the first field wins
+        if (_fields[existing].label == label) return;
+    }
+}
+
+bool GffStruct::getBool(const GffLabel &label, bool defValue) const {
+    const Field *field = get(label);
+    if (!field) return defValue;
 
-    return maybeField != _fields.end() ? &*maybeField : nullptr;
+    return field->intValue() != 0;
 }
 
-int GffStruct::getInt(const string &name, int defValue) const {
-    const Field *field = get(name);
+const GffStruct::Field *GffStruct::get(const GffLabel &label) const {
+    if (_fieldIndex.empty()) {
+        for (auto &field : _fields) {
+            if (field.label == label) return &field;
+        }
+        return nullptr;
+    }
+
+    size_t mask = _fieldIndex.size() - 1;
+
+    for (size_t i = getFieldSlot(label) & mask;; i = (i + 1) & mask) {
+        int idx = _fieldIndex[i];
+        if (idx == -1) return nullptr;
+        if (_fields[idx].label == label) return &_fields[idx];
+    }
+}
+
+int GffStruct::getInt(const GffLabel &label, int defValue) const {
+    const Field *field = get(label);
     if (!field) return defValue;
 
-    return field->intValue;
+    return field->intValue();
 }
 
-uint32_t GffStruct::getUint(const string &name, uint32_t defValue) const {
-    const Field *field = get(name);
+uint32_t GffStruct::getUint(const GffLabel &label, uint32_t defValue) const {
+    const Field *field = get(label);
     if (!field) return defValue;
 
-    return field->uintValue;
+    return field->uintValue();
 }
 
 static glm::vec3 colorFromUint32(uint32_t value) {
@@ -76,53 +134,56 @@ static glm::vec3 colorFromUint32(uint32_t value) {
     return move(result);
 }
 
-glm::vec3 GffStruct::getColor(const string &name, glm::vec3 defValue) const {
-    const Field *field = get(name);
+glm::vec3 GffStruct::getColor(const GffLabel &label, glm::vec3 defValue) const {
+    const Field *field = get(label);
     if (!field) return move(defValue);
 
-    return colorFromUint32(field->uintValue);
+    return colorFromUint32(field->uintValue());
 }
 
-float GffStruct::getFloat(const string &name, float defValue) const {
-    const Field *field = get(name);
+float GffStruct::getFloat(const GffLabel &label, float defValue) const {
+    const Field *field = get(label);
     if (!field) return defValue;
 
-    return field->floatValue;
+    return field->floatValue();
 }
 
-string GffStruct::getString(const string &name, string defValue) const {
-    const Field *field = get(name);
+string GffStruct::getString(const GffLabel &label, string defValue) const {
+    const Field *field = get(label);
     if (!field) return defValue;
 
-    return field->strValue;
+    return field->strValue();
 }
 
-glm::vec3 GffStruct::getVector(const string &name, glm::vec3 defValue) const {
-    const Field *field = get(name);
+glm::vec3 GffStruct::getVector(const GffLabel &label, glm::vec3 defValue) const {
+    const Field *field = get(label);
     if (!field) return move(defValue);
 
-    return field->vecValue;
+    return field->vecValue();
 }
 
-glm::quat GffStruct::getOrientation(const string &name, glm::quat defValue) const {
-    const Field *field = get(name);
+glm::quat GffStruct::getOrientation(const GffLabel &label, glm::quat defValue) const {
+    const Field *field = get(label);
     if (!field) return defValue;
 
-    return field->quatValue;
+    return field->quatValue();
 }
 
-shared_ptr<GffStruct> GffStruct::getStruct(const string &name) const {
-    const Field *field = get(name);
+shared_ptr<GffStruct> GffStruct::getStruct(const GffLabel &label) const {
+    const Field *field = get(label);
     if (!field) return nullptr;
 
-    return field->children[0];
+    const vector<shared_ptr<GffStruct>> &children = field->children();
+    if (children.empty()) return nullptr;
+
+    return children[0];
 }
 
-vector<shared_ptr<GffStruct>> GffStruct::getList(const string &name) const {
-    const Field *field = get(name);
+vector<shared_ptr<GffStruct>> GffStruct::getList(const GffLabel &label) const {
+    const Field *field = get(label);
     if (!field) return vector<shared_ptr<GffStruct>>();
 
-    return field->children;
+    return field->children();
 }
 
 } // namespace resource
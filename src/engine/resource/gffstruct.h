@@ -19,10 +19,18 @@
 
 #include "../common/types.h"
 
+#include "gffarena.h"
+#include "gfflabel.h"
+
 namespace reone {
 
 namespace resource {
 
+/**
+ * Struct of a GFF file. Fields are looked up by interned labels. Structs with
+ * many fields maintain a small hash index of their fields. Structs read from
+ * a GFF file share an arena, that stores field records.
+ */
 class GffStruct : boost::noncopyable {
 public:
     enum class FieldType : uint16_t {
@@ -47,79 +55,131 @@ public:
         StrRef = 18
     };
 
+    /**
+     * Field of a GFF struct. Scalar values are stored inline, so that a field
+     * takes 16 bytes. Strings, byte arrays, orientations and vectors are
+     * stored out of line as records: in the arena of the owning struct, if it
+     * has one, or in memory owned by the field otherwise. Children of structs
+     * and lists are always owned by the field.
+     */
     struct Field {
+        GffLabel label;
         FieldType type { FieldType::Int };
-        std::string label;
-        std::string strValue; /**< covers CExoString and ResRef */
-        glm::vec3 vecValue { 0.0f };
-        glm::quat quatValue { 1.0f, 0.0f, 0.0f, 0.0f };
-        ByteArray data;
-        std::vector<std::shared_ptr<GffStruct>> children;
-
-        union {
-            int32_t intValue; /**< covers Char, Short, Int and StrRef */
-            uint32_t uintValue; /**< covers Byte, Word and Dword */
+
+        Field() = default;
+        Field(FieldType type, GffLabel label);
+        Field(const Field &other);
+        Field(Field &&other) noexcept;
+        ~Field();
+
+        Field &operator=(const Field &other);
+        Field &operator=(Field &&other) noexcept;
+
+        int32_t intValue() const; /**< covers Char, Short, Int, StrRef and CExoLocString */
+        uint32_t uintValue() const; /**< covers Byte, Word and Dword */
+        int64_t int64Value() const;
+        uint64_t uint64Value() const;
+        float floatValue() const;
+        double doubleValue() const;
+        std::string strValue() const; /**< covers CExoString, ResRef and CExoLocString */
+        ByteArray data() const;
+        glm::vec3 vecValue() const;
+        glm::quat quatValue() const;
+        const std::vector<std::shared_ptr<GffStruct>> &children() const;
+
+        static Field newByte(GffLabel label, uint32_t val);
+        static Field newChar(GffLabel label, int32_t val);
+        static Field newWord(GffLabel label, uint32_t val);
+        static Field newShort(GffLabel label, int32_t val);
+        static Field newDword(GffLabel label, uint32_t val);
+        static Field newInt(GffLabel label, int32_t val);
+        static Field newDword64(GffLabel label, uint64_t val);
+        static Field newInt64(GffLabel label, int64_t val);
+        static Field newFloat(GffLabel label, float val);
+        static Field newDouble(GffLabel label, double val);
+        static Field newStruct(GffLabel label, std::shared_ptr<GffStruct> val);
+        static Field newList(GffLabel label, std::vector<std::shared_ptr<GffStruct>> val);
+        static Field newStrRef(GffLabel label, int32_t val);
+
+        // Factories of fields with records. If an arena is specified, records
+        // are allocated from it, and fields must only be added to structs
+        // sharing that arena.
+
+        static Field newCExoString(GffLabel label, const std::string &val, GffArena *arena = nullptr);
+        static Field newResRef(GffLabel label, const std::string &val, GffArena *arena = nullptr);
+        static Field newCExoLocString(GffLabel label, int32_t strRef, const std::string &val, GffArena *arena = nullptr);
+        static Field newVoid(GffLabel label, const ByteArray &val, GffArena *arena = nullptr);
+        static Field newOrientation(GffLabel label, glm::quat val, GffArena *arena = nullptr);
+        static Field newVector(GffLabel label, glm::vec3 val, GffArena *arena = nullptr);
+
+    private:
+        union Value {
+            uint64_t uint64Value;
             int64_t int64Value;
-            uint64_t uint64Value { 0 };
+            uint32_t uintValue;
+            int32_t intValue;
             float floatValue;
             double doubleValue;
+            char *record;
+            std::vector<std::shared_ptr<GffStruct>> *children;
         };
 
-        Field() = default;
-        Field(FieldType type, std::string label);
-
-        static Field newByte(std::string label, uint32_t val);
-        static Field newChar(std::string label, int32_t val);
-        static Field newWord(std::string label, uint32_t val);
-        static Field newShort(std::string label, int32_t val);
-        static Field newDword(std::string label, uint32_t val);
-        static Field newInt(std::string label, int32_t val);
-        static Field newDword64(std::string label, uint64_t val);
-        static Field newInt64(std::string label, int64_t val);
-        static Field newFloat(std::string label, float val);
-        static Field newDouble(std::string label, double val);
-        static Field newCExoString(std::string label, std::string val);
-        static Field newResRef(std::string label, std::string val);
-        static Field newCExoLocString(std::string label, int32_t strRef, std::string val);
-        static Field newVoid(std::string label, ByteArray val);
-        static Field newStruct(std::string label, std::shared_ptr<GffStruct> val);
-        static Field newList(std::string label, std::vector<std::shared_ptr<GffStruct>> val);
-        static Field newOrientation(std::string label, glm::quat val);
-        static Field newVector(std::string label, glm::vec3 val);
-        static Field newStrRef(std::string label, int32_t val);
+        bool _ownsRecord { false };
+        Value _value { 0 };
+
+        bool hasRecord() const;
+        bool hasChildren() const;
+        size_t getRecordSize() const;
+
+        char *allocateRecord(size_t size, GffArena *arena);
+        void setString(int32_t strRef, const std::string &val, GffArena *arena);
+        void moveRecordTo(GffArena &arena);
+        void copyFrom(const Field &other);
+        void release();
+
+        friend class GffStruct;
     };
 
     GffStruct(uint32_t type);
-    GffStruct(uint32_t, std::vector<Field> fields);
+    GffStruct(uint32_t type, std::vector<Field> fields);
+
+    /**
+     * @param arena storage of field records, shared by structs of a GFF file
+     */
+    GffStruct(uint32_t type, std::shared_ptr<GffArena> arena);
 
     void add(Field &&field);
 
-    bool getBool(const std::string &name, bool defValue = false) const;
-    int getInt(const std::string &name, int defValue = 0) const;
-    uint32_t getUint(const std::string &name, uint32_t defValue = 0) const;
-    glm::vec3 getColor(const std::string &name, glm::vec3 defValue = glm::vec3(0.0f)) const;
-    float getFloat(const std::string &name, float defValue = 0.0f) const;
-    std::string getString(const std::string &name, std::string defValue = "") const;
-    glm::vec3 getVector(const std::string &name, glm::vec3 defValue = glm::vec3(0.0f)) const;
-    glm::quat getOrientation(const std::string &name, glm::quat defValue = glm::quat(1.0f, 0.0f, 0.0f, 0.0f)) const;
-    std::shared_ptr<GffStruct> getStruct(const std::string &name) const;
-    std::vector<std::shared_ptr<GffStruct>> getList(const std::string &name) const;
+    bool getBool(const GffLabel &label, bool defValue = false) const;
+    int getInt(const GffLabel &label, int defValue = 0) const;
+    uint32_t getUint(const GffLabel &label, uint32_t defValue = 0) const;
+    glm::vec3 getColor(const GffLabel &label, glm::vec3 defValue = glm::vec3(0.0f)) const;
+    float getFloat(const GffLabel &label, float defValue = 0.0f) const;
+    std::string getString(const GffLabel &label, std::string defValue = "") const;
+    glm::vec3 getVector(const GffLabel &label, glm::vec3 defValue = glm::vec3(0.0f)) const;
+    glm::quat getOrientation(const GffLabel &label, glm::quat defValue = glm::quat(1.0f, 0.0f, 0.0f, 0.0f)) const;
+    std::shared_ptr<GffStruct> getStruct(const GffLabel &label) const;
+    std::vector<std::shared_ptr<GffStruct>> getList(const GffLabel &label) const;
 
     uint32_t type() const { return _type; }
     const std::vector<Field> &fields() const { return _fields; }
+    std::shared_ptr<GffArena> arena() const { return _arena; }
 
     template <class T>
-    T getEnum(const std::string &name, T defValue) const {
-        return static_cast<T>(getInt(name, static_cast<int>(defValue)));
+    T getEnum(const GffLabel &label, T defValue) const {
+        return static_cast<T>(getInt(label, static_cast<int>(defValue)));
     }
 
 private:
     uint32_t _type { 0 };
     std::vector<Field> _fields;
+    std::shared_ptr<GffArena> _arena;
+    std::vector<int> _fieldIndex; /**< open-addressing hash table of field indices, empty if the struct has few fields */
 
-    const Field *get(const std::string &name) const;
+    const Field *get(const GffLabel &label) const;
 
-    friend class GffReader;
+    void indexField(int idx);
+    void rebuildFieldIndex();
 };
 
 } // namespace resource
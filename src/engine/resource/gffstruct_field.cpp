@@ -22,122 +22,361 @@ using namespace std;
 namespace reone {
 
 namespace resource {
+// Records of string fields are laid out as [int32 strRef][uint32 length][chars],
+// records of Void fields as [uint32 size][bytes], orientations as four floats
+// (w, x, y, z) and vectors as three floats. Records are unaligned and are
+// accessed with memcpy.
 
-GffStruct::Field::Field(FieldType type, string label) : type(type), label(move(label)) {
+static_assert(sizeof(GffStruct::Field) <= 16, "GFF fields must be compact");
+
+static constexpr size_t kStringHeaderSize = 8;
+static constexpr size_t kVoidHeaderSize = 4;
+
+static const vector<shared_ptr<GffStruct>> g_emptyChildren;
+
+GffStruct::Field::Field(FieldType type, GffLabel label) : label(move(label)), type(type) {
+}
+
+GffStruct::Field::Field(const Field &other) : label(other.label), type(other.type) {
+    copyFrom(other);
+}
+
+GffStruct::Field::Field(Field &&other) noexcept : label(other.label), type(other.type), _ownsRecord(other._ownsRecord), _value(other._value) {
+    other._ownsRecord = false;
+    other._value.uint64Value = 0;
+}
+
+GffStruct::Field::~Field() {
+    release();
+}
+
+GffStruct::Field &GffStruct::Field::operator=(const Field &other) {
+    if (this != &other) {
+        release();
+        label = other.label;
+        type = other.type;
+        copyFrom(other);
+    }
+    return *this;
+}
+
+GffStruct::Field &GffStruct::Field::operator=(Field &&other) noexcept {
+    if (this != &other) {
+        release();
+        label = other.label;
+        type = other.type;
+        _ownsRecord = other._ownsRecord;
+        _value = other._value;
+        other._ownsRecord = false;
+        other._value.uint64Value = 0;
+    }
+    return *this;
+}
+
+bool GffStruct::Field::hasRecord() const {
+    switch (type) {
+        case FieldType::CExoString:
+        case FieldType::ResRef:
+        case FieldType::CExoLocString:
+        case FieldType::Void:
+        case FieldType::Orientation:
+        case FieldType::Vector:
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool GffStruct::Field::hasChildren() const {
+    return type == FieldType::Struct || type == FieldType::List;
+}
+
+size_t GffStruct::Field::getRecordSize() const {
+    if (!hasRecord() || !_value.record) return 0;
+
+    switch (type) {
+        case FieldType::CExoString:
+        case FieldType::ResRef:
+        case FieldType::CExoLocString: {
+            uint32_t length;
+            memcpy(&length, _value.record + 4, 4);
+            return kStringHeaderSize + length;
+        }
+        case FieldType::Void: {
+            uint32_t size;
+            memcpy(&size, _value.record, 4);
+            return kVoidHeaderSize + size;
+        }
+        case FieldType::Orientation:
+            return 4 * sizeof(float);
+        case FieldType::Vector:
+            return 3 * sizeof(float);
+        default:
+            return 0;
+    }
+}
+
+char *GffStruct::Field::allocateRecord(size_t size, GffArena *arena) {
+    if (arena) {
+        _value.record = arena->allocate(size);
+        _ownsRecord = false;
+    } else {
+        _value.record = new char[size];
+        _ownsRecord = true;
+    }
+    return _value.record;
+}
+
+void GffStruct::Field::setString(int32_t strRef, const string &val, GffArena *arena) {
+    uint32_t length = static_cast<uint32_t>(val.length());
+    char *record = allocateRecord(kStringHeaderSize + length, arena);
+    memcpy(record, &strRef, 4);
+    memcpy(record + 4, &length, 4);
+    memcpy(record + kStringHeaderSize, val.data(), length);
+}
+
+void GffStruct::Field::moveRecordTo(GffArena &arena) {
+    if (!_ownsRecord) return;
+
+    size_t size = getRecordSize();
+    char *record = arena.allocate(size);
+    memcpy(record, _value.record, size);
+
+    delete[] _value.record;
+    _value.record = record;
+    _ownsRecord = false;
+}
+
+void GffStruct::Field::copyFrom(const Field &other) {
+    _ownsRecord = false;
+    _value = other._value;
+
+    if (other.hasChildren()) {
+        if (other._value.children) {
+            _value.children = new vector<shared_ptr<GffStruct>>(*other._value.children);
+        }
+    } else if (other.hasRecord()) {
+        // Records are always copied, so that a copy does not depend on the arena of its source
+        if (other._value.record) {
+            size_t size = other.getRecordSize();
+            memcpy(allocateRecord(size, nullptr), other._value.record, size);
+        }
+    }
+}
+
+void GffStruct::Field::release() {
+    if (hasChildren()) {
+        delete _value.children;
+    } else if (_ownsRecord) {
+        delete[] _value.record;
+    }
+    _ownsRecord = false;
+    _value.uint64Value = 0;
+}
+
+int32_t GffStruct::Field::intValue() const {
+    if (type == FieldType::CExoLocString) {
+        int32_t strRef = -1;
+        if (_value.record) {
+            memcpy(&strRef, _value.record, 4);
+        }
+        return strRef;
+    }
+    if (hasRecord() || hasChildren()) return 0;
+
+    return _value.intValue;
+}
+
+uint32_t GffStruct::Field::uintValue() const {
+    if (type == FieldType::CExoLocString) return static_cast<uint32_t>(intValue());
+    if (hasRecord() || hasChildren()) return 0;
+
+    return _value.uintValue;
+}
+
+int64_t GffStruct::Field::int64Value() const {
+    if (hasRecord() || hasChildren()) return 0;
+
+    return _value.int64Value;
+}
+
+uint64_t GffStruct::Field::uint64Value() const {
+    if (hasRecord() || hasChildren()) return 0;
+
+    return _value.uint64Value;
+}
+
+float GffStruct::Field::floatValue() const {
+    if (hasRecord() || hasChildren()) return 0.0f;
+
+    return _value.floatValue;
+}
+
+double GffStruct::Field::doubleValue() const {
+    if (hasRecord() || hasChildren()) return 0.0;
+
+    return _value.doubleValue;
+}
+
+string GffStruct::Field::strValue() const {
+    if (type != FieldType::CExoString && type != FieldType::ResRef && type != FieldType::CExoLocString) return "";
+    if (!_value.record) return "";
+
+    uint32_t length;
+    memcpy(&length, _value.record + 4, 4);
+
+    return string(_value.record + kStringHeaderSize, length);
+}
+
+ByteArray GffStruct::Field::data() const {
+    if (type != FieldType::Void || !_value.record) return ByteArray();
+
+    uint32_t size;
+    memcpy(&size, _value.record, 4);
+
+    return ByteArray(_value.record + kVoidHeaderSize, _value.record + kVoidHeaderSize + size);
+}
+
+glm::vec3 GffStruct::Field::vecValue() const {
+    glm::vec3 result(0.0f);
+    if (type == FieldType::Vector && _value.record) {
+        memcpy(&result[0], _value.record, 3 * sizeof(float));
+    }
+    return move(result);
+}
+
+glm::quat GffStruct::Field::quatValue() const {
+    if (type != FieldType::Orientation || !_value.record) return glm::quat(1.0f, 0.0f, 0.0f, 0.0f);
+
+    float values[4];
+    memcpy(values, _value.record, sizeof(values));
+
+    return glm::quat(values[0], values[1], values[2], values[3]);
+}
+
+const vector<shared_ptr<GffStruct>> &GffStruct::Field::children() const {
+    if (!hasChildren() || !_value.children) return g_emptyChildren;
+
+    return *_value.children;
 }
 
-GffStruct::Field GffStruct::Field::newByte(string label, uint32_t val) {
+GffStruct::Field GffStruct::Field::newByte(GffLabel label, uint32_t val) {
     GffStruct::Field tmp(GffStruct::FieldType::Byte, move(label));
-    tmp.uintValue = val;
+    tmp._value.uintValue = val;
     return move(tmp);
 }
 
-GffStruct::Field GffStruct::Field::newChar(string label, int32_t val) {
+GffStruct::Field GffStruct::Field::newChar(GffLabel label, int32_t val) {
     GffStruct::Field tmp(GffStruct::FieldType::Char, move(label));
-    tmp.intValue = val;
+    tmp._value.intValue = val;
     return move(tmp);
 }
 
-GffStruct::Field GffStruct::Field::newWord(string label, uint32_t val) {
+GffStruct::Field GffStruct::Field::newWord(GffLabel label, uint32_t val) {
     GffStruct::Field tmp(GffStruct::FieldType::Word, move(label));
-    tmp.uintValue = val;
+    tmp._value.uintValue = val;
     return move(tmp);
 }
 
-GffStruct::Field GffStruct::Field::newShort(string label, int32_t val) {
+GffStruct::Field GffStruct::Field::newShort(GffLabel label, int32_t val) {
     GffStruct::Field tmp(GffStruct::FieldType::Short, move(label));
-    tmp.intValue = val;
+    tmp._value.intValue = val;
     return move(tmp);
 }
 
-GffStruct::Field GffStruct::Field::newDword(string label, uint32_t val) {
+GffStruct::Field GffStruct::Field::newDword(GffLabel label, uint32_t val) {
     GffStruct::Field tmp(GffStruct::FieldType::Dword, move(label));
-    tmp.uintValue = val;
+    tmp._value.uintValue = val;
     return move(tmp);
 }
 
-GffStruct::Field GffStruct::Field::newInt(string label, int32_t val) {
+GffStruct::Field GffStruct::Field::newInt(GffLabel label, int32_t val) {
     GffStruct::Field tmp(GffStruct::FieldType::Int, move(label));
-    tmp.intValue = val;
+    tmp._value.intValue = val;
     return move(tmp);
 }
 
-GffStruct::Field GffStruct::Field::newDword64(string label, uint64_t val) {
+GffStruct::Field GffStruct::Field::newDword64(GffLabel label, uint64_t val) {
     GffStruct::Field tmp(GffStruct::FieldType::Dword64, move(label));
-    tmp.uint64Value = val;
+    tmp._value.uint64Value = val;
     return move(tmp);
 }
 
-GffStruct::Field GffStruct::Field::newInt64(string label, int64_t val) {
+GffStruct::Field GffStruct::Field::newInt64(GffLabel label, int64_t val) {
     GffStruct::Field tmp(GffStruct::FieldType::Int64, move(label));
-    tmp.int64Value = val;
+    tmp._value.int64Value = val;
     return move(tmp);
 }
 
-GffStruct::Field GffStruct::Field::newFloat(string label, float val) {
+GffStruct::Field GffStruct::Field::newFloat(GffLabel label, float val) {
     GffStruct::Field tmp(GffStruct::FieldType::Float, move(label));
-    tmp.floatValue = val;
+    tmp._value.floatValue = val;
     return move(tmp);
 }
 
-GffStruct::Field GffStruct::Field::newDouble(string label, double val) {
+GffStruct::Field GffStruct::Field::newDouble(GffLabel label, double val) {
     GffStruct::Field tmp(GffStruct::FieldType::Double, move(label));
-    tmp.doubleValue = val;
+    tmp._value.doubleValue = val;
     return move(tmp);
 }
 
-GffStruct::Field GffStruct::Field::newCExoString(string label, string val) {
+GffStruct::Field GffStruct::Field::newCExoString(GffLabel label, const string &val, GffArena *arena) {
     GffStruct::Field tmp(GffStruct::FieldType::CExoString, move(label));
-    tmp.strValue = move(val);
+    tmp.setString(-1, val, arena);
     return move(tmp);
 }
 
-GffStruct::Field GffStruct::Field::newResRef(string label, string val) {
+GffStruct::Field GffStruct::Field::newResRef(GffLabel label, const string &val, GffArena *arena) {
     GffStruct::Field tmp(GffStruct::FieldType::ResRef, move(label));
-    tmp.strValue = move(val);
+    tmp.setString(-1, val, arena);
     return move(tmp);
 }
 
-GffStruct::Field GffStruct::Field::newCExoLocString(string label, int32_t strRef, string val) {
+GffStruct::Field GffStruct::Field::newCExoLocString(GffLabel label, int32_t strRef, const string &val, GffArena *arena) {
     GffStruct::Field tmp(GffStruct::FieldType::CExoLocString, move(label));
-    tmp.intValue = strRef;
-    tmp.strValue = move(val);
+    tmp.setString(strRef, val, arena);
     return move(tmp);
 }
 
-GffStruct::Field GffStruct::Field::newVoid(string label, ByteArray val) {
+GffStruct::Field GffStruct::Field::newVoid(GffLabel label, const ByteArray &val, GffArena *arena) {
     GffStruct::Field tmp(GffStruct::FieldType::Void, move(label));
-    tmp.data = move(val);
+    uint32_t size = static_cast<uint32_t>(val.size());
+    char *record = tmp.allocateRecord(kVoidHeaderSize + size, arena);
+    memcpy(record, &size, 4);
+    if (size > 0) {
+        memcpy(record + kVoidHeaderSize, &val[0], size);
+    }
     return move(tmp);
 }
 
-GffStruct::Field GffStruct::Field::newStruct(string label, shared_ptr<GffStruct> val) {
+GffStruct::Field GffStruct::Field::newStruct(GffLabel label, shared_ptr<GffStruct> val) {
     GffStruct::Field tmp(GffStruct::FieldType::Struct, move(label));
-    tmp.children.push_back(move(val));
+    tmp._value.children = new vector<shared_ptr<GffStruct>> { move(val) };
     return move(tmp);
 }
 
-GffStruct::Field GffStruct::Field::newList(string label, vector<shared_ptr<GffStruct>> val) {
+GffStruct::Field GffStruct::Field::newList(GffLabel label, vector<shared_ptr<GffStruct>> val) {
     GffStruct::Field tmp(GffStruct::FieldType::List, move(label));
-    tmp.children = move(val);
+    tmp._value.children = new vector<shared_ptr<GffStruct>>(move(val));
     return move(tmp);
 }
 
-GffStruct::Field GffStruct::Field::newOrientation(string label, glm::quat val) {
+GffStruct::Field GffStruct::Field::newOrientation(GffLabel label, glm::quat val, GffArena *arena) {
     GffStruct::Field tmp(GffStruct::FieldType::Orientation, move(label));
-    tmp.quatValue = move(val);
+    float values[] { val.w, val.x, val.y, val.z };
+    memcpy(tmp.allocateRecord(sizeof(values), arena), values, sizeof(values));
     return move(tmp);
 }
 
-GffStruct::Field GffStruct::Field::newVector(string label, glm::vec3 val) {
+GffStruct::Field GffStruct::Field::newVector(GffLabel label, glm::vec3 val, GffArena *arena) {
     GffStruct::Field tmp(GffStruct::FieldType::Vector, move(label));
-    tmp.vecValue = move(val);
+    memcpy(tmp.allocateRecord(3 * sizeof(float), arena), &val[0], 3 * sizeof(float));
     return move(tmp);
 }
 
-GffStruct::Field GffStruct::Field::newStrRef(string label, int32_t val) {
+GffStruct::Field GffStruct::Field::newStrRef(GffLabel label, int32_t val) {
     GffStruct::Field tmp(GffStruct::FieldType::StrRef, move(label));
-    tmp.intValue = val;
+    tmp._value.intValue = val;
     return move(tmp);
 }
 
@@ -0,0 +1,269 @@
+/*
+ * Copyright (c) 2020-2021 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "gffview.h"
+
+using namespace std;
+
+namespace reone {
+
+namespace resource {
+
+static constexpr int kSignatureSize = 8;
+static constexpr int kHeaderSize = kSignatureSize + 12 * sizeof(uint32_t);
+static constexpr int kLabelSize = 16;
+
+GffView::GffView(ByteView data) {
+    if (data.size() < kHeaderSize) {
+        throw runtime_error("GFF: invalid file size");
+    }
+    auto file = make_shared<File>();
+    file->data = move(data);
+    file->reader = make_unique<MemoryReader>(file->data.data(), file->data.size());
+
+    const MemoryReader &reader = *file->reader;
+    file->structOffset = reader.getUint32(kSignatureSize);
+    file->structCount = reader.getUint32(kSignatureSize + 4);
+    file->fieldOffset = reader.getUint32(kSignatureSize + 8);
+    file->fieldCount = reader.getUint32(kSignatureSize + 12);
+    file->labelOffset = reader.getUint32(kSignatureSize + 16);
+    file->labelCount = reader.getUint32(kSignatureSize + 20);
+    file->fieldDataOffset = reader.getUint32(kSignatureSize + 24);
+    file->fieldIndicesOffset = reader.getUint32(kSignatureSize + 32);
+    file->listIndicesOffset = reader.getUint32(kSignatureSize + 40);
+
+    *this = GffView(move(file), 0);
+}
+
+GffView::GffView(shared_ptr<const File> file, uint32_t structIdx) : _file(move(file)) {
+    if (structIdx >= _file->structCount) {
+        throw runtime_error("GFF: struct index out of range: " + to_string(structIdx));
+    }
+    size_t off = _file->structOffset + 12ll * structIdx;
+
+    _type = _file->reader->getUint32(off);
+    _dataOffset = _file->reader->getUint32(off + 4);
+    _fieldCount = static_cast<int>(_file->reader->getUint32(off + 8));
+}
+
+static bool labelEquals(const char *label, const string &name) {
+    size_t len = name.size();
+    if (len > kLabelSize || memcmp(label, name.data(), len) != 0) return false;
+
+    return len == kLabelSize || label[len] == '\0';
+}
+
+bool GffView::findField(const string &name, FieldEntry &entry) const {
+    for (int i = 0; i < _fieldCount; ++i) {
+        uint32_t fieldIdx = getFieldIndex(i);
+        if (fieldIdx >= _file->fieldCount) {
+            throw runtime_error("GFF: field index out of range: " + to_string(fieldIdx));
+        }
+        size_t off = _file->fieldOffset + 12ll * fieldIdx;
+
+        uint32_t labelIdx = _file->reader->getUint32(off + 4);
+        if (labelIdx >= _file->labelCount) {
+            throw runtime_error("GFF: label index out of range: " + to_string(labelIdx));
+        }
+        const char *label = _file->reader->data(_file->labelOffset + static_cast<size_t>(kLabelSize) * labelIdx, kLabelSize);
+        if (!labelEquals(label, name)) continue;
+
+        entry.type = static_cast<GffStruct::FieldType>(_file->reader->getUint32(off));
+        entry.dataOrDataOffset = _file->reader->getUint32(off + 8);
+
+        return true;
+    }
+
+    return false;
+}
+
+uint32_t GffView::getFieldIndex(int idx) const {
+    // A struct with a single field stores its index in place of the data offset
+    if (_fieldCount == 1) return _dataOffset;
+
+    return _file->reader->getUint32(static_cast<size_t>(_file->fieldIndicesOffset) + _dataOffset + 4ll * idx);
+}
+
+uint64_t GffView::getScalar(const FieldEntry &entry) const {
+    size_t dataOff = static_cast<size_t>(_file->fieldDataOffset) + entry.dataOrDataOffset;
+
+    switch (entry.type) {
+        case GffStruct::FieldType::Byte:
+        case GffStruct::FieldType::Char:
+        case GffStruct::FieldType::Word:
+        case GffStruct::FieldType::Short:
+        case GffStruct::FieldType::Dword:
+        case GffStruct::FieldType::Int:
+        case GffStruct::FieldType::Float:
+            return entry.dataOrDataOffset;
+        case GffStruct::FieldType::Dword64:
+        case GffStruct::FieldType::Int64:
+        case GffStruct::FieldType::Double:
+            return _file->reader->getUint32(dataOff) | (static_cast<uint64_t>(_file->reader->getUint32(dataOff + 4)) << 32);
+        case GffStruct::FieldType::CExoLocString:
+        case GffStruct::FieldType::StrRef:
+            return _file->reader->getUint32(dataOff + 4);
+        default:
+            return 0;
+    }
+}
+
+string GffView::getStringValue(const FieldEntry &entry) const {
+    size_t dataOff = static_cast<size_t>(_file->fieldDataOffset) + entry.dataOrDataOffset;
+
+    switch (entry.type) {
+        case GffStruct::FieldType::CExoString:
+            return _file->reader->getCString(dataOff + 4, _file->reader->getUint32(dataOff));
+        case GffStruct::FieldType::ResRef:
+            return _file->reader->getCString(dataOff + 1, _file->reader->getByte(dataOff));
+        case GffStruct::FieldType::CExoLocString: {
+            // Only the first substring is supported, as in GffReader
+            uint32_t count = _file->reader->getUint32(dataOff + 8);
+            if (count == 0) return "";
+
+            return _file->reader->getCString(dataOff + 20, _file->reader->getUint32(dataOff + 16));
+        }
+        default:
+            return "";
+    }
+}
+
+bool GffView::getBool(const string &name, bool defValue) const {
+    FieldEntry entry;
+    if (!findField(name, entry)) return defValue;
+
+    return static_cast<uint32_t>(getScalar(entry)) != 0;
+}
+
+int GffView::getInt(const string &name, int defValue) const {
+    FieldEntry entry;
+    if (!findField(name, entry)) return defValue;
+
+    return static_cast<int32_t>(getScalar(entry));
+}
+
+uint32_t GffView::getUint(const string &name, uint32_t defValue) const {
+    FieldEntry entry;
+    if (!findField(name, entry)) return defValue;
+
+    return static_cast<uint32_t>(getScalar(entry));
+}
+
+glm::vec3 GffView::getColor(const string &name, glm::vec3 defValue) const {
+    FieldEntry entry;
+    if (!findField(name, entry)) return move(defValue);
+
+    uint32_t value = static_cast<uint32_t>(getScalar(entry));
+
+    glm::vec3 result(
+        value & 0xff,
+        (value >> 8) & 0xff,
+        (value >> 16) & 0xff);
+
+    result /= 255.0f;
+
+    return move(result);
+}
+
+float GffView::getFloat(const string &name, float defValue) const {
+    FieldEntry entry;
+    if (!findField(name, entry)) return defValue;
+
+    uint32_t bits = static_cast<uint32_t>(getScalar(entry));
+    float value;
+    memcpy(&value, &bits, sizeof(float));
+
+    return value;
+}
+
+string GffView::getString(const string &name, string defValue) const {
+    FieldEntry entry;
+    if (!findField(name, entry)) return move(defValue);
+
+    return getStringValue(entry);
+}
+
+glm::vec3 GffView::getVector(const string &name, glm::vec3 defValue) const {
+    FieldEntry entry;
+    if (!findField(name, entry)) return move(defValue);
+    if (entry.type != GffStruct::FieldType::Vector) return glm::vec3(0.0f);
+
+    vector<float> values(_file->reader->getFloatArray(static_cast<size_t>(_file->fieldDataOffset) + entry.dataOrDataOffset, 3));
+
+    return glm::vec3(values[0], values[1], values[2]);
+}
+
+glm::quat GffView::getOrientation(const string &name, glm::quat defValue) const {
+    FieldEntry entry;
+    if (!findField(name, entry)) return move(defValue);
+    if (entry.type != GffStruct::FieldType::Orientation) return glm::quat(1.0f, 0.0f, 0.0f, 0.0f);
+
+    vector<float> values(_file->reader->getFloatArray(static_cast<size_t>(_file->fieldDataOffset) + entry.dataOrDataOffset, 4));
+
+    return glm::quat(values[0], values[1], values[2], values[3]);
+}
+
+GffView GffView::getStruct(const string &name) const {
+    FieldEntry entry;
+    if (!findField(name, entry)) return GffView();
+
+    switch (entry.type) {
+        case GffStruct::FieldType::Struct:
+            return GffView(_file, entry.dataOrDataOffset);
+        case GffStruct::FieldType::List: {
+            size_t off = static_cast<size_t>(_file->listIndicesOffset) + entry.dataOrDataOffset;
+            if (_file->reader->getUint32(off) == 0) return GffView();
+
+            return GffView(_file, _file->reader->getUint32(off + 4));
+        }
+        default:
+            return GffView();
+    }
+}
+
+vector<GffView> GffView::getList(const string &name) const {
+    vector<GffView> result;
+
+    FieldEntry entry;
+    if (!findField(name, entry)) return move(result);
+
+    switch (entry.type) {
+        case GffStruct::FieldType::Struct:
+            result.push_back(GffView(_file, entry.dataOrDataOffset));
+            break;
+        case GffStruct::FieldType::List: {
+            size_t off = static_cast<size_t>(_file->listIndicesOffset) + entry.dataOrDataOffset;
+            uint32_t count = _file->reader->getUint32(off);
+            if (count > _file->structCount) {
+                throw runtime_error("GFF: invalid list size: " + to_string(count));
+            }
+            result.reserve(count);
+            for (uint32_t i = 0; i < count; ++i) {
+                result.push_back(GffView(_file, _file->reader->getUint32(off + 4 + 4ll * i)));
+            }
+            break;
+        }
+        default:
+            break;
+    }
+
+    return move(result);
+}
+
+} // namespace resource
+
+} // namespace reone
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2020-2021 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../common/byteview.h"
+#include "../common/memoryreader.h"
+#include "../common/types.h"
+
+#include "gffstruct.h"
+
+namespace reone {
+
+namespace resource {
+
+/**
+ * Read-only view of a GFF struct, that decodes fields, labels and lists on
+ * demand from the raw file contents, instead of building a GffStruct tree.
+ * Accessors mirror those of GffStruct.
+ *
+ * Views are cheap to copy and share ownership of the file contents. A
+ * default-constructed view has no fields and evaluates to false.
+ */
+class GffView {
+public:
+    GffView() = default;
+
+    /**
+     * Constructs a view of the root struct of the GFF file.
+     *
+     * @throws std::runtime_error if the file header is invalid
+     */
+    explicit GffView(ByteView data);
+
+    bool getBool(const std::string &name, bool defValue = false) const;
+    int getInt(const std::string &name, int defValue = 0) const;
+    uint32_t getUint(const std::string &name, uint32_t defValue = 0) const;
+    glm::vec3 getColor(const std::string &name, glm::vec3 defValue = glm::vec3(0.0f)) const;
+    float getFloat(const std::string &name, float defValue = 0.0f) const;
+    std::string getString(const std::string &name, std::string defValue = "") const;
+    glm::vec3 getVector(const std::string &name, glm::vec3 defValue = glm::vec3(0.0f)) const;
+    glm::quat getOrientation(const std::string &name, glm::quat defValue = glm::quat(1.0f, 0.0f, 0.0f, 0.0f)) const;
+    GffView getStruct(const std::string &name) const;
+    std::vector<GffView> getList(const std::string &name) const;
+
+    uint32_t type() const { return _type; }
+    int fieldCount() const { return _fieldCount; }
+
+    template <class T>
+    T getEnum(const std::string &name, T defValue) const {
+        return static_cast<T>(getInt(name, static_cast<int>(defValue)));
+    }
+
+    explicit operator bool() const { return static_cast<bool>(_file); }
+
+private:
+    struct File {
+        ByteView data;
+        std::unique_ptr<MemoryReader> reader;
+        uint32_t structOffset { 0 };
+        uint32_t structCount { 0 };
+        uint32_t fieldOffset { 0 };
+        uint32_t fieldCount { 0 };
+        uint32_t labelOffset { 0 };
+        uint32_t labelCount { 0 };
+        uint32_t fieldDataOffset { 0 };
+        uint32_t fieldIndicesOffset { 0 };
+        uint32_t listIndicesOffset { 0 };
+    };
+
+    struct FieldEntry {
+        GffStruct::FieldType type { GffStruct::FieldType::Int };
+        uint32_t dataOrDataOffset { 0 };
+    };
+
+    std::shared_ptr<const File> _file;
+    uint32_t _type { 0 };
+    uint32_t _dataOffset { 0 };
+    int _fieldCount { 0 };
+
+    GffView(std::shared_ptr<const File> file, uint32_t structIdx);
+
+    bool findField(const std::string &name, FieldEntry &entry) const;
+    uint32_t getFieldIndex(int idx) const;
+
+    /**
+     * @return bits of the scalar value of the field, as GffReader stores them
+     *         in the GffStruct::Field union
+     */
+    uint64_t getScalar(const FieldEntry &entry) const;
+
+    std::string getStringValue(const FieldEntry &entry) const;
+};
+
+} // namespace resource
+
+} // namespace reone
@@ -37,34 +37,50 @@ void KeyBifResourceProvider::init(const fs::path &keyPath) {
     _keyFile.load(keyPath);
 }
 
-shared_ptr<ByteArray> KeyBifResourceProvider::find(const std::string &resRef, ResourceType type) {
-    KeyReader::KeyEntry key;
-    if (!_keyFile.find(resRef, type, key)) return nullptr;
+shared_ptr<ByteArray> KeyBifResourceProvider::find(const ResRef &resRef, ResourceType type) {
+    const KeyReader::KeyEntry *key = _keyFile.find(resRef, type);
+    if (!key) return nullptr;
 
-    shared_ptr<ByteArray> result;
+    return getBif(key->bifIdx).getResourceData(key->resIdx);
+}
+
+ByteView KeyBifResourceProvider::findView(const ResRef &resRef, ResourceType type) {
+    const KeyReader::KeyEntry *key = _keyFile.find(resRef, type);
+    if (!key) return ByteView();
+
+    return getBif(key->bifIdx).getResourceView(key->resIdx);
+}
 
-    auto maybeBif = _bifCache.find(key.bifIdx);
-    if (maybeBif != _bifCache.end()) {
-        result = maybeBif->second->getResourceData(key.resIdx);
+void KeyBifResourceProvider::forEachResource(const function<void(int, const ResRef &, ResourceType)> &fn) {
+    const vector<KeyReader::KeyEntry> &keys = _keyFile.keys();
+    for (size_t i = 0; i < keys.size(); ++i) {
+        fn(static_cast<int>(i), keys[i].resRef, keys[i].resType);
+    }
+}
 
-    } else {
-        string filename(_keyFile.getFilename(key.bifIdx).c_str());
-        boost::replace_all(filename, "\\", "/");
+ByteView KeyBifResourceProvider::getResourceView(int idx) {
+    const KeyReader::KeyEntry &key = _keyFile.keys().at(idx);
+    return getBif(key.bifIdx).getResourceView(key.resIdx);
+}
 
-        fs::path bifPath(getPathIgnoreCase(_gamePath, filename));
-        if (bifPath.empty()) {
-            throw runtime_error(str(boost::format("BIF file not found: %s %s") % _gamePath % filename));
-        }
+BifReader &KeyBifResourceProvider::getBif(int bifIdx) {
+    lock_guard<mutex> lock(_bifCacheMutex);
 
-        auto bif = make_unique<BifReader>();
-        bif->load(bifPath);
+    auto maybeBif = _bifCache.find(bifIdx);
+    if (maybeBif != _bifCache.end()) return *maybeBif->second;
 
-        result = bif->getResourceData(key.resIdx);
+    string filename(_keyFile.getFilename(bifIdx).c_str());
+    boost::replace_all(filename, "\\", "/");
 
-        _bifCache.insert(make_pair(key.bifIdx, move(bif)));
+    fs::path bifPath(getPathIgnoreCase(_gamePath, filename));
+    if (bifPath.empty()) {
+        throw runtime_error(str(boost::format("BIF file not found: %s %s") % _gamePath % filename));
     }
 
-    return move(result);
+    auto bif = make_unique<BifReader>();
+    bif->load(bifPath);
+
+    return *_bifCache.insert(make_pair(bifIdx, move(bif))).first->second;
 }
 
 bool KeyBifResourceProvider::supports(ResourceType type) const {
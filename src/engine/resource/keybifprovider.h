@@ -29,7 +29,10 @@ class KeyBifResourceProvider : public IResourceProvider {
 public:
     void init(const boost::filesystem::path &keyPath);
 
-    std::shared_ptr<ByteArray> find(const std::string &resRef, ResourceType type) override;
+    std::shared_ptr<ByteArray> find(const ResRef &resRef, ResourceType type) override;
+    ByteView findView(const ResRef &resRef, ResourceType type) override;
+    void forEachResource(const std::function<void(int, const ResRef &, ResourceType)> &fn) override;
+    ByteView getResourceView(int idx) override;
 
     bool supports(ResourceType type) const override;
 
@@ -37,6 +40,9 @@ private:
     boost::filesystem::path _gamePath;
     KeyReader _keyFile;
     std::unordered_map<int, std::unique_ptr<BifReader>> _bifCache;
+    std::mutex _bifCacheMutex;
+
+    BifReader &getBif(int bifIdx);
 };
 
 } // namespace resource
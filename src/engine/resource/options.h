@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) 2020-2021 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+namespace reone {
+
+namespace resource {
+
+struct ResourceOptions {
+    int cacheSize { 0 }; /**< resource cache budget in megabytes, 0 for unlimited */
+    std::string cookedCachePath; /**< cooked asset cache directory, empty to disable the cache */
+    std::string statsPath; /**< resource access statistics are written here on shutdown, empty to disable */
+};
+
+} // namespace resource
+
+} // namespace reone
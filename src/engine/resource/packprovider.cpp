@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2020-2021 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "packprovider.h"
+
+#include "../common/lz4codec.h"
+
+using namespace std;
+
+namespace reone {
+
+namespace resource {
+
+struct EntryLayout {
+    static constexpr int resRef = 0;
+    static constexpr int resType = 16;
+    static constexpr int compression = 18;
+    static constexpr int hash = 20;
+    static constexpr int offset = 24;
+    static constexpr int size = 32;
+    static constexpr int originalSize = 36;
+};
+
+template <class T>
+static T getValue(const char *data) {
+    T result;
+    memcpy(&result, data, sizeof(T));
+    return boost::endian::little_to_native(result);
+}
+
+PackResourceProvider::PackResourceProvider() : BinaryReader(8, "RPK V1.0") {
+}
+
+void PackResourceProvider::doLoad() {
+    uint32_t entryCount = readUint32();
+    uint32_t bucketCount = readUint32();
+    uint32_t bucketsOffset = readUint32();
+    uint32_t entriesOffset = readUint32();
+
+    if (bucketCount == 0 || (bucketCount & (bucketCount - 1)) != 0) {
+        throw runtime_error("Pack: bucket count must be a power of two: " + to_string(bucketCount));
+    }
+    if (entryCount > numeric_limits<int>::max() / kEntrySize) {
+        throw runtime_error("Pack: entry count is out of range: " + to_string(entryCount));
+    }
+    _entryCount = static_cast<int>(entryCount);
+    _bucketCount = bucketCount;
+    _buckets = readView(bucketsOffset, static_cast<int>(4 * (bucketCount + 1)));
+    _entries = readView(entriesOffset, _entryCount * kEntrySize);
+}
+
+bool PackResourceProvider::supports(ResourceType type) const {
+    return true;
+}
+
+shared_ptr<ByteArray> PackResourceProvider::find(const ResRef &resRef, ResourceType type) {
+    ByteView view(findView(resRef, type));
+    if (!view) return nullptr;
+
+    return make_shared<ByteArray>(view.toArray());
+}
+
+ByteView PackResourceProvider::findView(const ResRef &resRef, ResourceType type) {
+    int idx = getResourceIndex(ResourceId(resRef, type));
+    if (idx == -1) return ByteView();
+
+    return getResourceView(idx);
+}
+
+int PackResourceProvider::getResourceIndex(const ResourceId &id) const {
+    uint32_t hash = id.hash();
+    uint32_t bucket = hash & (_bucketCount - 1);
+    auto first = static_cast<int>(min<uint32_t>(getValue<uint32_t>(_buckets.data() + 4 * bucket), _entryCount));
+    auto last = static_cast<int>(min<uint32_t>(getValue<uint32_t>(_buckets.data() + 4 * (bucket + 1)), _entryCount));
+
+    for (int i = first; i < last; ++i) {
+        const char *entry = getEntry(i);
+        if (getValue<uint32_t>(entry + EntryLayout::hash) == hash &&
+            getValue<uint16_t>(entry + EntryLayout::resType) == static_cast<uint16_t>(id.type) &&
+            memcmp(entry + EntryLayout::resRef, id.resRef.data(), ResRef::kMaxLength) == 0) return i;
+    }
+
+    return -1;
+}
+
+void PackResourceProvider::forEachResource(const function<void(int, const ResRef &, ResourceType)> &fn) {
+    for (int i = 0; i < _entryCount; ++i) {
+        const char *entry = getEntry(i);
+        ResRef resRef(entry + EntryLayout::resRef, strnlen(entry + EntryLayout::resRef, ResRef::kMaxLength));
+        auto type = static_cast<ResourceType>(getValue<uint16_t>(entry + EntryLayout::resType));
+        fn(i, resRef, type);
+    }
+}
+
+ByteView PackResourceProvider::getResourceView(int idx) {
+    if (idx < 0 || idx >= _entryCount) {
+        throw out_of_range("Pack: resource index out of range: " + to_string(idx));
+    }
+    const char *entry = getEntry(idx);
+    auto offset = getValue<uint64_t>(entry + EntryLayout::offset);
+    auto size = getValue<uint32_t>(entry + EntryLayout::size);
+    auto originalSize = getValue<uint32_t>(entry + EntryLayout::originalSize);
+    auto compression = static_cast<Compression>(getValue<uint16_t>(entry + EntryLayout::compression));
+
+    if (size > static_cast<uint32_t>(numeric_limits<int>::max()) || offset > _size) {
+        throw runtime_error("Pack: resource data out of range: " + to_string(idx));
+    }
+    ByteView data(readView(static_cast<size_t>(offset), static_cast<int>(size)));
+
+    switch (compression) {
+        case Compression::None:
+            return move(data);
+        case Compression::LZ4: {
+            auto decompressed = make_shared<ByteArray>(originalSize);
+            decompressLZ4(data.data(), data.size(), decompressed->data(), decompressed->size());
+            return ByteView(move(decompressed));
+        }
+        default:
+            throw runtime_error("Pack: unsupported compression: " + to_string(static_cast<int>(compression)));
+    }
+}
+
+const char *PackResourceProvider::getEntry(int idx) const {
+    return _entries.data() + static_cast<size_t>(idx) * kEntrySize;
+}
+
+} // namespace resource
+
+} // namespace reone
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2020-2021 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "format/binreader.h"
+#include "resourceprovider.h"
+#include "types.h"
+
+namespace reone {
+
+namespace resource {
+
+constexpr char kResourcePackFilename[] = "reone.rpk"; /**< name of a resource pack created from a game directory */
+
+/**
+ * Resource provider backed by a resource pack, the single-file archive
+ * format of reone, that merges resources of a game installation. The pack
+ * index is hashed and looked up in place, i.e. it is never parsed into
+ * memory, and resource data is served directly from the memory-mapped file
+ * unless compressed.
+ *
+ * File layout, all integers are little-endian:
+ * - header, kHeaderSize bytes: signature "RPK V1.0", entry count, bucket
+ *   count (power of two), offset to bucket table, offset to entry table
+ * - bucket table: for each of bucketCount + 1 buckets, uint32 index of the
+ *   first entry in that bucket
+ * - entry table, kEntrySize bytes per entry, ordered by bucket: zero-padded
+ *   ResRef (16 bytes), uint16 ResType, uint16 compression, uint32 hash,
+ *   uint64 offset to data, uint32 stored size, uint32 original size
+ * - resource data: resources of at least kPageSize bytes start on a page
+ *   boundary, smaller resources do not straddle page boundaries
+ *
+ * The bucket of a resource is selected by the low bits of ResourceId::hash,
+ * which is therefore part of the format.
+ */
+class PackResourceProvider : public BinaryReader, public IResourceProvider {
+public:
+    enum class Compression {
+        None = 0,
+        LZ4 = 1
+    };
+
+    static constexpr int kHeaderSize = 32;
+    static constexpr int kEntrySize = 40;
+    static constexpr int kPageSize = 4096;
+
+    PackResourceProvider();
+
+    bool supports(ResourceType type) const override;
+    std::shared_ptr<ByteArray> find(const ResRef &resRef, ResourceType type) override;
+    ByteView findView(const ResRef &resRef, ResourceType type) override;
+    void forEachResource(const std::function<void(int, const ResRef &, ResourceType)> &fn) override;
+
+    /**
+     * @return view of the data of the resource at the specified index, a copy if the resource is compressed
+     */
+    ByteView getResourceView(int idx) override;
+
+    int entryCount() const { return _entryCount; }
+
+private:
+    int _entryCount { 0 };
+    uint32_t _bucketCount { 0 };
+    ByteView _buckets;
+    ByteView _entries;
+
+    void doLoad() override;
+
+    int getResourceIndex(const ResourceId &id) const;
+    const char *getEntry(int idx) const;
+};
+
+} // namespace resource
+
+} // namespace reone
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2020-2021 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "prefetchbatch.h"
+
+#include "../common/log.h"
+
+using namespace std;
+
+namespace reone {
+
+namespace resource {
+
+PrefetchBatch::PrefetchBatch(int size, function<void()> onComplete) :
+    _remaining(size),
+    _future(_promise.get_future().share()),
+    _onComplete(move(onComplete)) {
+
+    if (size == 0) {
+        complete();
+    }
+}
+
+void PrefetchBatch::finishOne(bool loaded) {
+    if (loaded) {
+        ++_loaded;
+    }
+    if (--_remaining == 0) {
+        complete();
+    }
+}
+
+void PrefetchBatch::complete() {
+    if (_onComplete) {
+        try {
+            _onComplete();
+        } catch (const exception &e) {
+            warn("Prefetch completion handler failed: " + string(e.what()));
+        }
+    }
+    _promise.set_value();
+}
+
+} // namespace resource
+
+} // namespace reone
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2020-2021 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+namespace reone {
+
+namespace resource {
+
+/**
+ * Handle of a batch of resources requested by Resources::prefetch. The
+ * batch is complete when every resource is either loaded into the cache,
+ * or skipped due to cancellation.
+ */
+class PrefetchBatch : boost::noncopyable {
+public:
+    /**
+     * @param size number of resources in this batch
+     * @param onComplete function to call on completion, may be empty
+     */
+    PrefetchBatch(int size, std::function<void()> onComplete = nullptr);
+
+    /**
+     * Skips resources of this batch, that are not being loaded yet.
+     */
+    void cancel() { _cancelled = true; }
+
+    /**
+     * Blocks until this batch is complete.
+     */
+    void wait() const { _future.wait(); }
+
+    /**
+     * Called when a resource of this batch is loaded or skipped. Completes
+     * this batch when called for the last resource.
+     */
+    void finishOne(bool loaded);
+
+    bool isCancelled() const { return _cancelled; }
+    bool isComplete() const { return _remaining == 0; }
+
+    /**
+     * @return future, that becomes ready when this batch is complete
+     */
+    std::shared_future<void> future() const { return _future; }
+
+    /**
+     * @return number of resources, that were loaded by this batch
+     */
+    int loadedCount() const { return _loaded; }
+
+private:
+    std::atomic_bool _cancelled { false };
+    std::atomic_int _remaining { 0 };
+    std::atomic_int _loaded { 0 };
+    std::promise<void> _promise;
+    std::shared_future<void> _future;
+    std::function<void()> _onComplete;
+
+    void complete();
+};
+
+} // namespace resource
+
+} // namespace reone
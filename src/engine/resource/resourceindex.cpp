@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2020-2021 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "resourceindex.h"
+
+using namespace std;
+
+namespace reone {
+
+namespace resource {
+
+void ResourceIndex::reserve(int count) {
+    size_t capacity = 16;
+    while (capacity < 2 * static_cast<size_t>(count)) {
+        capacity *= 2;
+    }
+    if (capacity <= _slots.size()) return;
+
+    vector<Slot> slots(move(_slots));
+    _slots = vector<Slot>(capacity);
+    _size = 0;
+
+    for (auto &slot : slots) {
+        if (slot.value >= 0) {
+            insert(slot);
+        }
+    }
+}
+
+void ResourceIndex::clear() {
+    _slots.clear();
+    _size = 0;
+}
+
+void ResourceIndex::add(const ResourceId &id, int value) {
+    Slot slot;
+    slot.id = id;
+    slot.hash = id.hash();
+    slot.value = value;
+
+    if (2 * (_size + 1) > static_cast<int>(_slots.size())) {
+        grow();
+    }
+    insert(slot);
+}
+
+void ResourceIndex::insert(const Slot &slot) {
+    size_t mask = _slots.size() - 1;
+
+    for (size_t i = slot.hash & mask;; i = (i + 1) & mask) {
+        Slot &existing = _slots[i];
+        if (existing.value < 0) {
+            existing = slot;
+            ++_size;
+            return;
+        }
+        if (existing.hash == slot.hash && existing.id == slot.id) {
+            existing.value = slot.value;
+            return;
+        }
+    }
+}
+
+void ResourceIndex::grow() {
+    reserve(2 * (_size + 1));
+}
+
+void ResourceIndex::forEachHash(const function<void(uint32_t)> &fn) const {
+    for (auto &slot : _slots) {
+        if (slot.value >= 0) {
+            fn(slot.hash);
+        }
+    }
+}
+
+bool ResourceIndex::find(const ResourceId &id, int &value) const {
+    if (_slots.empty()) return false;
+
+    uint32_t hash = id.hash();
+    size_t mask = _slots.size() - 1;
+
+    for (size_t i = hash & mask;; i = (i + 1) & mask) {
+        const Slot &slot = _slots[i];
+        if (slot.value < 0) return false;
+
+        if (slot.hash == hash && slot.id == id) {
+            value = slot.value;
+            return true;
+        }
+    }
+}
+
+} // namespace resource
+
+} // namespace reone
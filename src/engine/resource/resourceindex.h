@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2020-2021 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "resref.h"
+#include "types.h"
+
+namespace reone {
+
+namespace resource {
+
+/**
+ * Open-addressing hash table, that maps resources to integer values, e.g.
+ * entry indices of a resource archive. Lookups do not allocate memory.
+ */
+class ResourceIndex {
+public:
+    void reserve(int count);
+    void clear();
+
+    /**
+     * Associates the value with the specified resource, replacing an existing
+     * value, if any.
+     */
+    void add(const ResourceId &id, int value);
+
+    /**
+     * @return true if the resource is present in this index, false otherwise
+     */
+    bool find(const ResourceId &id, int &value) const;
+
+    /**
+     * Calls the specified function for hashes of all resources in this index,
+     * as returned by ResourceId::hash.
+     */
+    void forEachHash(const std::function<void(uint32_t)> &fn) const;
+
+    int size() const { return _size; }
+
+private:
+    struct Slot {
+        ResourceId id;
+        uint32_t hash { 0 };
+        int value { -1 }; /**< negative value denotes an empty slot */
+    };
+
+    std::vector<Slot> _slots;
+    int _size { 0 };
+
+    void insert(const Slot &slot);
+    void grow();
+};
+
+} // namespace resource
+
+} // namespace reone
@@ -17,8 +17,10 @@
 
 #pragma once
 
+#include "../common/byteview.h"
 #include "../common/types.h"
 
+#include "resref.h"
 #include "types.h"
 
 namespace reone {
@@ -33,7 +35,30 @@ public:
     virtual ~IResourceProvider() {
     }
 
-    virtual std::shared_ptr<ByteArray> find(const std::string &resRef, ResourceType type) = 0;
+    virtual std::shared_ptr<ByteArray> find(const ResRef &resRef, ResourceType type) = 0;
+
+    /**
+     * Looks up a resource without copying its data, if possible. Default
+     * implementation returns a view of the byte array returned by find.
+     *
+     * @return view of the resource data, or an empty view if not found
+     */
+    virtual ByteView findView(const ResRef &resRef, ResourceType type) {
+        return ByteView(find(resRef, type));
+    }
+
+    /**
+     * Calls the specified function for every resource of this provider,
+     * passing its index, ResRef and ResType. When a resource occurs more than
+     * once, the first occurrence is the one returned by find.
+     */
+    virtual void forEachResource(const std::function<void(int, const ResRef &, ResourceType)> &fn) = 0;
+
+    /**
+     * @return view of the data of the resource at the specified index, as
+     *         passed to forEachResource
+     */
+    virtual ByteView getResourceView(int idx) = 0;
 
     /**
      * @return true if this resource provider supports the specified ResType,
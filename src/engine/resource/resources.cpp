@@ -21,7 +21,7 @@
 
 #include "../common/log.h"
 #include "../common/pathutil.h"
-#include "../common/streamutil.h"
+#include "../common/stopwatch.h"
 
 #include "format/2dareader.h"
 #include "format/bifreader.h"
@@ -30,6 +30,7 @@
 #include "format/rimreader.h"
 #include "folder.h"
 #include "keybifprovider.h"
+#include "packprovider.h"
 #include "typeutil.h"
 
 using namespace std;
@@ -40,13 +41,31 @@ namespace reone {
 
 namespace resource {
 
+static constexpr size_t kCacheEntryOverhead = 64; /**< approximate memory overhead of a cache entry, in bytes */
+static constexpr int kNumPrefetchThreads = 2;
+
+Resources::Resources(size_t cacheBudget) :
+    _rawCache(cacheBudget / 2),
+    _2daCache(cacheBudget / 4),
+    _gffCache(cacheBudget / 4) {
+}
+
+Resources::~Resources() {
+    cancelPrefetch();
+    _prefetchPool.reset();
+}
+
+static size_t getCacheCost(size_t dataSize) {
+    return kCacheEntryOverhead + dataSize;
+}
+
 void Resources::indexKeyFile(const fs::path &path) {
     if (!fs::exists(path)) return;
 
     auto keyBif = make_unique<KeyBifResourceProvider>();
     keyBif->init(path);
 
-    _providers.push_back(move(keyBif));
+    addProvider(move(keyBif), path.filename().string(), false);
 
     debug("Indexed " + path.string());
 }
@@ -57,11 +76,7 @@ void Resources::indexErfFile(const fs::path &path, bool transient) {
     auto erf = make_unique<ErfReader>();
     erf->load(path);
 
-    if (transient) {
-        _transientProviders.push_back(move(erf));
-    } else {
-        _providers.push_back(move(erf));
-    }
+    addProvider(move(erf), path.filename().string(), transient);
 
     debug("Indexed " + path.string());
 }
@@ -72,11 +87,7 @@ void Resources::indexRimFile(const fs::path &path, bool transient) {
     auto rim = make_unique<RimReader>();
     rim->load(path);
 
-    if (transient) {
-        _transientProviders.push_back(move(rim));
-    } else {
-        _providers.push_back(move(rim));
-    }
+    addProvider(move(rim), path.filename().string(), transient);
 
     debug("Indexed " + path.string());
 }
@@ -87,7 +98,18 @@ void Resources::indexDirectory(const fs::path &path) {
     auto folder = make_unique<Folder>();
     folder->load(path);
 
-    _providers.push_back(move(folder));
+    addProvider(move(folder), path.filename().string(), false);
+
+    debug("Indexed " + path.string());
+}
+
+void Resources::indexPackFile(const fs::path &path, bool transient) {
+    if (!fs::exists(path)) return;
+
+    auto pack = make_unique<PackResourceProvider>();
+    pack->load(path);
+
+    addProvider(move(pack), path.filename().string(), transient);
 
     debug("Indexed " + path.string());
 }
@@ -100,95 +122,302 @@ void Resources::indexExeFile(const fs::path &path) {
     debug("Indexed " + path.string());
 }
 
+static void logCacheStats(const string &name, const CacheStats &stats) {
+    debug(boost::format("Resources: %s cache: %d objects, %d bytes, %d hits, %d misses, %d evictions") % name % stats.count % stats.bytes % stats.hits % stats.misses % stats.evictions);
+}
+
 void Resources::invalidateCache() {
-    _rawCache.clear();
-    _2daCache.clear();
-    _gffCache.clear();
+    unique_lock<shared_timed_mutex> lock(_mutex);
+
+    logCacheStats("raw", _rawCache.stats());
+    logCacheStats("2DA", _2daCache.stats());
+    logCacheStats("GFF", _gffCache.stats());
+
+    invalidateTransient();
 }
 
-void Resources::clearTransientProviders() {
-    _transientProviders.clear();
+void Resources::invalidateTransient() {
+    auto isTransient = [](auto &entry) { return entry.value.transient; };
+    _rawCache.removeIf(isTransient);
+    _2daCache.removeIf(isTransient);
+    _gffCache.removeIf(isTransient);
 }
 
-template <class T>
-static shared_ptr<T> getResource(const string &key, unordered_map<string, shared_ptr<T>> &cache, const function<shared_ptr<T>()> &getter) {
-    auto maybeResource = cache.find(key);
-    if (maybeResource != cache.end()) return maybeResource->second;
+void Resources::addProvider(unique_ptr<IResourceProvider> provider, string name, bool transient) {
+    unique_lock<shared_timed_mutex> lock(_mutex);
+
+    _providerNames[provider.get()] = move(name);
+
+    OverrideIndex &index = transient ? _transientIndex : _index;
+    indexProvider(*provider, index);
+    rebuildFilter();
+    invalidateShadowed(*provider, index);
 
-    auto inserted = cache.insert(make_pair(key, getter()));
-    return inserted.first->second;
+    if (transient) {
+        _transientProviders.push_back(move(provider));
+    } else {
+        _providers.push_back(move(provider));
+    }
+}
+
+void Resources::indexProvider(IResourceProvider &provider, OverrideIndex &index) {
+    provider.forEachResource([&](int idx, const ResRef &resRef, ResourceType type) {
+        if (!provider.supports(type)) return;
+
+        // Within a single provider, the first occurrence of a resource wins
+        ResourceId id(resRef, type);
+        const ResourceLocation *existing = findLocation(index, id);
+        if (existing && existing->provider == &provider) return;
+
+        ResourceLocation location;
+        location.provider = &provider;
+        location.idx = idx;
+
+        index.index.add(id, static_cast<int>(index.locations.size()));
+        index.locations.push_back(move(location));
+    });
 }
 
-shared_ptr<ByteArray> Resources::getRaw(const string &resRef, ResourceType type, bool logNotFound) {
-    if (resRef.empty()) return nullptr;
+void Resources::rebuildFilter() {
+    _filter.reset(_index.index.size() + _transientIndex.index.size());
+
+    auto addToFilter = [this](uint32_t hash) { _filter.add(hash); };
+    _index.index.forEachHash(addToFilter);
+    _transientIndex.index.forEachHash(addToFilter);
+}
+
+bool Resources::isDefinitelyMissing(const ResourceId &id) const {
+    return !_filter.mayContain(id.hash());
+}
+
+bool Resources::isTransient(const ResRef &resRef, ResourceType type) {
+    shared_lock<shared_timed_mutex> lock(_mutex);
+    return findLocation(_transientIndex, ResourceId(resRef, type)) != nullptr;
+}
+
+const Resources::ResourceLocation *Resources::findLocation(const OverrideIndex &index, const ResourceId &id) const {
+    int locationIdx;
+    if (!index.index.find(id, locationIdx)) return nullptr;
+
+    return &index.locations[locationIdx];
+}
+
+void Resources::invalidateShadowed(IResourceProvider &provider, const OverrideIndex &index) {
+    auto isShadowed = [&](auto &entry) {
+        if (entry.value.transient) return true;
+
+        const ResourceLocation *location = findLocation(index, entry.key);
+        return location && location->provider == &provider;
+    };
+    _rawCache.removeIf(isShadowed);
+    _2daCache.removeIf(isShadowed);
+    _gffCache.removeIf(isShadowed);
+}
 
-    string cacheKey(getCacheKey(resRef, type));
-    auto res = _rawCache.find(cacheKey);
-    if (res != _rawCache.end()) return res->second;
+void Resources::clearTransientProviders() {
+    unique_lock<shared_timed_mutex> lock(_mutex);
 
-    shared_ptr<ByteArray> data = doGetRaw(_transientProviders, resRef, type);
-    if (!data) {
-        data = doGetRaw(_providers, resRef, type);
+    _transientIndex.index.clear();
+    _transientIndex.locations.clear();
+    for (auto &provider : _transientProviders) {
+        _providerNames.erase(provider.get());
     }
-    if (!data && logNotFound) {
-        warn("Resource not found: " + cacheKey);
+    _transientProviders.clear();
+
+    rebuildFilter();
+
+    invalidateTransient();
+}
+
+void Resources::pin(const ResRef &resRef, ResourceType type) {
+    setPinned(ResourceId(resRef, type), true);
+}
+
+void Resources::unpin(const ResRef &resRef, ResourceType type) {
+    setPinned(ResourceId(resRef, type), false);
+}
+
+void Resources::setPinned(const ResourceId &id, bool pinned) {
+    unique_lock<shared_timed_mutex> lock(_mutex);
+
+    if (pinned) {
+        _pinnedIds.insert(id);
+        _rawCache.pin(id);
+        _2daCache.pin(id);
+        _gffCache.pin(id);
+    } else {
+        _pinnedIds.erase(id);
+        _rawCache.unpin(id);
+        _2daCache.unpin(id);
+        _gffCache.unpin(id);
     }
-    auto pair = _rawCache.insert(make_pair(cacheKey, move(data)));
+}
 
-    return pair.first->second;
+bool Resources::isPinned(const ResourceId &id, bool transient) const {
+    return !transient && _pinnedIds.count(id) > 0;
 }
 
-string Resources::getCacheKey(const string &resRef, ResourceType type) const {
-    return str(boost::format("%s.%s") % resRef % getExtByResType(type));
+shared_ptr<ByteArray> Resources::getRaw(const ResRef &resRef, ResourceType type, bool logNotFound) {
+    ByteView view(getView(resRef, type, logNotFound));
+    if (!view) return nullptr;
+
+    return make_shared<ByteArray>(view.toArray());
 }
 
-shared_ptr<TwoDA> Resources::get2DA(const string &resRef, bool logNotFound) {
-    return getResource<TwoDA>(resRef, _2daCache, [&]() {
-        shared_ptr<ByteArray> data(getRaw(resRef, ResourceType::TwoDa, logNotFound));
-        shared_ptr<TwoDA> twoDa;
+ByteView Resources::getView(const ResRef &resRef, ResourceType type, bool logNotFound) {
+    if (resRef.empty()) return ByteView();
+
+    ResourceId id(resRef, type);
+    shared_lock<shared_timed_mutex> lock(_mutex);
 
-        if (data) {
-            TwoDaReader file;
-            file.load(wrap(data));
-            twoDa = file.twoDa();
+    if (isDefinitelyMissing(id)) {
+        if (logNotFound) {
+            warn("Resource not found: " + id.toString());
         }
+        _stats.recordNotFound(type);
+        return ByteView();
+    }
 
-        return move(twoDa);
-    });
+    bool cached = false;
+    CachedResource<ByteView> res(getCachedView(id, logNotFound, cached));
+    if (cached) {
+        _stats.recordHit(type);
+    } else if (res.object) {
+        _stats.recordMiss(type);
+    } else {
+        _stats.recordNotFound(type);
+    }
+
+    return move(res.object);
 }
 
-shared_ptr<ByteArray> Resources::doGetRaw(const vector<unique_ptr<IResourceProvider>> &providers, const string &resRef, ResourceType type) {
-    for (auto provider = providers.rbegin(); provider != providers.rend(); ++provider) {
-        if (!(*provider)->supports(type)) continue;
+Resources::CachedResource<ByteView> Resources::getCachedView(const ResourceId &id, bool logNotFound, bool &cached) {
+    CachedResource<ByteView> res;
+    cached = _rawCache.find(id, res);
+    if (cached) return move(res);
 
-        shared_ptr<ByteArray> data((*provider)->find(resRef, type));
-        if (data) return data;
+    res.object = doGetView(_transientIndex, id);
+    if (res.object) {
+        res.transient = true;
+    } else {
+        res.object = doGetView(_index, id);
+        res.transient = !res.object;
+    }
+    if (!res.object && logNotFound) {
+        warn("Resource not found: " + id.toString());
     }
+    _rawCache.put(id, res, getCacheCost(res.object.size()), isPinned(id, res.transient));
 
-    return nullptr;
+    return move(res);
 }
 
-shared_ptr<GffStruct> Resources::getGFF(const string &resRef, ResourceType type) {
-    string cacheKey(getCacheKey(resRef, type));
+template <class T>
+shared_ptr<T> Resources::getObject(ObjectCache<T> &cache, const ResourceId &id, bool logNotFound, const function<shared_ptr<T>(const ByteView &)> &parse) {
+    if (id.resRef.empty()) return nullptr;
 
-    return getResource<GffStruct>(cacheKey, _gffCache, [this, &resRef, &type]() {
-        shared_ptr<ByteArray> data(getRaw(resRef, type));
-        shared_ptr<GffStruct> gffs;
+    shared_lock<shared_timed_mutex> lock(_mutex);
 
-        if (data) {
-            GffReader gff;
-            gff.load(wrap(data));
-            gffs = gff.root();
+    if (isDefinitelyMissing(id)) {
+        if (logNotFound) {
+            warn("Resource not found: " + id.toString());
         }
+        _stats.recordNotFound(id.type);
+        return nullptr;
+    }
+
+    CachedResource<shared_ptr<T>> res;
+    if (cache.find(id, res)) {
+        _stats.recordHit(id.type);
+        return move(res.object);
+    }
+
+    // Concurrent callers may parse the same resource, the last one to finish replaces the cached object
+    bool cached = false;
+    CachedResource<ByteView> data(getCachedView(id, logNotFound, cached));
+    if (data.object) {
+        _stats.recordMiss(id.type);
+        Stopwatch stopwatch;
+        res.object = parse(data.object);
+        _stats.recordDecode(id.type, stopwatch.getElapsedTime());
+    } else {
+        _stats.recordNotFound(id.type);
+    }
+    res.transient = data.transient || !data.object;
+    cache.put(id, res, getCacheCost(data.object.size()), isPinned(id, res.transient));
+
+    return move(res.object);
+}
+
+shared_ptr<TwoDA> Resources::get2DA(const ResRef &resRef, bool logNotFound) {
+    return getObject<TwoDA>(_2daCache, ResourceId(resRef, ResourceType::TwoDa), logNotFound, [](const ByteView &data) {
+        TwoDaReader file;
+        file.load(data);
+        return file.twoDa();
+    });
+}
+
+ByteView Resources::doGetView(const OverrideIndex &index, const ResourceId &id) {
+    const ResourceLocation *location = findLocation(index, id);
+    if (!location) return ByteView();
+
+    Stopwatch stopwatch;
+    ByteView view(location->provider->getResourceView(location->idx));
+    _stats.recordRead(id, _providerNames[location->provider], view.size(), stopwatch.getElapsedTime());
+
+    return move(view);
+}
 
-        return move(gffs);
+shared_ptr<GffStruct> Resources::getGFF(const ResRef &resRef, ResourceType type) {
+    return getObject<GffStruct>(_gffCache, ResourceId(resRef, type), true, [](const ByteView &data) {
+        GffReader gff;
+        gff.load(data);
+        return gff.root();
     });
 }
 
+GffView Resources::getGFFView(const ResRef &resRef, ResourceType type) {
+    ByteView data(getView(resRef, type));
+    if (!data) return GffView();
+
+    return GffView(move(data));
+}
+
 shared_ptr<ByteArray> Resources::getFromExe(uint32_t name, PEResourceType type) {
     return _exeFile.find(name, type);
 }
 
+shared_ptr<PrefetchBatch> Resources::prefetch(vector<ResourceId> ids, PrefetchPriority priority, function<void()> onComplete) {
+    auto batch = make_shared<PrefetchBatch>(static_cast<int>(ids.size()), move(onComplete));
+    if (ids.empty()) return move(batch);
+
+    {
+        lock_guard<mutex> lock(_prefetchMutex);
+        if (!_prefetchPool) {
+            _prefetchPool = make_unique<ThreadPool>(kNumPrefetchThreads);
+        }
+    }
+    uint32_t generation = _prefetchGeneration;
+    for (auto &id : ids) {
+        _prefetchPool->enqueue([this, batch, id, generation]() {
+            bool loaded = false;
+            if (!batch->isCancelled() && generation == _prefetchGeneration) {
+                try {
+                    loaded = static_cast<bool>(getView(id.resRef, id.type, false));
+                } catch (const exception &e) {
+                    warn(boost::format("Cannot prefetch resource %s: %s") % id.toString() % e.what());
+                }
+            }
+            batch->finishOne(loaded);
+        }, static_cast<int>(priority));
+    }
+
+    return move(batch);
+}
+
+void Resources::cancelPrefetch() {
+    ++_prefetchGeneration;
+}
+
 } // namespace resource
 
 } // namespace reone
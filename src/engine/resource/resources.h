@@ -17,10 +17,19 @@
 
 #pragma once
 
+#include "../common/bloomfilter.h"
+#include "../common/shardedlrucache.h"
+#include "../common/threadpool.h"
+
 #include "2da.h"
 #include "format/pereader.h"
 #include "gffstruct.h"
+#include "gffview.h"
+#include "prefetchbatch.h"
+#include "resourceindex.h"
 #include "resourceprovider.h"
+#include "resourcestats.h"
+#include "resref.h"
 #include "types.h"
 
 namespace reone {
@@ -29,47 +38,219 @@ namespace resource {
 
 /**
  * Encapsulates game resource management. Contains a prioritized list of
- * resource providers, that it queries for resources by ResRef and ResType.
- * Caches found resources.
+ * resource providers and a merged index of their resources, that resolves
+ * overrides when providers are indexed. Caches found resources within a byte
+ * budget, evicting least recently used.
+ *
+ * getRaw, getView, get2DA and getGFF are safe to call concurrently. Indexing
+ * and clearing providers, invalidating caches and pinning resources wait for
+ * pending lookups to complete.
+ *
+ * Raw resources can be prefetched into the cache by a pool of background I/O
+ * threads, so that callers overlap loading with other work.
  */
 class Resources : boost::noncopyable {
 public:
-    Resources() = default;
+    /**
+     * @param cacheBudget estimated total size of cached resources in bytes, 0 for unlimited
+     */
+    Resources(size_t cacheBudget = 0);
+
+    /**
+     * Cancels pending prefetches and waits for the prefetch threads to exit.
+     */
+    ~Resources();
 
     void indexKeyFile(const boost::filesystem::path &path);
     void indexErfFile(const boost::filesystem::path &path, bool transient = false);
     void indexRimFile(const boost::filesystem::path &path, bool transient = false);
     void indexDirectory(const boost::filesystem::path &path);
+    void indexPackFile(const boost::filesystem::path &path, bool transient = false);
     void indexExeFile(const boost::filesystem::path &path);
 
+    /**
+     * Removes resources, that were found in transient providers or were not
+     * found at all, from caches, and logs cache statistics. Resources from
+     * other providers survive module transitions.
+     */
     void invalidateCache();
+
     void clearTransientProviders();
 
-    std::shared_ptr<ByteArray> getRaw(const std::string &resRef, ResourceType type, bool logNotFound = true);
-    std::shared_ptr<TwoDA> get2DA(const std::string &resRef, bool logNotFound = true);
-    std::shared_ptr<GffStruct> getGFF(const std::string &resRef, ResourceType type);
+    /**
+     * Prevents the resource and objects parsed from it from being evicted
+     * from caches. Pinned resources from transient providers are still
+     * removed by invalidateCache.
+     */
+    void pin(const ResRef &resRef, ResourceType type);
+
+    void unpin(const ResRef &resRef, ResourceType type);
+
+    /**
+     * @return copy of the resource data, or nullptr if not found
+     */
+    std::shared_ptr<ByteArray> getRaw(const ResRef &resRef, ResourceType type, bool logNotFound = true);
+
+    /**
+     * Prefer this over getRaw, as it does not copy the resource data, e.g.
+     * when it is located in a memory-mapped archive.
+     *
+     * @return view of the resource data, or an empty view if not found
+     */
+    ByteView getView(const ResRef &resRef, ResourceType type, bool logNotFound = true);
+
+    std::shared_ptr<TwoDA> get2DA(const ResRef &resRef, bool logNotFound = true);
+    std::shared_ptr<GffStruct> getGFF(const ResRef &resRef, ResourceType type);
+
+    /**
+     * Unlike getGFF, does not parse the whole file. Fields are decoded on
+     * demand from the cached raw data.
+     *
+     * @return view of the root struct, or an empty view if not found
+     */
+    GffView getGFFView(const ResRef &resRef, ResourceType type);
+
     std::shared_ptr<ByteArray> getFromExe(uint32_t name, PEResourceType type);
 
+    /**
+     * @return true if the resource is found in a transient provider, i.e. it is specific to the current module
+     */
+    bool isTransient(const ResRef &resRef, ResourceType type);
+
+    // Prefetching
+
+    /**
+     * Asynchronously loads resources into the raw cache. Resources of higher
+     * priority are loaded first. Prefetch threads are started on first use.
+     *
+     * @param onComplete function to call from a prefetch thread when the batch is complete, may be empty
+     * @return handle of the batch, that signals completion and cancels the batch
+     */
+    std::shared_ptr<PrefetchBatch> prefetch(
+        std::vector<ResourceId> ids,
+        PrefetchPriority priority = PrefetchPriority::Normal,
+        std::function<void()> onComplete = nullptr);
+
+    /**
+     * Skips resources of all batches, that are not being loaded yet, e.g.
+     * when the player heads elsewhere.
+     */
+    void cancelPrefetch();
+
+    // END Prefetching
+
+    ResourceStats &stats() { return _stats; }
+
+    CacheStats rawCacheStats() const { return _rawCache.stats(); }
+    CacheStats twoDaCacheStats() const { return _2daCache.stats(); }
+    CacheStats gffCacheStats() const { return _gffCache.stats(); }
+
 private:
+    template <class T>
+    struct CachedResource {
+        T object;
+        bool transient { false }; /**< found in a transient provider, or not found at all */
+    };
+
+    template <class T>
+    using ObjectCache = ShardedLruCache<ResourceId, CachedResource<std::shared_ptr<T>>>;
+
+    struct ResourceLocation {
+        IResourceProvider *provider { nullptr };
+        int idx { 0 }; /**< index of the resource within the provider */
+    };
+
+    /**
+     * Maps resources to locations within providers, so that later providers
+     * override earlier ones.
+     */
+    struct OverrideIndex {
+        ResourceIndex index;
+        std::vector<ResourceLocation> locations;
+    };
+
+    /**
+     * Guards providers, indices and pinned resources. Lookups hold it shared,
+     * so that providers are not destroyed while in use.
+     */
+    mutable std::shared_timed_mutex _mutex;
+
     // Providers
 
     PEReader _exeFile;
     std::vector<std::unique_ptr<IResourceProvider>> _providers;
     std::vector<std::unique_ptr<IResourceProvider>> _transientProviders; /**< transient providers are replaced when switching between modules */
+    std::unordered_map<const IResourceProvider *, std::string> _providerNames;
 
     // END Providers
 
+    // Indices
+
+    OverrideIndex _index; /**< resources of non-transient providers */
+    OverrideIndex _transientIndex; /**< resources of transient providers, override the former */
+
+    BloomFilter _filter; /**< rejects lookups of resources, that are definitely not indexed */
+
+    // END Indices
+
     // Caches
 
-    std::unordered_map<std::string, std::shared_ptr<ByteArray>> _rawCache;
-    std::unordered_map<std::string, std::shared_ptr<TwoDA>> _2daCache;
-    std::unordered_map<std::string, std::shared_ptr<GffStruct>> _gffCache;
+    ShardedLruCache<ResourceId, CachedResource<ByteView>> _rawCache;
+    ObjectCache<TwoDA> _2daCache;
+    ObjectCache<GffStruct> _gffCache;
+
+    std::unordered_set<ResourceId> _pinnedIds;
 
     // END Caches
 
-    std::string getCacheKey(const std::string &resRef, ResourceType type) const;
+    ResourceStats _stats;
+
+    // Prefetching
+
+    std::atomic<uint32_t> _prefetchGeneration { 0 }; /**< incremented by cancelPrefetch to skip pending resources */
+    std::mutex _prefetchMutex; /**< guards startup of the prefetch threads */
+    std::unique_ptr<ThreadPool> _prefetchPool;
+
+    // END Prefetching
+
+    bool isPinned(const ResourceId &id, bool transient) const;
+
+    /**
+     * Removes resources, that were found in transient providers or were not
+     * found at all, from caches.
+     */
+    void invalidateTransient();
+
+    // The following functions expect _mutex to be locked by the caller
+
+    void addProvider(std::unique_ptr<IResourceProvider> provider, std::string name, bool transient);
+    void indexProvider(IResourceProvider &provider, OverrideIndex &index);
+
+    /**
+     * Removes cached resources, that the specified provider overrides.
+     */
+    void invalidateShadowed(IResourceProvider &provider, const OverrideIndex &index);
+
+    void rebuildFilter();
+
+    /**
+     * @return true if the resource is definitely not present in any provider, false otherwise
+     */
+    bool isDefinitelyMissing(const ResourceId &id) const;
+
+    const ResourceLocation *findLocation(const OverrideIndex &index, const ResourceId &id) const;
+
+    void setPinned(const ResourceId &id, bool pinned);
+
+    /**
+     * @param[out] cached true if the resource was found in the raw cache
+     */
+    CachedResource<ByteView> getCachedView(const ResourceId &id, bool logNotFound, bool &cached);
+
+    template <class T>
+    std::shared_ptr<T> getObject(ObjectCache<T> &cache, const ResourceId &id, bool logNotFound, const std::function<std::shared_ptr<T>(const ByteView &)> &parse);
 
-    std::shared_ptr<ByteArray> doGetRaw(const std::vector<std::unique_ptr<IResourceProvider>> &providers, const std::string &resRef, ResourceType type);
+    ByteView doGetView(const OverrideIndex &index, const ResourceId &id);
 };
 
 } // namespace resource
@@ -0,0 +1,262 @@
+/*
+ * Copyright (c) 2020-2021 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "resourcestats.h"
+
+#include "typeutil.h"
+
+using namespace std;
+
+namespace fs = boost::filesystem;
+
+namespace reone {
+
+namespace resource {
+
+static uint64_t toMicros(float seconds) {
+    return seconds > 0.0f ? static_cast<uint64_t>(seconds * 1e6f) : 0;
+}
+
+void ResourceStats::Histogram::add(uint64_t micros) {
+    int bucket = 0;
+    for (uint64_t value = micros; value > 0 && bucket < kNumTimeBuckets - 1; value >>= 1) {
+        ++bucket;
+    }
+    ++buckets[bucket];
+    ++count;
+    totalMicros += micros;
+    maxMicros = max(maxMicros, micros);
+}
+
+uint64_t ResourceStats::Histogram::getPercentile(float fraction) const {
+    if (count == 0) return 0;
+
+    auto target = static_cast<uint32_t>(ceil(glm::clamp(fraction, 0.0f, 1.0f) * count));
+    uint32_t accumulated = 0;
+    for (int i = 0; i < kNumTimeBuckets; ++i) {
+        accumulated += buckets[i];
+        if (accumulated >= target && accumulated > 0) {
+            return min(static_cast<uint64_t>(1) << i, maxMicros);
+        }
+    }
+
+    return maxMicros;
+}
+
+void ResourceStats::beginModule(string name) {
+    lock_guard<mutex> lock(_mutex);
+
+    if (!_current.types.empty() || !_current.providers.empty()) {
+        _archived.push_back(move(_current));
+    }
+    _current = ModuleStats();
+    _current.module = move(name);
+}
+
+void ResourceStats::recordHit(ResourceType type) {
+    lock_guard<mutex> lock(_mutex);
+
+    TypeStats &stats = _current.types[type];
+    ++stats.requests;
+    ++stats.hits;
+}
+
+void ResourceStats::recordMiss(ResourceType type) {
+    lock_guard<mutex> lock(_mutex);
+
+    TypeStats &stats = _current.types[type];
+    ++stats.requests;
+    ++stats.misses;
+}
+
+void ResourceStats::recordNotFound(ResourceType type) {
+    lock_guard<mutex> lock(_mutex);
+
+    TypeStats &stats = _current.types[type];
+    ++stats.requests;
+    ++stats.notFound;
+}
+
+void ResourceStats::recordRead(const ResourceId &id, const string &provider, size_t size, float seconds) {
+    uint64_t micros = toMicros(seconds);
+    string name(id.toString());
+
+    lock_guard<mutex> lock(_mutex);
+
+    TypeStats &typeStats = _current.types[id.type];
+    typeStats.bytesRead += size;
+    typeStats.readTime.add(micros);
+
+    ProviderStats &providerStats = _current.providers[provider];
+    ++providerStats.reads;
+    providerStats.bytesRead += size;
+    providerStats.readTime.add(micros);
+
+    _current.resourcesRead.insert(move(name));
+}
+
+void ResourceStats::recordDecode(ResourceType type, float seconds) {
+    uint64_t micros = toMicros(seconds);
+
+    lock_guard<mutex> lock(_mutex);
+
+    _current.types[type].decodeTime.add(micros);
+}
+
+ResourceStats::ModuleStats ResourceStats::current() const {
+    lock_guard<mutex> lock(_mutex);
+    return _current;
+}
+
+static string describeTimes(const ResourceStats::Histogram &histogram) {
+    if (histogram.count == 0) return "-";
+
+    return str(boost::format("%d us avg, %d us p95, %d us max")
+        % (histogram.totalMicros / histogram.count)
+        % histogram.getPercentile(0.95f)
+        % histogram.maxMicros);
+}
+
+vector<string> ResourceStats::getReport() const {
+    ModuleStats stats(current());
+    vector<string> lines;
+
+    lines.push_back(str(boost::format("Module '%s': %d resources read") % stats.module % stats.resourcesRead.size()));
+    for (auto &type : stats.types) {
+        const TypeStats &typeStats = type.second;
+        lines.push_back(str(boost::format("%s: %d requests, %d hits, %d misses, %d not found, %d bytes read, read %s, decode %s")
+            % getExtByResType(type.first)
+            % typeStats.requests
+            % typeStats.hits
+            % typeStats.misses
+            % typeStats.notFound
+            % typeStats.bytesRead
+            % describeTimes(typeStats.readTime)
+            % describeTimes(typeStats.decodeTime)));
+    }
+    for (auto &provider : stats.providers) {
+        const ProviderStats &providerStats = provider.second;
+        lines.push_back(str(boost::format("%s: %d reads, %d bytes read, read %s")
+            % provider.first
+            % providerStats.reads
+            % providerStats.bytesRead
+            % describeTimes(providerStats.readTime)));
+    }
+
+    return move(lines);
+}
+
+static string quote(const string &value) {
+    string result("\"");
+    for (char ch : value) {
+        switch (ch) {
+            case '"':
+                result += "\\\"";
+                break;
+            case '\\':
+                result += "\\\\";
+                break;
+            default:
+                if (static_cast<unsigned char>(ch) < 0x20) {
+                    result += str(boost::format("\\u%04x") % static_cast<int>(ch));
+                } else {
+                    result += ch;
+                }
+                break;
+        }
+    }
+    result += "\"";
+    return move(result);
+}
+
+static void saveHistogram(const ResourceStats::Histogram &histogram, ostream &out) {
+    out << "{\"count\": " << histogram.count
+        << ", \"totalMicros\": " << histogram.totalMicros
+        << ", \"maxMicros\": " << histogram.maxMicros
+        << ", \"buckets\": [";
+    for (int i = 0; i < ResourceStats::kNumTimeBuckets; ++i) {
+        if (i > 0) out << ", ";
+        out << histogram.buckets[i];
+    }
+    out << "]}";
+}
+
+static void saveModule(const ResourceStats::ModuleStats &stats, ostream &out) {
+    out << "    {\n      \"module\": " << quote(stats.module) << ",\n      \"types\": {";
+    bool first = true;
+    for (auto &type : stats.types) {
+        const ResourceStats::TypeStats &typeStats = type.second;
+        out << (first ? "\n" : ",\n")
+            << "        " << quote(getExtByResType(type.first)) << ": {"
+            << "\"requests\": " << typeStats.requests
+            << ", \"hits\": " << typeStats.hits
+            << ", \"misses\": " << typeStats.misses
+            << ", \"notFound\": " << typeStats.notFound
+            << ", \"bytesRead\": " << typeStats.bytesRead
+            << ", \"readTime\": ";
+        saveHistogram(typeStats.readTime, out);
+        out << ", \"decodeTime\": ";
+        saveHistogram(typeStats.decodeTime, out);
+        out << "}";
+        first = false;
+    }
+    out << "\n      },\n      \"providers\": {";
+    first = true;
+    for (auto &provider : stats.providers) {
+        const ResourceStats::ProviderStats &providerStats = provider.second;
+        out << (first ? "\n" : ",\n")
+            << "        " << quote(provider.first) << ": {"
+            << "\"reads\": " << providerStats.reads
+            << ", \"bytesRead\": " << providerStats.bytesRead
+            << ", \"readTime\": ";
+        saveHistogram(providerStats.readTime, out);
+        out << "}";
+        first = false;
+    }
+    out << "\n      },\n      \"resourcesRead\": [";
+    first = true;
+    for (auto &name : stats.resourcesRead) {
+        out << (first ? "" : ", ") << quote(name);
+        first = false;
+    }
+    out << "]\n    }";
+}
+
+void ResourceStats::saveJSON(ostream &out) const {
+    vector<ModuleStats> modules;
+    {
+        lock_guard<mutex> lock(_mutex);
+        modules = _archived;
+        modules.push_back(_current);
+    }
+
+    out << "{\n  \"timeBucketMicros\": \"bucket 0 is under 1, bucket i is under 2^i\",\n  \"modules\": [\n";
+    for (size_t i = 0; i < modules.size(); ++i) {
+        saveModule(modules[i], out);
+        out << (i + 1 < modules.size() ? ",\n" : "\n");
+    }
+    out << "  ]\n}\n";
+}
+
+void ResourceStats::saveJSON(const fs::path &path) const {
+    fs::ofstream out(path);
+    saveJSON(out);
+}
+
+} // namespace resource
+
+} // namespace reone
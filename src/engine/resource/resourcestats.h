@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2020-2021 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "resref.h"
+#include "types.h"
+
+namespace reone {
+
+namespace resource {
+
+/**
+ * Counters and timing histograms of resource accesses, keyed by ResType and
+ * by resource provider. Statistics are collected per module: beginModule
+ * archives statistics of the previous module and starts afresh.
+ *
+ * All functions are safe to call concurrently.
+ */
+class ResourceStats : boost::noncopyable {
+public:
+    static constexpr int kNumTimeBuckets = 24;
+
+    /**
+     * Histogram of durations with power-of-two buckets: bucket 0 counts
+     * durations under 1 microsecond, bucket i counts durations in
+     * [2^(i-1), 2^i) microseconds, the last bucket also counts longer ones.
+     */
+    struct Histogram {
+        uint32_t buckets[kNumTimeBuckets] {};
+        uint32_t count { 0 };
+        uint64_t totalMicros { 0 };
+        uint64_t maxMicros { 0 };
+
+        void add(uint64_t micros);
+
+        /**
+         * @param fraction fraction of durations in the range [0, 1]
+         * @return upper bound of the bucket containing the specified fraction of durations, in microseconds
+         */
+        uint64_t getPercentile(float fraction) const;
+    };
+
+    struct TypeStats {
+        uint32_t requests { 0 };
+        uint32_t hits { 0 }; /**< requests served from a cache */
+        uint32_t misses { 0 }; /**< requests, that required reading or parsing the resource */
+        uint32_t notFound { 0 };
+        uint64_t bytesRead { 0 };
+        Histogram readTime;
+        Histogram decodeTime;
+    };
+
+    struct ProviderStats {
+        uint32_t reads { 0 };
+        uint64_t bytesRead { 0 };
+        Histogram readTime;
+    };
+
+    struct ModuleStats {
+        std::string module; /**< name of the module, empty before the first module is loaded */
+        std::map<ResourceType, TypeStats> types;
+        std::map<std::string, ProviderStats> providers;
+        std::set<std::string> resourcesRead; /**< names of resources, that were read from providers */
+    };
+
+    /**
+     * Archives statistics of the current module and starts collecting
+     * statistics of the specified module.
+     */
+    void beginModule(std::string name);
+
+    void recordHit(ResourceType type);
+    void recordMiss(ResourceType type);
+    void recordNotFound(ResourceType type);
+
+    /**
+     * @param seconds time spent reading the resource from the provider
+     */
+    void recordRead(const ResourceId &id, const std::string &provider, size_t size, float seconds);
+
+    /**
+     * @param seconds time spent decoding the resource into an object
+     */
+    void recordDecode(ResourceType type, float seconds);
+
+    /**
+     * @return lines of a human-readable report of the current module statistics
+     */
+    std::vector<std::string> getReport() const;
+
+    /**
+     * Saves statistics of every module as a JSON document.
+     */
+    void saveJSON(std::ostream &out) const;
+    void saveJSON(const boost::filesystem::path &path) const;
+
+    ModuleStats current() const;
+
+private:
+    mutable std::mutex _mutex;
+    ModuleStats _current;
+    std::vector<ModuleStats> _archived;
+};
+
+} // namespace resource
+
+} // namespace reone
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2020-2021 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "types.h"
+
+namespace reone {
+
+namespace resource {
+
+/**
+ * Resource name, stored inline as 16 case-folded bytes with a precomputed
+ * hash. Construction, comparison and hashing do not allocate memory. Names
+ * longer than 16 characters are truncated, like the ResRef fields of game
+ * file formats.
+ */
+class ResRef {
+public:
+    static constexpr int kMaxLength = 16;
+
+    ResRef() = default;
+
+    ResRef(const std::string &str) : ResRef(str.c_str(), str.size()) {
+    }
+
+    ResRef(const char *str) : ResRef(str, strlen(str)) {
+    }
+
+    ResRef(const char *str, size_t len) {
+        _size = static_cast<uint8_t>(std::min(len, static_cast<size_t>(kMaxLength)));
+        for (int i = 0; i < _size; ++i) {
+            char ch = str[i];
+            _data[i] = (ch >= 'A' && ch <= 'Z') ? ch + ('a' - 'A') : ch;
+        }
+        _hash = computeHash();
+    }
+
+    bool operator==(const ResRef &other) const {
+        return _hash == other._hash && memcmp(_data, other._data, kMaxLength) == 0;
+    }
+
+    bool operator!=(const ResRef &other) const {
+        return !(*this == other);
+    }
+
+    bool operator<(const ResRef &other) const {
+        return memcmp(_data, other._data, kMaxLength) < 0;
+    }
+
+    bool empty() const { return _size == 0; }
+
+    /**
+     * @return case-folded name as a string
+     */
+    std::string str() const { return std::string(_data, _size); }
+
+    const char *data() const { return _data; }
+    int size() const { return _size; }
+    uint32_t hash() const { return _hash; }
+
+private:
+    char _data[kMaxLength] { 0 }; /**< zero-padded */
+    uint8_t _size { 0 };
+    uint32_t _hash { 0 };
+
+    uint32_t computeHash() const {
+        uint64_t lo, hi;
+        memcpy(&lo, _data, 8);
+        memcpy(&hi, _data + 8, 8);
+
+        uint64_t hash = lo * 0x9e3779b97f4a7c15ull;
+        hash ^= hi * 0xc2b2ae3d27d4eb4full;
+        hash ^= hash >> 29;
+        hash *= 0xbf58476d1ce4e5b9ull;
+        hash ^= hash >> 32;
+
+        return static_cast<uint32_t>(hash);
+    }
+};
+
+/**
+ * Identifies a resource by its ResRef and ResType.
+ */
+struct ResourceId {
+    ResRef resRef;
+    ResourceType type { ResourceType::Invalid };
+
+    ResourceId() = default;
+
+    ResourceId(ResRef resRef, ResourceType type) : resRef(std::move(resRef)), type(type) {
+    }
+
+    bool operator==(const ResourceId &other) const {
+        return type == other.type && resRef == other.resRef;
+    }
+
+    bool operator!=(const ResourceId &other) const {
+        return !(*this == other);
+    }
+
+    uint32_t hash() const {
+        return (resRef.hash() ^ static_cast<uint32_t>(type)) * 0x9e3779b1u;
+    }
+
+    /**
+     * @return resource name with extension, e.g. "appearance.2da"
+     */
+    std::string toString() const;
+};
+
+} // namespace resource
+
+} // namespace reone
+
+namespace std {
+
+template <>
+struct hash<reone::resource::ResRef> {
+    size_t operator()(const reone::resource::ResRef &resRef) const {
+        return resRef.hash();
+    }
+};
+
+template <>
+struct hash<reone::resource::ResourceId> {
+    size_t operator()(const reone::resource::ResourceId &id) const {
+        return id.hash();
+    }
+};
+
+} // namespace std
@@ -25,11 +25,14 @@ namespace reone {
 
 namespace resource {
 
-ResourceServices::ResourceServices(fs::path gamePath) : _gamePath(move(gamePath)) {
+ResourceServices::ResourceServices(ResourceOptions options, fs::path gamePath) :
+    _options(move(options)),
+    _gamePath(move(gamePath)) {
 }
 
 void ResourceServices::init() {
-    _resources = make_unique<Resources>();
+    _cookedCache = make_unique<CookedCache>(_options.cookedCachePath);
+    _resources = make_unique<Resources>(static_cast<size_t>(_options.cacheSize) << 20);
 
     _strings = make_unique<Strings>();
     _strings->init(_gamePath);
@@ -17,6 +17,8 @@
 
 #pragma once
 
+#include "cookedcache.h"
+#include "options.h"
 #include "resources.h"
 #include "strings.h"
 
@@ -26,16 +28,19 @@ namespace resource {
 
 class ResourceServices : boost::noncopyable {
 public:
-    ResourceServices(boost::filesystem::path gamePath);
+    ResourceServices(ResourceOptions options, boost::filesystem::path gamePath);
 
     void init();
 
+    CookedCache &cookedCache() { return *_cookedCache; }
     Resources &resources() { return *_resources; }
     Strings &strings() { return *_strings; }
 
 private:
+    ResourceOptions _options;
     boost::filesystem::path _gamePath;
 
+    std::unique_ptr<CookedCache> _cookedCache;
     std::unique_ptr<Resources> _resources;
     std::unique_ptr<Strings> _strings;
 };
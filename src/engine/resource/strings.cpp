@@ -36,8 +36,14 @@ string Strings::get(int strRef) {
     shared_ptr<TalkTable> table(_tlk.table());
     if (strRef < 0 || strRef >= table->getStringCount()) return "";
 
-    string text(table->getString(strRef).text);
+    lock_guard<mutex> lock(_processedMutex);
+
+    auto maybeText = _processed.find(strRef);
+    if (maybeText != _processed.end()) return maybeText->second;
+
+    string text(table->getText(strRef));
     process(text);
+    _processed.insert(make_pair(strRef, text));
 
     return move(text);
 }
@@ -46,7 +52,7 @@ string Strings::getSound(int strRef) {
     shared_ptr<TalkTable> table(_tlk.table());
     if (strRef < 0 || strRef >= table->getStringCount()) return "";
 
-    return table->getString(strRef).soundResRef;
+    return table->getSoundResRef(strRef);
 }
 
 void Strings::process(string &str) {
@@ -54,23 +60,26 @@ void Strings::process(string &str) {
 }
 
 void Strings::stripDeveloperNotes(string &str) {
-    do {
-        size_t openBracketIdx = str.find_first_of('{', 0);
-        if (openBracketIdx == -1) break;
+    size_t readIdx = 0;
+    size_t writeIdx = 0;
 
-        size_t closeBracketIdx = str.find_first_of('}', static_cast<int64_t>(openBracketIdx) + 1);
-        if (closeBracketIdx == -1) break;
+    while (true) {
+        size_t openBracketIdx = str.find('{', readIdx);
+        if (openBracketIdx == string::npos) break;
 
-        int textLen = static_cast<int>(str.size());
-        size_t noteLen = closeBracketIdx - openBracketIdx + 1;
+        size_t closeBracketIdx = str.find('}', openBracketIdx + 1);
+        if (closeBracketIdx == string::npos) break;
 
-        for (size_t i = openBracketIdx; i + noteLen < textLen; ++i) {
-            str[i] = str[i + noteLen];
+        if (writeIdx != readIdx) {
+            copy(str.begin() + readIdx, str.begin() + openBracketIdx, str.begin() + writeIdx);
         }
+        writeIdx += openBracketIdx - readIdx;
+        readIdx = closeBracketIdx + 1;
+    }
+    if (writeIdx == readIdx) return;
 
-        str.resize(textLen - noteLen);
-
-    } while (true);
+    copy(str.begin() + readIdx, str.end(), str.begin() + writeIdx);
+    str.resize(writeIdx + str.size() - readIdx);
 }
 
 } // namespace resource
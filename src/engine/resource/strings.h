@@ -34,7 +34,8 @@ public:
     void init(const boost::filesystem::path &gameDir);
 
     /**
-     * Searches for a string in the global talktable by StrRef.
+     * Searches for a string in the global talktable by StrRef. Processed
+     * strings are cached, so that each string is only decoded once.
      *
      * @return string from the global talktable if found, empty string otherwise
      */
@@ -49,8 +50,16 @@ public:
 
 private:
     TlkReader _tlk;
+    std::unordered_map<int, std::string> _processed;
+    std::mutex _processedMutex;
 
     void process(std::string &str);
+
+    /**
+     * Removes developer notes, i.e. text enclosed in curly braces, from the
+     * specified string in a single pass. An unmatched opening brace, and
+     * everything after it, is kept.
+     */
     void stripDeveloperNotes(std::string &str);
 };
 
@@ -19,25 +19,106 @@
 
 #include <stdexcept>
 
+#include <boost/algorithm/string.hpp>
+
 using namespace std;
 
 namespace reone {
 
 namespace resource {
 
+struct StringFlags {
+    static constexpr int textPresent = 1;
+    static constexpr int soundPresent = 2;
+    static constexpr int soundLengthPresent = 4;
+};
+
+struct EntryLayout {
+    static constexpr int flags = 0;
+    static constexpr int soundResRef = 4;
+    static constexpr int soundResRefSize = 16;
+    static constexpr int stringOffset = 28;
+    static constexpr int stringSize = 32;
+};
+
+static uint32_t getUint32(const char *data) {
+    uint32_t result;
+    memcpy(&result, data, sizeof(result));
+    return result;
+}
+
+TalkTable::TalkTable(ByteView entries, ByteView strings) :
+    _entries(move(entries)),
+    _stringData(move(strings)),
+    _entryCount(static_cast<int>(_entries.size() / kEntrySize)) {
+}
+
 void TalkTable::addString(TalkTableString &&string) {
-    _strings.push_back(string);
+    if (isMapped()) {
+        throw logic_error("Cannot add a string to a talktable backed by a TLK file");
+    }
+    _strings.push_back(move(string));
 }
 
 int TalkTable::getStringCount() const {
-    return static_cast<int>(_strings.size());
+    return isMapped() ? _entryCount : static_cast<int>(_strings.size());
 }
 
 const TalkTableString &TalkTable::getString(int index) const {
-    if (index < 0 || index >= static_cast<int>(_strings.size())) {
+    if (index < 0 || index >= getStringCount()) {
+        throw out_of_range("index is out of range");
+    }
+    if (!isMapped()) {
+        return _strings[index];
+    }
+
+    lock_guard<mutex> lock(_decodedMutex);
+
+    auto maybeString = _decoded.find(index);
+    if (maybeString != _decoded.end()) return maybeString->second;
+
+    TalkTableString string;
+    string.text = getText(index);
+    string.soundResRef = getSoundResRef(index);
+
+    return _decoded.insert(make_pair(index, move(string))).first->second;
+}
+
+string TalkTable::getText(int index) const {
+    if (!isMapped()) {
+        return getString(index).text;
+    }
+    const char *entry = getEntry(index);
+    if (!(getUint32(entry + EntryLayout::flags) & StringFlags::textPresent)) return "";
+
+    uint32_t offset = getUint32(entry + EntryLayout::stringOffset);
+    uint32_t size = getUint32(entry + EntryLayout::stringSize);
+    if (offset > _stringData.size() || size > _stringData.size() - offset) {
+        throw out_of_range("TLK string is out of range: " + to_string(index));
+    }
+
+    return string(_stringData.data() + offset, size);
+}
+
+string TalkTable::getSoundResRef(int index) const {
+    if (!isMapped()) {
+        return getString(index).soundResRef;
+    }
+    const char *entry = getEntry(index);
+    if (!(getUint32(entry + EntryLayout::flags) & StringFlags::soundPresent)) return "";
+
+    const char *data = entry + EntryLayout::soundResRef;
+    string result(data, find(data, data + EntryLayout::soundResRefSize, '\0'));
+    boost::to_lower(result);
+
+    return move(result);
+}
+
+const char *TalkTable::getEntry(int index) const {
+    if (index < 0 || index >= _entryCount) {
         throw out_of_range("index is out of range");
     }
-    return _strings[index];
+    return _entries.data() + static_cast<size_t>(index) * kEntrySize;
 }
 
 } // namespace resource
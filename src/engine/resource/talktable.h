@@ -17,6 +17,8 @@
 
 #pragma once
 
+#include "../common/byteview.h"
+
 namespace reone {
 
 namespace resource {
@@ -26,15 +28,72 @@ struct TalkTableString {
     std::string soundResRef;
 };
 
+/**
+ * Table of localized strings. A talktable is either built in memory, string
+ * by string, or backed by the string entry table of a TLK file, in which case
+ * strings are decoded from the file on demand.
+ */
 struct TalkTable : boost::noncopyable {
 public:
+    static constexpr int kEntrySize = 40; /**< size of a string entry in a TLK file */
+
+    TalkTable() = default;
+
+    /**
+     * Constructs a talktable backed by a TLK file.
+     *
+     * @param entries string entry table, kEntrySize bytes per string
+     * @param strings string data, that string entries point into
+     */
+    TalkTable(ByteView entries, ByteView strings);
+
+    /**
+     * Appends a string to this talktable. A talktable backed by a TLK file
+     * cannot be appended to.
+     *
+     * @throws std::logic_error if this talktable is backed by a TLK file
+     */
     void addString(TalkTableString &&string);
 
     int getStringCount() const;
+
+    /**
+     * Decodes the string at the specified index, if necessary, and keeps it
+     * for the lifetime of this talktable.
+     *
+     * @throws std::out_of_range if index is out of range
+     */
     const TalkTableString &getString(int index) const;
 
+    /**
+     * Decodes text of the string at the specified index without keeping it.
+     *
+     * @throws std::out_of_range if index is out of range
+     */
+    std::string getText(int index) const;
+
+    /**
+     * Decodes sound ResRef of the string at the specified index without keeping it.
+     *
+     * @throws std::out_of_range if index is out of range
+     */
+    std::string getSoundResRef(int index) const;
+
 private:
     std::vector<TalkTableString> _strings;
+
+    // TLK file
+
+    ByteView _entries;
+    ByteView _stringData;
+    int _entryCount { 0 };
+    mutable std::unordered_map<int, TalkTableString> _decoded;
+    mutable std::mutex _decodedMutex;
+
+    // END TLK file
+
+    bool isMapped() const { return static_cast<bool>(_entries); }
+    const char *getEntry(int index) const;
 };
 
 } // namespace resource
@@ -83,6 +83,12 @@ enum class ResourceType : uint16_t {
     Invalid = 0xffff
 };
 
+enum class PrefetchPriority {
+    Low,
+    Normal,
+    High
+};
+
 typedef std::multimap<std::string, std::string> Visibility;
 
 } // namespace resource
@@ -17,7 +17,7 @@
 
 #include "scripts.h"
 
-#include "../common/streamutil.h"
+#include "../common/stopwatch.h"
 
 #include "ncsreader.h"
 
@@ -31,16 +31,20 @@ namespace reone {
 namespace script {
 
 Scripts::Scripts(Resources &resources) :
-    MemoryCache(bind(&Scripts::doGet, this, _1)),
+    MemoryCache(
+        bind(&Scripts::doGet, this, _1),
+        [&resources](const ResRef &resRef) { return resources.isTransient(resRef, ResourceType::Ncs); }),
     _resources(resources) {
 }
 
-shared_ptr<ScriptProgram> Scripts::doGet(string resRef) {
-    shared_ptr<ByteArray> data(_resources.getRaw(resRef, ResourceType::Ncs));
+shared_ptr<ScriptProgram> Scripts::doGet(const ResRef &resRef) {
+    ByteView data(_resources.getView(resRef, ResourceType::Ncs));
     if (!data) return nullptr;
 
-    NcsReader ncs(resRef);
-    ncs.load(wrap(data));
+    Stopwatch stopwatch;
+    NcsReader ncs(resRef.str());
+    ncs.load(data);
+    _resources.stats().recordDecode(ResourceType::Ncs, stopwatch.getElapsedTime());
 
     return ncs.program();
 }
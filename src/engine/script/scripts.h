@@ -26,14 +26,14 @@ namespace reone {
 
 namespace script {
 
-class Scripts : public MemoryCache<std::string, ScriptProgram> {
+class Scripts : public MemoryCache<resource::ResRef, ScriptProgram> {
 public:
     Scripts(resource::Resources &resources);
 
 private:
     resource::Resources &_resources;
 
-    std::shared_ptr<ScriptProgram> doGet(std::string resRef);
+    std::shared_ptr<ScriptProgram> doGet(const resource::ResRef &resRef);
 };
 
 } // namespace script
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2020-2021 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define BOOST_TEST_MODULE bloomfilter
+
+#include <boost/test/included/unit_test.hpp>
+
+#include "../engine/common/bloomfilter.h"
+
+using namespace std;
+
+using namespace reone;
+
+BOOST_AUTO_TEST_CASE(test_no_false_negatives_and_few_false_positives) {
+    static constexpr int kNumHashes = 10000;
+
+    BloomFilter filter;
+    filter.reset(kNumHashes);
+    for (uint32_t i = 0; i < kNumHashes; ++i) {
+        filter.add(i * 2654435761u);
+    }
+
+    int falsePositives = 0;
+    for (uint32_t i = 0; i < kNumHashes; ++i) {
+        BOOST_TEST(filter.mayContain(i * 2654435761u));
+        if (filter.mayContain((kNumHashes + i) * 2654435761u)) {
+            ++falsePositives;
+        }
+    }
+
+    BOOST_TEST((falsePositives < kNumHashes / 100));
+}
+
+BOOST_AUTO_TEST_CASE(test_empty_filter_contains_nothing) {
+    BloomFilter filter;
+    BOOST_TEST(!filter.mayContain(0u));
+
+    filter.reset(0);
+    BOOST_TEST(!filter.mayContain(0u));
+}
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2020-2021 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define BOOST_TEST_MODULE cookedcache
+
+#include <boost/test/included/unit_test.hpp>
+
+#include "../engine/resource/cookedcache.h"
+
+using namespace std;
+
+using namespace reone;
+using namespace reone::resource;
+
+namespace fs = boost::filesystem;
+
+static ByteView makeView(const string &str) {
+    return ByteView(make_shared<ByteArray>(str.begin(), str.end()));
+}
+
+static string toString(const ByteView &view) {
+    return string(view.data(), view.size());
+}
+
+BOOST_AUTO_TEST_CASE(test_content_hash) {
+    uint64_t hash = CookedCache::getContentHash({ makeView("texture"), makeView("features") });
+
+    BOOST_TEST(hash == CookedCache::getContentHash({ makeView("texture"), makeView("features") }));
+    BOOST_TEST(hash != CookedCache::getContentHash({ makeView("texturE"), makeView("features") }));
+    BOOST_TEST(hash != CookedCache::getContentHash({ makeView("texturef"), makeView("eatures") }));
+    BOOST_TEST(hash != CookedCache::getContentHash({ makeView("texture"), makeView("features") }, 1));
+    BOOST_TEST(CookedCache::getContentHash({ makeView("") }) != CookedCache::getContentHash({ ByteView(), ByteView() }));
+}
+
+BOOST_AUTO_TEST_CASE(test_put_and_get) {
+    fs::path path(fs::temp_directory_path() / fs::unique_path("%%%%%%%%"));
+    CookedCache cache(path);
+    string payload("cooked texture");
+    uint64_t hash = CookedCache::getContentHash({ makeView("source") });
+
+    BOOST_TEST(cache.isEnabled());
+    BOOST_TEST(!cache.get("textures", hash));
+
+    cache.put("textures", hash, ByteArray(payload.begin(), payload.end()));
+
+    ByteView data(cache.get("textures", hash));
+    BOOST_TEST(toString(data) == payload);
+    BOOST_TEST(!cache.get("models", hash));
+    BOOST_TEST(!cache.get("textures", hash + 1));
+
+    fs::remove_all(path);
+}
+
+BOOST_AUTO_TEST_CASE(test_invalid_entry_is_a_miss) {
+    fs::path path(fs::temp_directory_path() / fs::unique_path("%%%%%%%%"));
+    CookedCache cache(path);
+    string payload("cooked model");
+    uint64_t hash = CookedCache::getContentHash({ makeView("source") });
+    cache.put("models", hash, ByteArray(payload.begin(), payload.end()));
+
+    fs::path entryPath;
+    for (auto &entry : fs::directory_iterator(path / "models")) {
+        entryPath = entry.path();
+    }
+    fs::resize_file(entryPath, fs::file_size(entryPath) - 1);
+
+    BOOST_TEST(!cache.get("models", hash));
+
+    fs::remove_all(path);
+}
+
+BOOST_AUTO_TEST_CASE(test_disabled_cache) {
+    CookedCache cache;
+    string payload("cooked texture");
+    cache.put("textures", 1, ByteArray(payload.begin(), payload.end()));
+
+    BOOST_TEST(!cache.isEnabled());
+    BOOST_TEST(!cache.get("textures", 1));
+}
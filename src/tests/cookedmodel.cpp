@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2020-2021 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define BOOST_TEST_MODULE cookedmodel
+
+#include <boost/test/included/unit_test.hpp>
+
+#include "../engine/graphics/model/cookedmodelreader.h"
+#include "../engine/graphics/model/cookedmodelwriter.h"
+
+using namespace std;
+
+using namespace reone;
+using namespace reone::graphics;
+
+static shared_ptr<Model> makeModel() {
+    auto rootNode = make_shared<ModelNode>("root", glm::vec3(1.0f, 2.0f, 3.0f), glm::quat(1.0f, 0.0f, 0.0f, 0.0f));
+
+    VertexAttributes attributes;
+    attributes.stride = 3 * sizeof(float);
+    auto mesh = make_shared<ModelNode::TriangleMesh>();
+    mesh->mesh = make_shared<Mesh>(
+        vector<float> { 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f },
+        vector<uint16_t> { 0, 1, 2 },
+        attributes);
+    mesh->materialFaces[4] = vector<uint32_t> { 0 };
+    mesh->transparency = 2;
+    mesh->render = true;
+    mesh->danglyMesh = make_shared<ModelNode::DanglyMesh>();
+    mesh->danglyMesh->period = 0.5f;
+    mesh->danglyMesh->constraints.resize(3);
+    mesh->aabbTree = make_shared<ModelNode::AABBTree>();
+    mesh->aabbTree->faceIndex = -1;
+    mesh->aabbTree->left = make_shared<ModelNode::AABBTree>();
+    mesh->aabbTree->left->aabb = AABB(glm::vec3(0.0f), glm::vec3(1.0f, 1.0f, 0.0f));
+
+    auto child = make_shared<ModelNode>("child", glm::vec3(0.0f), glm::quat(0.0f, 0.0f, 0.0f, 1.0f), rootNode.get());
+    child->setFlags(0x21);
+    child->setMesh(move(mesh));
+    child->alpha().addFrame(0.0f, 0.25f);
+    rootNode->addChild(move(child));
+
+    auto animRootNode = make_shared<ModelNode>("root", glm::vec3(0.0f), glm::quat(1.0f, 0.0f, 0.0f, 0.0f));
+    animRootNode->position().addFrame(0.0f, glm::vec3(0.0f));
+    animRootNode->position().addFrame(1.0f, glm::vec3(1.0f, 0.0f, 0.0f));
+    animRootNode->orientation().addFrame(1.0f, glm::quat(0.0f, 1.0f, 0.0f, 0.0f));
+    vector<Animation::Event> events { Animation::Event { 0.5f, "hit" } };
+    auto animation = make_shared<Animation>("attack", 1.0f, 0.25f, move(animRootNode), move(events));
+
+    auto model = make_shared<Model>("model", Model::Classification::Character, move(rootNode), vector<shared_ptr<Animation>> { animation }, nullptr, 2.0f);
+    model->setAffectedByFog(true);
+
+    return move(model);
+}
+
+BOOST_AUTO_TEST_CASE(test_write_and_read) {
+    auto out = make_shared<ostringstream>();
+    CookedModelWriter writer(makeModel(), [](const Model &model) { return model.name(); });
+    writer.save(out);
+
+    string data(out->str());
+    CookedModelReader reader(nullptr, nullptr);
+    reader.load(ByteView(make_shared<ByteArray>(data.begin(), data.end())));
+    shared_ptr<Model> model(reader.model());
+
+    BOOST_TEST(model->name() == "model");
+    BOOST_TEST((model->classification() == Model::Classification::Character));
+    BOOST_TEST(model->animationScale() == 2.0f);
+    BOOST_TEST(model->isAffectedByFog());
+    BOOST_TEST((model->rootNode()->restPosition() == glm::vec3(1.0f, 2.0f, 3.0f)));
+
+    shared_ptr<ModelNode> child(model->getNodeByName("child"));
+    BOOST_TEST(child->parent() == model->rootNode().get());
+    BOOST_TEST(child->flags() == 0x21);
+    BOOST_TEST((child->restOrientation() == glm::quat(0.0f, 0.0f, 0.0f, 1.0f)));
+    BOOST_TEST(child->alpha().getByFrame(0) == 0.25f);
+    BOOST_TEST(child->position().getNumFrames() == 0);
+
+    shared_ptr<ModelNode::TriangleMesh> mesh(child->mesh());
+    BOOST_TEST(mesh->mesh->vertices().size() == 9ll);
+    BOOST_TEST(mesh->mesh->indices()[2] == 2);
+    BOOST_TEST(mesh->mesh->attributes().stride == 12u);
+    BOOST_TEST(mesh->mesh->attributes().offNormals == -1);
+    BOOST_TEST(child->getFacesByMaterial(4).size() == 1ll);
+    BOOST_TEST(mesh->transparency == 2);
+    BOOST_TEST(mesh->render);
+    BOOST_TEST(!mesh->shadow);
+    BOOST_TEST(!mesh->diffuseMap);
+    BOOST_TEST(!mesh->skin);
+    BOOST_TEST(mesh->danglyMesh->period == 0.5f);
+    BOOST_TEST(mesh->danglyMesh->constraints.size() == 3ll);
+    BOOST_TEST(mesh->aabbTree->faceIndex == -1);
+    BOOST_TEST((mesh->aabbTree->left->aabb.max() == glm::vec3(1.0f, 1.0f, 0.0f)));
+    BOOST_TEST(!mesh->aabbTree->right);
+
+    shared_ptr<Animation> animation(model->getAnimation("attack"));
+    BOOST_TEST(animation->transitionTime() == 0.25f);
+    BOOST_TEST(animation->events().size() == 1ll);
+    BOOST_TEST(animation->events()[0].name == "hit");
+    BOOST_TEST((animation->rootNode()->position().getByFrame(1) == glm::vec3(1.0f, 0.0f, 0.0f)));
+    BOOST_TEST((animation->rootNode()->orientation().getByFrame(0) == glm::quat(0.0f, 1.0f, 0.0f, 0.0f)));
+}
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2020-2021 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define BOOST_TEST_MODULE generationalcache
+
+#include <boost/test/included/unit_test.hpp>
+
+#include "../engine/common/cache.h"
+
+using namespace std;
+
+using namespace reone;
+
+typedef GenerationalCache<string, int> IntCache;
+
+static IntCache::Policy makePolicy(int maxAge, size_t budget = 0) {
+    IntCache::Policy policy;
+    policy.maxAge = maxAge;
+    policy.budget = budget;
+    return move(policy);
+}
+
+static bool contains(IntCache &cache, const string &key) {
+    shared_ptr<int> object;
+    return cache.find(key, object);
+}
+
+BOOST_AUTO_TEST_CASE(test_retain_referenced_and_recently_used) {
+    IntCache cache;
+    shared_ptr<int> referenced(cache.insert("referenced", make_shared<int>(1)));
+    cache.insert("unreferenced", make_shared<int>(2));
+
+    cache.beginGeneration(makePolicy(1));
+    cache.beginGeneration(makePolicy(1));
+
+    BOOST_TEST(contains(cache, "referenced"));
+    BOOST_TEST(!contains(cache, "unreferenced"));
+
+    referenced.reset();
+    cache.beginGeneration(makePolicy(1));
+    BOOST_TEST(contains(cache, "referenced"));
+
+    cache.beginGeneration(makePolicy(1));
+    cache.beginGeneration(makePolicy(1));
+    BOOST_TEST(!contains(cache, "referenced"));
+}
+
+BOOST_AUTO_TEST_CASE(test_use_renews_entry) {
+    IntCache cache;
+    cache.insert("a", make_shared<int>(1));
+
+    for (int i = 0; i < 5; ++i) {
+        cache.beginGeneration(makePolicy(1));
+        BOOST_TEST(contains(cache, "a"));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_evict_null_and_transient) {
+    set<string> transient { "module" };
+    IntCache cache([&transient](const string &key) { return transient.count(key) > 0; });
+    shared_ptr<int> module(cache.insert("module", make_shared<int>(1)));
+    shared_ptr<int> shadowed(cache.insert("shadowed", make_shared<int>(2)));
+    cache.insert("missing", nullptr);
+
+    transient.clear();
+    transient.insert("shadowed");
+    cache.beginGeneration(makePolicy(2));
+
+    BOOST_TEST(!contains(cache, "module"));
+    BOOST_TEST(!contains(cache, "shadowed"));
+    BOOST_TEST(!contains(cache, "missing"));
+    BOOST_TEST((cache.size() == 0u));
+}
+
+BOOST_AUTO_TEST_CASE(test_evict_oldest_over_budget) {
+    IntCache cache(nullptr, [](const int &value) { return static_cast<size_t>(value); });
+    cache.insert("old", make_shared<int>(10));
+    cache.beginGeneration(makePolicy(3));
+    cache.insert("new", make_shared<int>(10));
+    shared_ptr<int> referenced(cache.insert("referenced", make_shared<int>(100)));
+
+    cache.beginGeneration(makePolicy(3, 15));
+
+    BOOST_TEST(!contains(cache, "old"));
+    BOOST_TEST(contains(cache, "new"));
+    BOOST_TEST(contains(cache, "referenced"));
+}
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2020-2021 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define BOOST_TEST_MODULE gffstruct
+
+#include <boost/test/included/unit_test.hpp>
+
+#include "../engine/resource/gffstruct.h"
+
+using namespace std;
+
+using namespace reone;
+
+using namespace reone::resource;
+
+BOOST_AUTO_TEST_CASE(test_labels_are_interned) {
+    GffLabel a("Tag");
+    GffLabel b(string("Tag"));
+    GffLabel c("tag");
+
+    BOOST_TEST((a == b));
+    BOOST_TEST((a != c));
+    BOOST_TEST(a.str() == "Tag");
+    BOOST_TEST(GffLabel().empty());
+    BOOST_TEST(GffLabel("").empty());
+}
+
+BOOST_AUTO_TEST_CASE(test_get_fields_of_small_struct) {
+    GffStruct gffs(0);
+    gffs.add(GffStruct::Field::newInt("A", 1));
+    gffs.add(GffStruct::Field::newCExoString("B", "b"));
+
+    BOOST_TEST(gffs.getInt("A") == 1);
+    BOOST_TEST(gffs.getString("B") == "b");
+    BOOST_TEST(gffs.getInt("C", -1) == -1);
+}
+
+BOOST_AUTO_TEST_CASE(test_get_fields_of_large_struct) {
+    GffStruct gffs(0);
+    for (int i = 0; i < 100; ++i) {
+        gffs.add(GffStruct::Field::newInt("Field" + to_string(i), i));
+    }
+    gffs.add(GffStruct::Field::newInt("Field0", -1));
+
+    for (int i = 0; i < 100; ++i) {
+        BOOST_TEST(gffs.getInt("Field" + to_string(i)) == i);
+    }
+    BOOST_TEST(gffs.getInt("Field100", -1) == -1);
+}
+
+BOOST_AUTO_TEST_CASE(test_field_values) {
+    auto child = make_shared<GffStruct>(1);
+
+    GffStruct gffs(0);
+    gffs.add(GffStruct::Field::newCExoString("String", "end_trask"));
+    gffs.add(GffStruct::Field::newCExoLocString("LocString", 12345, "Trask"));
+    gffs.add(GffStruct::Field::newVector("Vector", glm::vec3(1.0f, 2.0f, 3.0f)));
+    gffs.add(GffStruct::Field::newOrientation("Orientation", glm::quat(0.5f, 0.5f, -0.5f, 0.5f)));
+    gffs.add(GffStruct::Field::newStruct("Struct", child));
+
+    BOOST_TEST(sizeof(GffStruct::Field) <= 16ll);
+    BOOST_TEST(gffs.getString("String") == "end_trask");
+    BOOST_TEST(gffs.getInt("String") == 0);
+    BOOST_TEST(gffs.getInt("LocString") == 12345);
+    BOOST_TEST(gffs.getString("LocString") == "Trask");
+    BOOST_TEST((gffs.getVector("Vector") == glm::vec3(1.0f, 2.0f, 3.0f)));
+    BOOST_TEST((gffs.getOrientation("Orientation") == glm::quat(0.5f, 0.5f, -0.5f, 0.5f)));
+    BOOST_TEST((gffs.getStruct("Struct") == child));
+}
+
+BOOST_AUTO_TEST_CASE(test_fields_outlive_arena) {
+    auto arena = make_shared<GffArena>(16);
+    auto gffs = make_unique<GffStruct>(0, arena);
+    gffs->add(GffStruct::Field::newCExoString("Tag", "end_trask", arena.get()));
+    ByteArray data { 1, 2, 3 };
+    gffs->add(GffStruct::Field::newVoid("Data", data));
+    arena.reset();
+
+    vector<GffStruct::Field> fields(gffs->fields());
+    gffs.reset();
+
+    BOOST_TEST(fields[0].strValue() == "end_trask");
+    BOOST_TEST((fields[1].data() == data));
+}
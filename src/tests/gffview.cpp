@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2020-2021 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define BOOST_TEST_MODULE gffview
+
+#include <boost/test/included/unit_test.hpp>
+
+#include "../engine/resource/format/gffreader.h"
+#include "../engine/resource/format/gffwriter.h"
+#include "../engine/resource/gffview.h"
+
+using namespace std;
+
+using namespace reone;
+using namespace reone::resource;
+
+static shared_ptr<ByteArray> save(const shared_ptr<GffStruct> &root) {
+    auto out = make_shared<ostringstream>();
+    GffWriter writer(ResourceType::Utc, root);
+    writer.save(out);
+
+    string str(out->str());
+    return make_shared<ByteArray>(str.begin(), str.end());
+}
+
+static shared_ptr<GffStruct> makeItem(int stackSize) {
+    auto item = make_shared<GffStruct>(1);
+    item->add(GffStruct::Field::newResRef("InventoryRes", "g_w_blstrpstl" + to_string(stackSize)));
+    item->add(GffStruct::Field::newWord("StackSize", stackSize));
+    return move(item);
+}
+
+BOOST_AUTO_TEST_CASE(test_view_matches_reader) {
+    auto ability = make_shared<GffStruct>(2);
+    ability->add(GffStruct::Field::newByte("Str", 14));
+
+    auto root = make_shared<GffStruct>(0xffffffff);
+    root->add(GffStruct::Field::newByte("Gender", 1));
+    root->add(GffStruct::Field::newChar("Char", -2));
+    root->add(GffStruct::Field::newShort("Short", -300));
+    root->add(GffStruct::Field::newInt("HitPoints", -42));
+    root->add(GffStruct::Field::newDword("Color", 0x00ff8040));
+    root->add(GffStruct::Field::newDword64("Dword64", 0x123456789abcull));
+    root->add(GffStruct::Field::newInt64("Int64", -5));
+    root->add(GffStruct::Field::newFloat("ChallengeRating", 2.5f));
+    root->add(GffStruct::Field::newCExoString("Tag", "end_trask"));
+    root->add(GffStruct::Field::newResRef("TemplateResRef", "end_trask"));
+    root->add(GffStruct::Field::newCExoLocString("FirstName", 12345, "Trask"));
+    root->add(GffStruct::Field::newCExoLocString("LastName", -1, ""));
+    root->add(GffStruct::Field::newStrRef("Description", 777));
+    root->add(GffStruct::Field::newVector("Position", glm::vec3(1.0f, 2.0f, 3.0f)));
+    root->add(GffStruct::Field::newOrientation("Orientation", glm::quat(0.5f, 0.5f, -0.5f, 0.5f)));
+    root->add(GffStruct::Field::newStruct("Abilities", ability));
+    root->add(GffStruct::Field::newList("ItemList", vector<shared_ptr<GffStruct>> { makeItem(1), makeItem(2), makeItem(3) }));
+    root->add(GffStruct::Field::newList("EmptyList", vector<shared_ptr<GffStruct>>()));
+
+    shared_ptr<ByteArray> data(save(root));
+
+    GffReader reader;
+    reader.load(ByteView(data));
+    shared_ptr<GffStruct> tree(reader.root());
+
+    GffView view((ByteView(data)));
+    BOOST_TEST(static_cast<bool>(view));
+    BOOST_TEST((view.type() == tree->type()));
+    BOOST_TEST((view.fieldCount() == static_cast<int>(tree->fields().size())));
+
+    for (auto &name : { "Gender", "Char", "Short", "HitPoints", "Color", "Dword64", "Int64", "FirstName", "LastName", "Description" }) {
+        BOOST_TEST((view.getInt(name) == tree->getInt(name)), name);
+        BOOST_TEST((view.getUint(name) == tree->getUint(name)), name);
+        BOOST_TEST((view.getBool(name) == tree->getBool(name)), name);
+    }
+    BOOST_TEST((view.getColor("Color") == tree->getColor("Color")));
+    BOOST_TEST((view.getFloat("ChallengeRating") == tree->getFloat("ChallengeRating")));
+    for (auto &name : { "Tag", "TemplateResRef", "FirstName", "LastName", "HitPoints" }) {
+        BOOST_TEST((view.getString(name) == tree->getString(name)), name);
+    }
+    BOOST_TEST((view.getVector("Position") == tree->getVector("Position")));
+    BOOST_TEST((view.getOrientation("Orientation") == tree->getOrientation("Orientation")));
+
+    GffView abilities(view.getStruct("Abilities"));
+    BOOST_TEST((abilities.type() == 2u));
+    BOOST_TEST((abilities.getInt("Str") == 14));
+
+    vector<GffView> items(view.getList("ItemList"));
+    BOOST_TEST((items.size() == 3ll));
+    for (size_t i = 0; i < items.size(); ++i) {
+        BOOST_TEST((items[i].getString("InventoryRes") == tree->getList("ItemList")[i]->getString("InventoryRes")));
+        BOOST_TEST((items[i].getInt("StackSize") == static_cast<int>(i + 1)));
+    }
+    BOOST_TEST(view.getList("EmptyList").empty());
+}
+
+BOOST_AUTO_TEST_CASE(test_missing_fields_return_defaults) {
+    auto root = make_shared<GffStruct>(0xffffffff);
+    root->add(GffStruct::Field::newInt("HitPoints", 10));
+    GffView view(ByteView(save(root)));
+
+    BOOST_TEST((view.getInt("HitPoint", -1) == -1));
+    BOOST_TEST((view.getInt("HitPoints1", -1) == -1));
+    BOOST_TEST((view.getString("Tag", "default") == "default"));
+    BOOST_TEST(!view.getStruct("Abilities"));
+    BOOST_TEST(view.getList("ItemList").empty());
+
+    GffView empty;
+    BOOST_TEST(!empty);
+    BOOST_TEST((empty.getInt("HitPoints", 5) == 5));
+}
+
+BOOST_AUTO_TEST_CASE(test_truncated_file_throws) {
+    BOOST_CHECK_THROW(GffView(ByteView(make_shared<ByteArray>(16, '\0'))), runtime_error);
+}
@@ -30,28 +30,17 @@ namespace fs = boost::filesystem;
 
 BOOST_AUTO_TEST_CASE(test_save_load) {
     auto struct1 = make_shared<GffStruct>(0);
-    GffStruct::Field struct1Field(GffStruct::FieldType::Byte, "MyByte"); struct1Field.uintValue = 1;
-    struct1->add(move(struct1Field));
+    struct1->add(GffStruct::Field::newByte("MyByte", 1));
 
     auto struct2 = make_shared<GffStruct>(0);
-    GffStruct::Field struct2Field(GffStruct::FieldType::Byte, "MyByte"); struct2Field.uintValue = 2;
-    struct2->add(move(struct2Field));
+    struct2->add(GffStruct::Field::newByte("MyByte", 2));
 
     auto struct3 = make_shared<GffStruct>(0);
-    GffStruct::Field struct3Field(GffStruct::FieldType::Byte, "MyByte"); struct3Field.uintValue = 3;
-    struct3->add(move(struct3Field));
+    struct3->add(GffStruct::Field::newByte("MyByte", 3));
 
-    vector<GffStruct::Field> rootFields {
-        GffStruct::Field(GffStruct::FieldType::Struct, "MyStruct"),
-        GffStruct::Field(GffStruct::FieldType::List, "MyList")
-    };
-    rootFields[0].children.push_back(move(struct1));
-    rootFields[1].children.push_back(move(struct2));
-    rootFields[1].children.push_back(move(struct3));
     auto root = make_shared<GffStruct>(0xffffffff);
-    for (auto &field : rootFields) {
-        root->add(move(field));
-    }
+    root->add(GffStruct::Field::newStruct("MyStruct", move(struct1)));
+    root->add(GffStruct::Field::newList("MyList", vector<shared_ptr<GffStruct>> { move(struct2), move(struct3) }));
 
     auto out = make_shared<ostringstream>();
     GffWriter writer(ResourceType::Utp, root);
@@ -63,9 +52,9 @@ BOOST_AUTO_TEST_CASE(test_save_load) {
     auto readRoot = gff.root();
 
     BOOST_TEST((readRoot->fields().size() == 2ll));
-    BOOST_TEST((readRoot->fields()[0].children.size() == 1ll));
-    BOOST_TEST((readRoot->fields()[1].children.size() == 2ll));
-    BOOST_TEST((readRoot->fields()[0].children[0]->fields()[0].uintValue == 1));
-    BOOST_TEST((readRoot->fields()[1].children[0]->fields()[0].uintValue == 2));
-    BOOST_TEST((readRoot->fields()[1].children[1]->fields()[0].uintValue == 3));
+    BOOST_TEST((readRoot->fields()[0].children().size() == 1ll));
+    BOOST_TEST((readRoot->fields()[1].children().size() == 2ll));
+    BOOST_TEST((readRoot->fields()[0].children()[0]->fields()[0].uintValue() == 1));
+    BOOST_TEST((readRoot->fields()[1].children()[0]->fields()[0].uintValue() == 2));
+    BOOST_TEST((readRoot->fields()[1].children()[1]->fields()[0].uintValue() == 3));
 }
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2020-2021 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define BOOST_TEST_MODULE lrucache
+
+#include <boost/test/included/unit_test.hpp>
+
+#include "../engine/common/lrucache.h"
+
+using namespace std;
+
+using namespace reone;
+
+BOOST_AUTO_TEST_CASE(test_evict_least_recently_used) {
+    LruCache<string, int> cache(30);
+    cache.put("a", 1, 10);
+    cache.put("b", 2, 10);
+    cache.put("c", 3, 10);
+    BOOST_TEST((cache.find("a")->value == 1));
+
+    cache.put("d", 4, 10);
+
+    BOOST_TEST(cache.contains("a"));
+    BOOST_TEST(!cache.contains("b"));
+    BOOST_TEST(cache.contains("c"));
+    BOOST_TEST(cache.contains("d"));
+    BOOST_TEST((cache.find("b") == nullptr));
+
+    const CacheStats &stats = cache.stats();
+    BOOST_TEST((stats.hits == 1u));
+    BOOST_TEST((stats.misses == 1u));
+    BOOST_TEST((stats.evictions == 1u));
+    BOOST_TEST((stats.bytes == 30u));
+    BOOST_TEST((stats.count == 3u));
+}
+
+BOOST_AUTO_TEST_CASE(test_pinned_survive_eviction_and_invalidation) {
+    LruCache<string, int> cache(20);
+    cache.put("a", 1, 10, true);
+    cache.put("b", 2, 10);
+    cache.put("c", 3, 10);
+
+    BOOST_TEST(cache.contains("a"));
+    BOOST_TEST(!cache.contains("b"));
+
+    cache.invalidate();
+
+    BOOST_TEST(cache.contains("a"));
+    BOOST_TEST(!cache.contains("c"));
+    BOOST_TEST((cache.stats().bytes == 10u));
+
+    cache.unpin("a");
+    cache.invalidate();
+
+    BOOST_TEST(!cache.contains("a"));
+}
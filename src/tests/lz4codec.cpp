@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2020-2021 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define BOOST_TEST_MODULE lz4codec
+
+#include <boost/test/included/unit_test.hpp>
+
+#include "../engine/common/lz4codec.h"
+
+using namespace std;
+
+using namespace reone;
+
+static ByteArray roundTrip(const ByteArray &data) {
+    ByteArray compressed(compressLZ4(data.data(), data.size()));
+    ByteArray decompressed(data.size());
+    decompressLZ4(compressed.data(), compressed.size(), decompressed.data(), decompressed.size());
+    return move(decompressed);
+}
+
+BOOST_AUTO_TEST_CASE(test_round_trip) {
+    ByteArray empty;
+    ByteArray small { 'a', 'b', 'c' };
+    ByteArray repetitive(100000, 'a');
+    ByteArray text;
+    for (int i = 0; i < 1000; ++i) {
+        string line("Line " + to_string(i % 37) + " of a mostly repetitive text\n");
+        text.insert(text.end(), line.begin(), line.end());
+    }
+    ByteArray random(50000);
+    mt19937 generator(0);
+    for (auto &byte : random) {
+        byte = static_cast<char>(generator());
+    }
+
+    BOOST_TEST((roundTrip(empty) == empty));
+    BOOST_TEST((roundTrip(small) == small));
+    BOOST_TEST((roundTrip(repetitive) == repetitive));
+    BOOST_TEST((roundTrip(text) == text));
+    BOOST_TEST((roundTrip(random) == random));
+    BOOST_TEST(compressLZ4(repetitive.data(), repetitive.size()).size() < 1000ll);
+}
+
+BOOST_AUTO_TEST_CASE(test_malformed_block) {
+    ByteArray data(1000, 'a');
+    ByteArray compressed(compressLZ4(data.data(), data.size()));
+    ByteArray decompressed(data.size());
+
+    BOOST_CHECK_THROW(decompressLZ4(compressed.data(), compressed.size() - 3, decompressed.data(), decompressed.size()), runtime_error);
+    BOOST_CHECK_THROW(decompressLZ4(compressed.data(), compressed.size(), decompressed.data(), decompressed.size() - 1), runtime_error);
+}
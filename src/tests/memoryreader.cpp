@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2020-2021 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define BOOST_TEST_MODULE memoryreader
+
+#include <boost/test/included/unit_test.hpp>
+
+#include "../engine/common/memoryreader.h"
+
+using namespace std;
+
+using namespace reone;
+
+namespace endian = boost::endian;
+
+BOOST_AUTO_TEST_CASE(test_get_little_endian) {
+    string data("\x01" "\xe8\x03" "\xa0\x86\x01\x00" "\x00\xe4\x0b\x54\x02\x00\x00\x00" "\x60\x79\xfe\xff" "\x00\x00\x80\x3f" "abc\0defgh", 32);
+    MemoryReader reader(&data[0], data.size());
+    BOOST_TEST((reader.getByte() == 0x01));
+    BOOST_TEST((reader.getUint16() == 1000u));
+    BOOST_TEST((reader.getUint32() == 100000u));
+    BOOST_TEST((reader.getUint64() == 10000000000u));
+    BOOST_TEST((reader.getInt32() == -100000));
+    BOOST_TEST((reader.getFloat() == 1.0f));
+    BOOST_TEST((reader.getCString() == "abc"));
+    BOOST_TEST((reader.getString(3) == "def"));
+    BOOST_TEST((reader.getUint32(3) == 100000u));
+    BOOST_TEST((reader.tell() == 30u));
+}
+
+BOOST_AUTO_TEST_CASE(test_get_big_endian) {
+    string data("\x03\xe8" "\x00\x01\x86\xa0" "\x00\x00\x00\x02\x54\x0b\xe4\x00" "\xff\xfe\x79\x60" "\x3f\x80\x00\x00", 22);
+    MemoryReader reader(&data[0], data.size(), endian::order::big);
+    BOOST_TEST((reader.getUint16() == 1000u));
+    BOOST_TEST((reader.getUint32() == 100000u));
+    BOOST_TEST((reader.getUint64() == 10000000000u));
+    BOOST_TEST((reader.getInt32() == -100000));
+    BOOST_TEST((reader.getFloat() == 1.0f));
+}
+
+BOOST_AUTO_TEST_CASE(test_read_past_end_throws) {
+    string data("\x01\x02\x03", 3);
+    MemoryReader reader(&data[0], data.size());
+    BOOST_CHECK_THROW(reader.getUint32(), out_of_range);
+    BOOST_CHECK_THROW(reader.getBytes(2, 2), out_of_range);
+    reader.seek(3);
+    BOOST_CHECK_THROW(reader.getByte(), out_of_range);
+}
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2020-2021 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define BOOST_TEST_MODULE resourceprovider
+
+#include <boost/test/included/unit_test.hpp>
+
+#include "../engine/resource/folder.h"
+#include "../engine/resource/format/erfreader.h"
+#include "../engine/resource/format/erfwriter.h"
+#include "../engine/resource/format/packwriter.h"
+#include "../engine/resource/format/rimreader.h"
+#include "../engine/resource/format/rimwriter.h"
+#include "../engine/resource/packprovider.h"
+
+using namespace std;
+
+using namespace reone;
+using namespace reone::resource;
+
+namespace fs = boost::filesystem;
+
+static string toString(const shared_ptr<ByteArray> &data) {
+    return data ? string(data->begin(), data->end()) : string();
+}
+
+static void checkLookup(IResourceProvider &provider) {
+    BOOST_TEST(toString(provider.find("door", ResourceType::Utd)) == "utd");
+    BOOST_TEST(toString(provider.find("DOOR", ResourceType::Utd)) == "utd");
+    BOOST_TEST(toString(provider.find("Door", ResourceType::Utp)) == "utp");
+    BOOST_TEST(toString(provider.find("chest", ResourceType::Utp)) == "chest");
+    BOOST_TEST(!provider.find("door", ResourceType::Utc));
+    BOOST_TEST(!provider.find("doors", ResourceType::Utd));
+}
+
+BOOST_AUTO_TEST_CASE(test_erf_lookup) {
+    fs::path path(fs::temp_directory_path() / fs::unique_path("%%%%%%%%.erf"));
+
+    ErfWriter writer;
+    writer.add(ErfWriter::Resource { "Door", ResourceType::Utd, ByteArray { 'u', 't', 'd' } });
+    writer.add(ErfWriter::Resource { "door", ResourceType::Utp, ByteArray { 'u', 't', 'p' } });
+    writer.add(ErfWriter::Resource { "CHEST", ResourceType::Utp, ByteArray { 'c', 'h', 'e', 's', 't' } });
+    writer.save(ErfWriter::FileType::ERF, path);
+
+    ErfReader erf;
+    erf.load(path);
+    checkLookup(erf);
+
+    fs::remove(path);
+}
+
+BOOST_AUTO_TEST_CASE(test_rim_lookup) {
+    fs::path path(fs::temp_directory_path() / fs::unique_path("%%%%%%%%.rim"));
+
+    RimWriter writer;
+    writer.add(RimWriter::Resource { "door", ResourceType::Utd, ByteArray { 'u', 't', 'd' } });
+    writer.add(RimWriter::Resource { "DOOR", ResourceType::Utp, ByteArray { 'u', 't', 'p' } });
+    writer.add(RimWriter::Resource { "Chest", ResourceType::Utp, ByteArray { 'c', 'h', 'e', 's', 't' } });
+    writer.add(RimWriter::Resource { "chest", ResourceType::Utp, ByteArray { 'd', 'u', 'p' } });
+    writer.save(path);
+
+    RimReader rim;
+    rim.load(path);
+    checkLookup(rim);
+
+    fs::remove(path);
+}
+
+BOOST_AUTO_TEST_CASE(test_folder_lookup) {
+    fs::path path(fs::temp_directory_path() / fs::unique_path());
+    fs::create_directories(path);
+
+    auto writeFile = [&path](const string &name, const string &contents) {
+        fs::ofstream out(path / name, ios::binary);
+        out << contents;
+    };
+    writeFile("Door.utd", "utd");
+    writeFile("door.UTP", "utp");
+    writeFile("chest.utp", "chest");
+
+    Folder folder;
+    folder.load(path);
+    checkLookup(folder);
+
+    fs::remove_all(path);
+}
+
+BOOST_AUTO_TEST_CASE(test_pack_lookup) {
+    fs::path path(fs::temp_directory_path() / fs::unique_path("%%%%%%%%.rpk"));
+
+    auto makeData = [](const string &str) {
+        return [str]() { return ByteView(make_shared<ByteArray>(str.begin(), str.end())); };
+    };
+    string large(3 * PackResourceProvider::kPageSize, 'x');
+
+    PackWriter writer(true);
+    writer.add(PackWriter::Resource { "Door", ResourceType::Utd, makeData("utd") });
+    writer.add(PackWriter::Resource { "door", ResourceType::Utp, makeData("dup") });
+    writer.add(PackWriter::Resource { "DOOR", ResourceType::Utp, makeData("utp") });
+    writer.add(PackWriter::Resource { "chest", ResourceType::Utp, makeData("chest") });
+    writer.add(PackWriter::Resource { "large", ResourceType::Tpc, makeData(large) });
+    for (int i = 0; i < 100; ++i) {
+        writer.add(PackWriter::Resource { "res" + to_string(i), ResourceType::Utc, makeData(to_string(i)) });
+    }
+    writer.save(path);
+    {
+        PackResourceProvider pack;
+        pack.load(path);
+        checkLookup(pack);
+
+        BOOST_TEST(pack.entryCount() == 104);
+        BOOST_TEST(toString(pack.find("large", ResourceType::Tpc)) == large);
+        for (int i = 0; i < 100; ++i) {
+            BOOST_TEST(toString(pack.find("res" + to_string(i), ResourceType::Utc)) == to_string(i));
+        }
+    }
+    fs::remove(path);
+}
@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2020-2021 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define BOOST_TEST_MODULE resources
+
+#include <boost/test/included/unit_test.hpp>
+
+#include "../engine/resource/format/2dawriter.h"
+#include "../engine/resource/format/erfwriter.h"
+#include "../engine/resource/format/gffwriter.h"
+#include "../engine/resource/resources.h"
+
+using namespace std;
+
+using namespace reone;
+using namespace reone::resource;
+
+namespace fs = boost::filesystem;
+
+static constexpr int kNumResources = 64;
+static constexpr int kNumThreads = 8;
+static constexpr int kNumLookupsPerThread = 4000;
+
+static ByteArray readFile(const fs::path &path) {
+    fs::ifstream in(path, ios::binary);
+    return ByteArray(istreambuf_iterator<char>(in), istreambuf_iterator<char>());
+}
+
+static ByteArray make2DA(int i) {
+    auto twoDa = make_shared<TwoDA>();
+    twoDa->addColumn("label");
+    twoDa->addColumn("value");
+    for (int row = 0; row <= i; ++row) {
+        twoDa->add(TwoDA::Row { { "row" + to_string(row), to_string(i * row) } });
+    }
+
+    fs::path path(fs::temp_directory_path() / fs::unique_path("%%%%%%%%.2da"));
+    TwoDaWriter(twoDa).save(path);
+    ByteArray data(readFile(path));
+    fs::remove(path);
+
+    return move(data);
+}
+
+static ByteArray makeGFF(int i) {
+    auto root = make_shared<GffStruct>(0xffffffff);
+    root->add(GffStruct::Field::newInt("Value", i));
+
+    auto out = make_shared<ostringstream>();
+    GffWriter(ResourceType::Utc, root).save(out);
+    string str(out->str());
+
+    return ByteArray(str.begin(), str.end());
+}
+
+static string getRawResRef(int i) { return "raw" + to_string(i); }
+static string get2DAResRef(int i) { return "table" + to_string(i); }
+static string getGFFResRef(int i) { return "creature" + to_string(i); }
+
+BOOST_AUTO_TEST_CASE(test_concurrent_lookups) {
+    fs::path path(fs::temp_directory_path() / fs::unique_path("%%%%%%%%.erf"));
+
+    ErfWriter writer;
+    for (int i = 0; i < kNumResources; ++i) {
+        writer.add(ErfWriter::Resource { getRawResRef(i), ResourceType::Txi, ByteArray(16 * (i + 1), static_cast<char>(i)) });
+        writer.add(ErfWriter::Resource { get2DAResRef(i), ResourceType::TwoDa, make2DA(i) });
+        writer.add(ErfWriter::Resource { getGFFResRef(i), ResourceType::Utc, makeGFF(i) });
+    }
+    writer.save(ErfWriter::FileType::ERF, path);
+
+    // Small budget makes lookups evict each other
+    Resources resources(64 * 1024);
+    resources.indexErfFile(path);
+
+    atomic_int failures { 0 };
+    vector<thread> threads;
+    for (int t = 0; t < kNumThreads; ++t) {
+        threads.push_back(thread([&, t]() {
+            mt19937 random(t);
+            for (int n = 0; n < kNumLookupsPerThread; ++n) {
+                int i = random() % kNumResources;
+                switch (random() % 4) {
+                    case 0: {
+                        shared_ptr<ByteArray> data(resources.getRaw(getRawResRef(i), ResourceType::Txi));
+                        if (!data || data->size() != 16 * (i + 1) || (*data)[0] != static_cast<char>(i)) ++failures;
+                        break;
+                    }
+                    case 1: {
+                        shared_ptr<TwoDA> twoDa(resources.get2DA(get2DAResRef(i)));
+                        if (!twoDa || twoDa->getRowCount() != i + 1 || twoDa->getInt(i, "value") != i * i) ++failures;
+                        break;
+                    }
+                    case 2: {
+                        shared_ptr<GffStruct> gff(resources.getGFF(getGFFResRef(i), ResourceType::Utc));
+                        if (!gff || gff->getInt("Value") != i) ++failures;
+                        break;
+                    }
+                    default:
+                        if (resources.getRaw("missing" + to_string(i), ResourceType::Txi, false)) ++failures;
+                        break;
+                }
+            }
+        }));
+    }
+
+    // Concurrently pin resources and invalidate caches, as the main thread would
+    for (int i = 0; i < kNumResources; ++i) {
+        resources.pin(get2DAResRef(i), ResourceType::TwoDa);
+        resources.invalidateCache();
+        resources.unpin(get2DAResRef(i), ResourceType::TwoDa);
+    }
+
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    BOOST_TEST(failures == 0);
+
+    CacheStats stats(resources.rawCacheStats());
+    BOOST_TEST(stats.bytes <= 32 * 1024);
+    BOOST_TEST(stats.evictions > 0);
+
+    fs::remove(path);
+}
+
+BOOST_AUTO_TEST_CASE(test_prefetch) {
+    fs::path path(fs::temp_directory_path() / fs::unique_path("%%%%%%%%.erf"));
+
+    ErfWriter writer;
+    for (int i = 0; i < kNumResources; ++i) {
+        writer.add(ErfWriter::Resource { getRawResRef(i), ResourceType::Txi, ByteArray(16 * (i + 1), static_cast<char>(i)) });
+    }
+    writer.save(ErfWriter::FileType::ERF, path);
+
+    Resources resources;
+    resources.indexErfFile(path);
+
+    vector<ResourceId> ids;
+    for (int i = 0; i < kNumResources; ++i) {
+        ids.push_back(ResourceId(getRawResRef(i), ResourceType::Txi));
+    }
+    ids.push_back(ResourceId("missing", ResourceType::Txi));
+
+    atomic_int completions { 0 };
+    shared_ptr<PrefetchBatch> batch(resources.prefetch(ids, PrefetchPriority::High, [&]() { ++completions; }));
+    batch->wait();
+
+    BOOST_TEST(batch->isComplete());
+    BOOST_TEST(batch->loadedCount() == kNumResources);
+    BOOST_TEST(completions == 1);
+    BOOST_TEST(resources.rawCacheStats().count == kNumResources);
+
+    // Cancelled batches complete, skipping pending resources
+    shared_ptr<PrefetchBatch> cancelled(resources.prefetch(ids, PrefetchPriority::Low));
+    cancelled->cancel();
+    resources.cancelPrefetch();
+    cancelled->future().wait();
+
+    BOOST_TEST(cancelled->isComplete());
+
+    fs::remove(path);
+}
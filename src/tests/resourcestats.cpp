@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2020-2021 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define BOOST_TEST_MODULE resourcestats
+
+#include <boost/test/included/unit_test.hpp>
+
+#include "../engine/resource/format/erfwriter.h"
+#include "../engine/resource/resources.h"
+#include "../engine/resource/resourcestats.h"
+
+using namespace std;
+
+using namespace reone;
+using namespace reone::resource;
+
+namespace fs = boost::filesystem;
+
+BOOST_AUTO_TEST_CASE(test_histogram_percentiles) {
+    ResourceStats::Histogram histogram;
+    for (int i = 0; i < 90; ++i) {
+        histogram.add(3);
+    }
+    for (int i = 0; i < 10; ++i) {
+        histogram.add(1000);
+    }
+
+    BOOST_TEST(histogram.count == 100u);
+    BOOST_TEST(histogram.maxMicros == 1000u);
+    BOOST_TEST(histogram.getPercentile(0.5f) == 4u);
+    BOOST_TEST(histogram.getPercentile(0.9f) == 4u);
+    BOOST_TEST(histogram.getPercentile(0.95f) == 1000u);
+    BOOST_TEST(ResourceStats::Histogram().getPercentile(0.5f) == 0u);
+}
+
+BOOST_AUTO_TEST_CASE(test_modules_are_archived) {
+    ResourceStats stats;
+    stats.beginModule("danm13");
+    stats.recordMiss(ResourceType::Mdl);
+    stats.recordRead(ResourceId("plc_chair", ResourceType::Mdl), "danm13.rim", 128, 0.001f);
+    stats.beginModule("danm14aa");
+    stats.recordHit(ResourceType::Mdl);
+
+    ResourceStats::ModuleStats current(stats.current());
+    BOOST_TEST(current.module == "danm14aa");
+    BOOST_TEST(current.types[ResourceType::Mdl].hits == 1u);
+    BOOST_TEST(current.providers.empty());
+
+    ostringstream json;
+    stats.saveJSON(json);
+    string text(json.str());
+    BOOST_TEST((text.find("\"danm13\"") != string::npos));
+    BOOST_TEST((text.find("\"danm13.rim\"") != string::npos));
+    BOOST_TEST((text.find("\"danm14aa\"") != string::npos));
+}
+
+BOOST_AUTO_TEST_CASE(test_resources_record_accesses) {
+    fs::path path(fs::temp_directory_path() / fs::unique_path("%%%%%%%%.erf"));
+
+    ErfWriter writer;
+    writer.add(ErfWriter::Resource { "features", ResourceType::Txi, ByteArray(64, 'x') });
+    writer.save(ErfWriter::FileType::ERF, path);
+
+    {
+        Resources resources;
+        resources.indexErfFile(path);
+        resources.getView("features", ResourceType::Txi);
+        resources.getView("features", ResourceType::Txi);
+        resources.getView("missing", ResourceType::Txi, false);
+
+        ResourceStats::ModuleStats stats(resources.stats().current());
+        const ResourceStats::TypeStats &txi = stats.types[ResourceType::Txi];
+        BOOST_TEST(txi.requests == 3u);
+        BOOST_TEST(txi.hits == 1u);
+        BOOST_TEST(txi.misses == 1u);
+        BOOST_TEST(txi.notFound == 1u);
+        BOOST_TEST(txi.bytesRead == 64u);
+
+        const ResourceStats::ProviderStats &provider = stats.providers[path.filename().string()];
+        BOOST_TEST(provider.reads == 1u);
+        BOOST_TEST(provider.bytesRead == 64u);
+    }
+
+    fs::remove(path);
+}
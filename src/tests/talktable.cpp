@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2020-2021 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define BOOST_TEST_MODULE talktable
+
+#include <boost/test/included/unit_test.hpp>
+
+#include "../engine/resource/format/tlkreader.h"
+#include "../engine/resource/format/tlkwriter.h"
+#include "../engine/resource/strings.h"
+
+using namespace std;
+
+using namespace reone::resource;
+
+namespace fs = boost::filesystem;
+
+static void writeTalkTable(const fs::path &path) {
+    auto table = make_shared<TalkTable>();
+    table->addString(TalkTableString { "Hello, {note}world!", "N_Hello" });
+    table->addString(TalkTableString { "", "" });
+    table->addString(TalkTableString { "{a}{b}c{d}e{f", "" });
+    table->addString(TalkTableString { "a{b{c}d}e", "" });
+
+    TlkWriter writer(move(table));
+    writer.save(path);
+}
+
+BOOST_AUTO_TEST_CASE(test_decode_strings_lazily) {
+    fs::path path(fs::temp_directory_path() / fs::unique_path("%%%%%%%%.tlk"));
+    writeTalkTable(path);
+    {
+        TlkReader tlk;
+        tlk.load(path);
+
+        shared_ptr<TalkTable> table(tlk.table());
+        BOOST_TEST(table->getStringCount() == 4);
+        BOOST_TEST(table->getText(0) == "Hello, {note}world!");
+        BOOST_TEST(table->getSoundResRef(0) == "n_hello");
+        BOOST_TEST(table->getText(1) == "");
+        BOOST_TEST((&table->getString(2) == &table->getString(2)));
+        BOOST_TEST(table->getString(2).text == "{a}{b}c{d}e{f");
+        BOOST_CHECK_THROW(table->getText(4), out_of_range);
+        BOOST_CHECK_THROW(table->addString(TalkTableString()), logic_error);
+    }
+    fs::remove(path);
+}
+
+BOOST_AUTO_TEST_CASE(test_strip_developer_notes) {
+    fs::path path(fs::temp_directory_path() / fs::unique_path());
+    fs::create_directories(path);
+    writeTalkTable(path / "dialog.tlk");
+    {
+        Strings strings;
+        strings.init(path);
+
+        BOOST_TEST(strings.get(0) == "Hello, world!");
+        BOOST_TEST(strings.get(0) == "Hello, world!");
+        BOOST_TEST(strings.getSound(0) == "n_hello");
+        BOOST_TEST(strings.get(2) == "ce{f");
+        BOOST_TEST(strings.get(3) == "ad}e");
+        BOOST_TEST(strings.get(4) == "");
+        BOOST_TEST(strings.get(-1) == "");
+    }
+    fs::remove_all(path);
+}
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2020-2021 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define BOOST_TEST_MODULE textureutil
+
+#include <boost/test/included/unit_test.hpp>
+
+#include "s3tc.h"
+
+#include "../engine/graphics/texture/textureutil.h"
+
+using namespace std;
+
+using namespace reone;
+using namespace reone::graphics;
+
+static ByteArray makeRandomBytes(size_t size, uint32_t seed) {
+    mt19937 random(seed);
+    ByteArray result(size);
+    for (auto &value : result) {
+        value = static_cast<char>(random() & 0xff);
+    }
+    return move(result);
+}
+
+/**
+ * Reference decompression with the S3TC library, that only handles
+ * dimensions divisible by four.
+ */
+static ByteArray decompressReference(int size, const ByteArray &blocks, bool alpha) {
+    vector<unsigned long> decompPixels(size * size + 16); // reference decoder reads and writes past the end
+    ByteArray padded(blocks);
+    padded.resize(blocks.size() + 16);
+    if (alpha) {
+        BlockDecompressImageDXT5(size, size, reinterpret_cast<const uint8_t *>(padded.data()), &decompPixels[0]);
+    } else {
+        BlockDecompressImageDXT1(size, size, reinterpret_cast<const uint8_t *>(padded.data()), &decompPixels[0]);
+    }
+
+    ByteArray result;
+    for (int i = 0; i < size * size; ++i) {
+        unsigned long pixel = decompPixels[i];
+        result.push_back(static_cast<char>((pixel >> 24) & 0xff));
+        result.push_back(static_cast<char>((pixel >> 16) & 0xff));
+        result.push_back(static_cast<char>((pixel >> 8) & 0xff));
+        if (alpha) {
+            result.push_back(static_cast<char>(pixel & 0xff));
+        }
+    }
+    return move(result);
+}
+
+static void rotateReference(ByteArray &pixels, size_t n, int bpp) {
+    for (size_t x = 0; x < n / 2; ++x) {
+        for (size_t y = 0; y < (n + 1) / 2; ++y) {
+            const size_t d0 = ( y          * n +  x         ) * bpp;
+            const size_t d1 = ((n - 1 - x) * n +  y         ) * bpp;
+            const size_t d2 = ((n - 1 - y) * n + (n - 1 - x)) * bpp;
+            const size_t d3 = ( x          * n + (n - 1 - y)) * bpp;
+            for (int p = 0; p < bpp; ++p) {
+                char tmp = pixels[d0 + p];
+                pixels[d0 + p] = pixels[d1 + p];
+                pixels[d1 + p] = pixels[d2 + p];
+                pixels[d2 + p] = pixels[d3 + p];
+                pixels[d3 + p] = tmp;
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_decompress_matches_reference) {
+    static constexpr int kSize = 64;
+
+    for (bool alpha : { false, true }) {
+        size_t blockCount = (kSize / 4) * (kSize / 4);
+        ByteArray blocks(makeRandomBytes(blockCount * (alpha ? 16 : 8), alpha ? 2 : 1));
+
+        Texture::MipMap mipMap;
+        mipMap.width = kSize;
+        mipMap.height = kSize;
+        mipMap.pixels = make_shared<ByteArray>(blocks);
+        PixelFormat format;
+        decompressMipMap(mipMap, alpha ? PixelFormat::DXT5 : PixelFormat::DXT1, format);
+
+        BOOST_TEST((format == (alpha ? PixelFormat::RGBA : PixelFormat::RGB)));
+        BOOST_TEST((*mipMap.pixels == decompressReference(kSize, blocks, alpha)));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_decompress_small_mip_map) {
+    Texture::MipMap mipMap;
+    mipMap.width = 2;
+    mipMap.height = 1;
+    mipMap.pixels = make_shared<ByteArray>(makeRandomBytes(16, 3));
+    PixelFormat format;
+    decompressMipMap(mipMap, PixelFormat::DXT5, format);
+
+    BOOST_TEST(mipMap.pixels->size() == 8ll);
+}
+
+BOOST_AUTO_TEST_CASE(test_rotate_matches_reference) {
+    for (size_t n : { 1, 7, 33, 64 }) {
+        for (int times = 0; times < 4; ++times) {
+            ByteArray expected(makeRandomBytes(3 * n * n, static_cast<uint32_t>(n)));
+            Texture::MipMap mipMap;
+            mipMap.width = static_cast<int>(n);
+            mipMap.height = static_cast<int>(n);
+            mipMap.pixels = make_shared<ByteArray>(expected);
+
+            rotateMipMap90(mipMap, 3, times);
+            for (int i = 0; i < times; ++i) {
+                rotateReference(expected, n, 3);
+            }
+
+            BOOST_TEST((*mipMap.pixels == expected));
+        }
+    }
+}
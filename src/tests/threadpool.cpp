@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2020-2021 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define BOOST_TEST_MODULE threadpool
+
+#include <boost/test/included/unit_test.hpp>
+
+#include "../engine/common/threadpool.h"
+
+using namespace std;
+
+using namespace reone;
+
+BOOST_AUTO_TEST_CASE(test_tasks_run_in_priority_order) {
+    vector<int> order;
+    promise<void> blocked;
+    shared_future<void> unblocked(blocked.get_future().share());
+    {
+        ThreadPool pool(1);
+        pool.enqueue([&]() { unblocked.wait(); });
+        pool.enqueue([&]() { order.push_back(1); }, 0);
+        pool.enqueue([&]() { order.push_back(2); }, 0);
+        pool.enqueue([&]() { order.push_back(3); }, 2);
+        pool.enqueue([&]() { order.push_back(4); }, 1);
+        blocked.set_value();
+    }
+
+    vector<int> expectedOrder { 3, 4, 1, 2 };
+    BOOST_TEST((order == expectedOrder));
+}
+
+BOOST_AUTO_TEST_CASE(test_failed_task_does_not_stop_pool) {
+    atomic_int count { 0 };
+    {
+        ThreadPool pool(2);
+        pool.enqueue([]() { throw runtime_error("failed"); });
+        for (int i = 0; i < 100; ++i) {
+            pool.enqueue([&]() { ++count; });
+        }
+    }
+
+    BOOST_TEST(count == 100);
+}
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2020-2021 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define BOOST_TEST_MODULE tpcreader
+
+#include <boost/test/included/unit_test.hpp>
+
+#include "../engine/graphics/texture/tpcreader.h"
+
+using namespace std;
+
+using namespace reone;
+using namespace reone::graphics;
+
+static ByteView makeTPC(int width, int height, int mipMapCount, const string &txi) {
+    auto data = make_shared<ByteArray>(128);
+    (*data)[8] = static_cast<char>(width);
+    (*data)[10] = static_cast<char>(height);
+    (*data)[12] = 1; // grayscale
+    (*data)[13] = static_cast<char>(mipMapCount);
+    for (int i = 0; i < mipMapCount; ++i) {
+        data->insert(data->end(), (width >> i) * (height >> i), static_cast<char>(i + 1));
+    }
+    data->insert(data->end(), txi.begin(), txi.end());
+
+    return ByteView(data);
+}
+
+BOOST_AUTO_TEST_CASE(test_read_features_skips_pixels) {
+    ByteView data(makeTPC(8, 8, 4, "envmaptexture CM_Baremetal\r\nbumpmaptexture LBM_Wave\r\n"));
+
+    Texture::Features features(TpcReader::readFeatures(data));
+    BOOST_TEST(features.envmapTexture == "CM_Baremetal");
+    BOOST_TEST(features.bumpmapTexture == "LBM_Wave");
+
+    TpcReader tpc("texture", TextureUsage::Diffuse, true);
+    tpc.load(data);
+    shared_ptr<Texture> texture(tpc.texture());
+    BOOST_TEST(texture->width() == 8);
+    BOOST_TEST(texture->layers()[0].mipMaps.size() == 4ll);
+    BOOST_TEST(texture->features().envmapTexture == features.envmapTexture);
+}
+
+BOOST_AUTO_TEST_CASE(test_read_features_without_txi) {
+    Texture::Features features(TpcReader::readFeatures(makeTPC(4, 4, 1, "")));
+    BOOST_TEST(features.envmapTexture.empty());
+}
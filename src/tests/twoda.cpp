@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2020-2021 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define BOOST_TEST_MODULE twoda
+
+#include <boost/test/included/unit_test.hpp>
+
+#include "../engine/resource/format/2dareader.h"
+#include "../engine/resource/format/2dawriter.h"
+
+using namespace std;
+
+using namespace reone::resource;
+
+namespace fs = boost::filesystem;
+
+static unique_ptr<TwoDA> makeTwoDA() {
+    auto twoDa = make_unique<TwoDA>();
+    twoDa->addColumn("label");
+    twoDa->addColumn("value");
+    twoDa->addColumn("scale");
+    twoDa->add(TwoDA::Row { { "first", "1", "0.5" } });
+    twoDa->add(TwoDA::Row { { "second", "****", "" } });
+    twoDa->add(TwoDA::Row { { "third", "-3", "2" } });
+    twoDa->add(TwoDA::Row { { "fourth", "abc", "1" } });
+    return move(twoDa);
+}
+
+BOOST_AUTO_TEST_CASE(test_get_values) {
+    auto twoDa = makeTwoDA();
+
+    BOOST_TEST(twoDa->getRowCount() == 4);
+    BOOST_TEST(twoDa->getColumnCount() == 3);
+    BOOST_TEST(twoDa->getString(0, "label") == "first");
+    BOOST_TEST(twoDa->getString(1, "value", "def") == "def");
+    BOOST_TEST(twoDa->getString(0, "missing", "def") == "def");
+    BOOST_TEST(twoDa->getCellValue(1, 1) == "****");
+    BOOST_TEST(twoDa->getInt(0, "value") == 1);
+    BOOST_TEST(twoDa->getInt(1, "value", 7) == 7);
+    BOOST_TEST(twoDa->getInt(2, "value") == -3);
+    BOOST_TEST(twoDa->getInt(5, "value", 7) == 7);
+    BOOST_TEST(twoDa->getBool(0, "value"));
+    BOOST_TEST(twoDa->getFloat(0, "scale") == 0.5f);
+    BOOST_TEST(twoDa->getFloat(1, "scale", 4.0f) == 4.0f);
+    BOOST_CHECK_THROW(twoDa->getInt(3, "value"), invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(test_parsed_values_follow_added_rows) {
+    auto twoDa = makeTwoDA();
+    BOOST_TEST(twoDa->getInt(2, "value") == -3);
+
+    twoDa->add(TwoDA::Row { { "fifth", "5", "" } });
+
+    BOOST_TEST(twoDa->getInt(4, "value") == 5);
+}
+
+BOOST_AUTO_TEST_CASE(test_index_by_cell_values) {
+    auto twoDa = makeTwoDA();
+
+    BOOST_TEST(twoDa->indexByCellValue("label", "third") == 2);
+    BOOST_TEST(twoDa->indexByCellValue("label", "sixth") == -1);
+    BOOST_TEST(twoDa->indexByCellValues({ { "label", "fourth" }, { "scale", "1" } }) == 3);
+    BOOST_TEST(twoDa->indexByCellValues({ { "label", "fourth" }, { "scale", "2" } }) == -1);
+}
+
+BOOST_AUTO_TEST_CASE(test_save_load) {
+    shared_ptr<TwoDA> twoDa(makeTwoDA());
+    fs::path path(fs::temp_directory_path() / fs::unique_path("%%%%%%%%.2da"));
+
+    {
+        TwoDaWriter writer(twoDa);
+        writer.save(path);
+    }
+
+    TwoDaReader reader;
+    reader.load(path);
+    fs::remove(path);
+    shared_ptr<TwoDA> readTwoDa(reader.twoDa());
+
+    BOOST_TEST(readTwoDa->getRowCount() == 4);
+    BOOST_TEST(readTwoDa->getString(2, "label") == "third");
+    BOOST_TEST(readTwoDa->getInt(2, "value") == -3);
+    BOOST_TEST(readTwoDa->getCellValue(1, 1) == "****");
+}
+
+BOOST_AUTO_TEST_CASE(test_indexes_follow_added_rows) {
+    auto twoDa = makeTwoDA();
+    BOOST_TEST(twoDa->indexByCellValue("scale", "1") == 3);
+    BOOST_TEST(twoDa->indexByCellValues({ { "value", "5" }, { "scale", "1" } }) == -1);
+
+    twoDa->add(TwoDA::Row { { "fifth", "5", "1" } });
+
+    BOOST_TEST(twoDa->indexByCellValue("scale", "1") == 3);
+    BOOST_TEST(twoDa->indexByCellValue("label", "fifth") == 4);
+    BOOST_TEST(twoDa->indexByCellValues({ { "value", "5" }, { "scale", "1" } }) == 4);
+}
@@ -36,6 +36,9 @@ namespace tools {
 
 void GffTool::invoke(Operation operation, const fs::path &target, const fs::path &gamePath, const fs::path &destPath) {
     switch (operation) {
+        case Operation::List:
+            list(target);
+            break;
         case Operation::ToJSON:
             toJSON(target, destPath);
             break;
@@ -47,10 +50,54 @@ void GffTool::invoke(Operation operation, const fs::path &target, const fs::path
     }
 }
 
+struct MemoryUsage {
+    int structCount { 0 };
+    int fieldCount { 0 };
+    int childrenCount { 0 };
+    size_t structBytes { 0 };
+    size_t fieldBytes { 0 };
+    size_t childrenBytes { 0 };
+};
+
+static void getMemoryUsage(const GffStruct &gffs, MemoryUsage &usage) {
+    ++usage.structCount;
+    usage.structBytes += sizeof(GffStruct);
+    usage.fieldCount += static_cast<int>(gffs.fields().size());
+    usage.fieldBytes += gffs.fields().capacity() * sizeof(GffStruct::Field);
+
+    for (auto &field : gffs.fields()) {
+        if (field.type != GffStruct::FieldType::Struct && field.type != GffStruct::FieldType::List) continue;
+
+        usage.childrenBytes += sizeof(vector<shared_ptr<GffStruct>>) + field.children().capacity() * sizeof(shared_ptr<GffStruct>);
+        for (auto &child : field.children()) {
+            ++usage.childrenCount;
+            getMemoryUsage(*child, usage);
+        }
+    }
+}
+
+void GffTool::list(const fs::path &path) {
+    GffReader gff;
+    gff.load(path);
+
+    shared_ptr<GffStruct> root(gff.root());
+    MemoryUsage usage;
+    getMemoryUsage(*root, usage);
+
+    size_t arenaBytes = root->arena() ? root->arena()->bytes() : 0;
+    size_t totalBytes = usage.structBytes + usage.fieldBytes + usage.childrenBytes + arenaBytes;
+
+    cout << "Structs: " << usage.structCount << ", " << usage.structBytes << " bytes" << endl;
+    cout << "Fields: " << usage.fieldCount << ", " << usage.fieldBytes << " bytes (" << sizeof(GffStruct::Field) << " bytes per field)" << endl;
+    cout << "Children: " << usage.childrenCount << ", " << usage.childrenBytes << " bytes" << endl;
+    cout << "Arena: " << arenaBytes << " bytes" << endl;
+    cout << "Total: " << totalBytes << " bytes" << endl;
+}
+
 static pt::ptree getPropertyTree(const GffStruct &gffs) {
     pt::ptree fields;
     for (auto &field : gffs.fields()) {
-        fields.put(field.label, static_cast<int>(field.type));
+        fields.put(field.label.str(), static_cast<int>(field.type));
     }
 
     pt::ptree tree;
@@ -62,59 +109,60 @@ static pt::ptree getPropertyTree(const GffStruct &gffs) {
             case GffStruct::FieldType::Byte:
             case GffStruct::FieldType::Word:
             case GffStruct::FieldType::Dword:
-                tree.put(field.label, field.uintValue);
+                tree.put(field.label.str(), field.uintValue());
                 break;
             case GffStruct::FieldType::Char:
             case GffStruct::FieldType::Short:
             case GffStruct::FieldType::Int:
             case GffStruct::FieldType::StrRef:
-                tree.put(field.label, field.intValue);
+                tree.put(field.label.str(), field.intValue());
                 break;
             case GffStruct::FieldType::Dword64:
-                tree.put(field.label, field.uint64Value);
+                tree.put(field.label.str(), field.uint64Value());
                 break;
             case GffStruct::FieldType::Int64:
-                tree.put(field.label, field.int64Value);
+                tree.put(field.label.str(), field.int64Value());
                 break;
             case GffStruct::FieldType::Float:
-                tree.put(field.label, field.floatValue);
+                tree.put(field.label.str(), field.floatValue());
                 break;
             case GffStruct::FieldType::Double:
-                tree.put(field.label, field.doubleValue);
+                tree.put(field.label.str(), field.doubleValue());
                 break;
             case GffStruct::FieldType::CExoString:
             case GffStruct::FieldType::ResRef:
-                tree.put(field.label, field.strValue);
+                tree.put(field.label.str(), field.strValue());
                 break;
             case GffStruct::FieldType::CExoLocString:
-                tree.put(field.label, boost::format("%d|%s") % field.intValue % field.strValue);
+                tree.put(field.label.str(), boost::format("%d|%s") % field.intValue() % field.strValue());
                 break;
             case GffStruct::FieldType::Void: {
+                ByteArray data(field.data());
                 string value;
-                value.resize(2 * field.data.size());
-                for (size_t i = 0; i < field.data.size(); ++i) {
-                    sprintf(&value[2 * i], "%02hhx", field.data[i]);
+                value.resize(2 * data.size());
+                for (size_t i = 0; i < data.size(); ++i) {
+                    sprintf(&value[2 * i], "%02hhx", data[i]);
                 }
-                tree.put(field.label, value);
+                tree.put(field.label.str(), value);
                 break;
             }
             case GffStruct::FieldType::Struct: {
-                tree.add_child(field.label, getPropertyTree(*field.children[0]));
+                tree.add_child(field.label.str(), getPropertyTree(*field.children()[0]));
                 break;
             }
             case GffStruct::FieldType::List: {
                 pt::ptree children;
-                for (auto &child : field.children) {
+                for (auto &child : field.children()) {
                     children.push_back(make_pair("", getPropertyTree(*child)));
                 }
-                tree.add_child(field.label, children);
+                tree.add_child(field.label.str(), children);
                 break;
             }
             case GffStruct::FieldType::Orientation:
-                tree.put(field.label, boost::format("%f|%f|%f|%f") % field.quatValue.w % field.quatValue.x % field.quatValue.y % field.quatValue.z);
+                tree.put(field.label.str(), boost::format("%f|%f|%f|%f") % field.quatValue().w % field.quatValue().x % field.quatValue().y % field.quatValue().z);
                 break;
             case GffStruct::FieldType::Vector:
-                tree.put(field.label, boost::format("%f|%f|%f") % field.vecValue.x % field.vecValue.y % field.vecValue.z);
+                tree.put(field.label.str(), boost::format("%f|%f|%f") % field.vecValue().x % field.vecValue().y % field.vecValue().z);
                 break;
             default:
                 cerr << "Unsupported GFF field type: " << to_string(static_cast<int>(field.type)) << endl;
@@ -153,86 +201,95 @@ static unique_ptr<GffStruct> treeToGffStruct(const pt::ptree &tree) {
         // Properties with a leading underscore are metadata
         if (boost::starts_with(child.first, "_")) continue;
 
-        GffStruct::Field field;
-        field.type = fieldTypes[child.first];
-        field.label = child.first;
+        GffStruct::FieldType type = fieldTypes[child.first];
+        GffLabel label(child.first);
 
-        switch (field.type) {
+        switch (type) {
             case GffStruct::FieldType::Byte:
+                gffs->add(GffStruct::Field::newByte(label, child.second.get_value<uint32_t>()));
+                break;
             case GffStruct::FieldType::Word:
+                gffs->add(GffStruct::Field::newWord(label, child.second.get_value<uint32_t>()));
+                break;
             case GffStruct::FieldType::Dword:
-                field.uintValue = child.second.get_value<uint32_t>();
+                gffs->add(GffStruct::Field::newDword(label, child.second.get_value<uint32_t>()));
                 break;
             case GffStruct::FieldType::Char:
+                gffs->add(GffStruct::Field::newChar(label, child.second.get_value<int32_t>()));
+                break;
             case GffStruct::FieldType::Short:
+                gffs->add(GffStruct::Field::newShort(label, child.second.get_value<int32_t>()));
+                break;
             case GffStruct::FieldType::Int:
-                field.intValue = child.second.get_value<int32_t>();
+                gffs->add(GffStruct::Field::newInt(label, child.second.get_value<int32_t>()));
                 break;
             case GffStruct::FieldType::Dword64:
-                field.uint64Value = child.second.get_value<uint64_t>();
+                gffs->add(GffStruct::Field::newDword64(label, child.second.get_value<uint64_t>()));
                 break;
             case GffStruct::FieldType::Int64:
-                field.int64Value = child.second.get_value<int64_t>();
+                gffs->add(GffStruct::Field::newInt64(label, child.second.get_value<int64_t>()));
                 break;
             case GffStruct::FieldType::Float:
-                field.floatValue = child.second.get_value<float>();
+                gffs->add(GffStruct::Field::newFloat(label, child.second.get_value<float>()));
                 break;
             case GffStruct::FieldType::Double:
-                field.doubleValue = child.second.get_value<double>();
+                gffs->add(GffStruct::Field::newDouble(label, child.second.get_value<double>()));
                 break;
             case GffStruct::FieldType::CExoString:
-                field.strValue = child.second.get_value<string>();
+                gffs->add(GffStruct::Field::newCExoString(label, child.second.get_value<string>()));
                 break;
             case GffStruct::FieldType::ResRef:
-                field.strValue = child.second.get_value<string>();
+                gffs->add(GffStruct::Field::newResRef(label, child.second.get_value<string>()));
                 break;
             case GffStruct::FieldType::CExoLocString: {
                 string value(child.second.get_value<string>());
                 boost::split(tokens, value, boost::is_any_of("|"), boost::token_compress_on);
-                field.intValue = stoi(tokens[0]);
-                field.strValue = tokens[1];
+                gffs->add(GffStruct::Field::newCExoLocString(label, stoi(tokens[0]), tokens[1]));
                 break;
             }
             case GffStruct::FieldType::Void: {
                 string value(child.second.get_value<string>());
+                ByteArray data;
                 for (size_t i = 0; i < value.length(); i += 2) {
                     uint8_t byte;
                     if (sscanf(value.c_str(), "%02hhx", &byte)) {
-                        field.data.push_back(*reinterpret_cast<char *>(&byte));
+                        data.push_back(*reinterpret_cast<char *>(&byte));
                     }
                 }
+                gffs->add(GffStruct::Field::newVoid(label, data));
                 break;
             }
             case GffStruct::FieldType::Struct:
-                field.children.push_back(treeToGffStruct(child.second));
+                gffs->add(GffStruct::Field::newStruct(label, treeToGffStruct(child.second)));
                 break;
-            case GffStruct::FieldType::List:
+            case GffStruct::FieldType::List: {
+                vector<shared_ptr<GffStruct>> children;
                 if (!child.second.empty()) {
                     for (auto &childChild : child.second) {
-                        field.children.push_back(treeToGffStruct(childChild.second));
+                        children.push_back(treeToGffStruct(childChild.second));
                     }
                 }
+                gffs->add(GffStruct::Field::newList(label, move(children)));
                 break;
+            }
             case GffStruct::FieldType::Orientation: {
                 string value(child.second.get_value<string>());
                 boost::split(tokens, value, boost::is_any_of("|"), boost::token_compress_on);
-                field.quatValue = glm::quat(stof(tokens[0]), stof(tokens[1]), stof(tokens[2]), stof(tokens[3]));
+                gffs->add(GffStruct::Field::newOrientation(label, glm::quat(stof(tokens[0]), stof(tokens[1]), stof(tokens[2]), stof(tokens[3]))));
                 break;
             }
             case GffStruct::FieldType::Vector: {
                 string value(child.second.get_value<string>());
                 boost::split(tokens, value, boost::is_any_of("|"), boost::token_compress_on);
-                field.vecValue = glm::vec3(stof(tokens[0]), stof(tokens[1]), stof(tokens[2]));
+                gffs->add(GffStruct::Field::newVector(label, glm::vec3(stof(tokens[0]), stof(tokens[1]), stof(tokens[2]))));
                 break;
             }
             case GffStruct::FieldType::StrRef:
-                field.intValue = child.second.get_value<int32_t>();
+                gffs->add(GffStruct::Field::newStrRef(label, child.second.get_value<int32_t>()));
                 break;
             default:
-                throw runtime_error("Unsupported field type: " + to_string(static_cast<int>(field.type)));
+                throw runtime_error("Unsupported field type: " + to_string(static_cast<int>(type)));
         }
-
-        gffs->add(move(field));
     }
 
     return move(gffs);
@@ -261,7 +318,7 @@ void GffTool::toGFF(const fs::path &path, const fs::path &destPath) {
 bool GffTool::supports(Operation operation, const fs::path &target) const {
     return
         !fs::is_directory(target) &&
-        (operation == Operation::ToJSON || operation == Operation::ToGFF);
+        (operation == Operation::List || operation == Operation::ToJSON || operation == Operation::ToGFF);
 }
 
 } // namespace tools
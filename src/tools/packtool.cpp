@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2020-2021 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "tools.h"
+
+#include "../engine/common/pathutil.h"
+#include "../engine/resource/folder.h"
+#include "../engine/resource/format/packwriter.h"
+#include "../engine/resource/keybifprovider.h"
+#include "../engine/resource/typeutil.h"
+
+using namespace std;
+
+using namespace reone::resource;
+
+namespace fs = boost::filesystem;
+
+namespace reone {
+
+namespace tools {
+
+void PackTool::invoke(Operation operation, const fs::path &target, const fs::path &gamePath, const fs::path &destPath) {
+    switch (operation) {
+        case Operation::List: {
+            PackResourceProvider pack;
+            pack.load(target);
+            list(pack);
+            break;
+        }
+        case Operation::ToPack:
+            toPack(gamePath, destPath);
+            break;
+    }
+}
+
+void PackTool::list(PackResourceProvider &pack) {
+    pack.forEachResource([](int idx, const ResRef &resRef, ResourceType type) {
+        cout << resRef.str() << " " << getExtByResType(type) << endl;
+    });
+}
+
+void PackTool::toPack(const fs::path &gamePath, const fs::path &destPath) {
+    bool tsl = fs::exists(getPathIgnoreCase(gamePath, "swkotor2.exe", false));
+
+    PackWriter pack(true);
+    vector<unique_ptr<IResourceProvider>> providers;
+
+    // Resources are added in the order, in which the game indexes them, so
+    // that later providers override earlier ones
+    auto addProvider = [&](unique_ptr<IResourceProvider> provider, const fs::path &path) {
+        IResourceProvider *providerPtr = provider.get();
+        unordered_set<ResourceId> added;
+        provider->forEachResource([&](int idx, const ResRef &resRef, ResourceType type) {
+            // Within a single provider, the first occurrence of a resource wins
+            if (!providerPtr->supports(type) || !added.insert(ResourceId(resRef, type)).second) return;
+
+            PackWriter::Resource res;
+            res.resRef = resRef.str();
+            res.resType = type;
+            res.data = [providerPtr, idx]() { return providerPtr->getResourceView(idx); };
+            pack.add(move(res));
+        });
+        providers.push_back(move(provider));
+        cout << "Added " << added.size() << " resources from " << path.string() << endl;
+    };
+    auto addKeyFile = [&](const fs::path &path) {
+        if (path.empty()) return;
+        auto keyBif = make_unique<KeyBifResourceProvider>();
+        keyBif->init(path);
+        addProvider(move(keyBif), path);
+    };
+    auto addErfFile = [&](const fs::path &path) {
+        if (path.empty()) return;
+        auto erf = make_unique<ErfReader>();
+        erf->load(path);
+        addProvider(move(erf), path);
+    };
+    auto addDirectory = [&](const fs::path &path) {
+        if (path.empty()) return;
+        auto folder = make_unique<Folder>();
+        folder->load(path);
+        addProvider(move(folder), path);
+    };
+
+    addKeyFile(getPathIgnoreCase(gamePath, "chitin.key"));
+    if (!tsl) {
+        addErfFile(getPathIgnoreCase(gamePath, "patch.erf", false));
+    }
+
+    fs::path texPacksPath(getPathIgnoreCase(gamePath, "texturepacks"));
+    if (!texPacksPath.empty()) {
+        addErfFile(getPathIgnoreCase(texPacksPath, "swpc_tex_gui.erf"));
+        addErfFile(getPathIgnoreCase(texPacksPath, "swpc_tex_tpa.erf"));
+    }
+
+    addDirectory(getPathIgnoreCase(gamePath, "streammusic"));
+    addDirectory(getPathIgnoreCase(gamePath, "streamsounds"));
+    addDirectory(getPathIgnoreCase(gamePath, tsl ? "streamvoice" : "streamwaves"));
+
+    fs::path lipsPath(getPathIgnoreCase(gamePath, "lips"));
+    if (!lipsPath.empty()) {
+        if (!tsl) {
+            addErfFile(getPathIgnoreCase(lipsPath, "global.mod"));
+        }
+        addErfFile(getPathIgnoreCase(lipsPath, "localization.mod"));
+    }
+
+    addDirectory(getPathIgnoreCase(gamePath, "override"));
+
+    fs::path packPath(destPath);
+    packPath.append(kResourcePackFilename);
+
+    cout << "Writing " << pack.resourceCount() << " resources to " << packPath.string() << endl;
+    pack.save(packPath);
+}
+
+bool PackTool::supports(Operation operation, const fs::path &target) const {
+    switch (operation) {
+        case Operation::List:
+            return !fs::is_directory(target) && target.extension() == ".rpk";
+        case Operation::ToPack:
+            return true;
+        default:
+            return false;
+    }
+}
+
+} // namespace tools
+
+} // namespace reone
@@ -49,7 +49,8 @@ static const unordered_map<string, Operation> g_operations {
     { "to-pth", Operation::ToPTH },
     { "to-ascii", Operation::ToASCII },
     { "to-tlk", Operation::ToTLK },
-    { "to-lip", Operation::ToLIP }
+    { "to-lip", Operation::ToLIP },
+    { "to-pack", Operation::ToPack }
 };
 
 Program::Program(int argc, char **argv) : _argc(argc), _argv(argv) {
@@ -82,7 +83,7 @@ void Program::initOptions() {
     _optsCmdLine.add_options()
         ("game", po::value<string>(), "path to game directory")
         ("dest", po::value<string>(), "path to destination directory")
-        ("list", "list file contents")
+        ("list", "list file contents, or memory usage of a GFF file")
         ("extract", "extract file contents")
         ("unwrap", "unwrap an audio file")
         ("to-json", "convert 2DA, GFF or TLK file to JSON")
@@ -96,6 +97,7 @@ void Program::initOptions() {
         ("to-ascii", "convert binary PTH to ASCII")
         ("to-tlk", "convert JSON to TLK")
         ("to-lip", "convert JSON to LIP")
+        ("to-pack", "create resource pack from game directory")
         ("target", po::value<string>(), "target name or path to input file");
 }
 
@@ -152,6 +154,7 @@ void Program::loadTools() {
     _tools.push_back(make_shared<TpcTool>());
     _tools.push_back(make_shared<PthTool>());
     _tools.push_back(make_shared<AudioTool>());
+    _tools.push_back(make_shared<PackTool>());
 }
 
 shared_ptr<ITool> Program::getTool() const {
@@ -22,6 +22,7 @@
 #include "../engine/resource/format/erfreader.h"
 #include "../engine/resource/format/keyreader.h"
 #include "../engine/resource/format/rimreader.h"
+#include "../engine/resource/packprovider.h"
 
 #include "types.h"
 
@@ -114,6 +115,7 @@ public:
     bool supports(Operation operation, const boost::filesystem::path &target) const override;
 
 private:
+    void list(const boost::filesystem::path &path);
     void toJSON(const boost::filesystem::path &path, const boost::filesystem::path &destPath);
     void toGFF(const boost::filesystem::path &path, const boost::filesystem::path &destPath);
 };
@@ -189,6 +191,21 @@ private:
     void toLIP(const boost::filesystem::path &path, const boost::filesystem::path &destPath);
 };
 
+class PackTool : public ITool {
+public:
+    void invoke(
+        Operation operation,
+        const boost::filesystem::path &target,
+        const boost::filesystem::path &gamePath,
+        const boost::filesystem::path &destPath) override;
+
+    bool supports(Operation operation, const boost::filesystem::path &target) const override;
+
+private:
+    void list(resource::PackResourceProvider &pack);
+    void toPack(const boost::filesystem::path &gamePath, const boost::filesystem::path &destPath);
+};
+
 } // namespace tools
 
 } // namespace reone